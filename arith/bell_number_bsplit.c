@@ -46,41 +46,42 @@ _bell_series_cutoff(slong n)
     return N;
 }
 
+typedef struct
+{
+    ulong n;
+    ulong bmax;
+}
+bell_bsplit_arg_t;
+
 static void
-_mpz_bell_bsplit(mpz_t P, mpz_t Q, slong a, slong b, slong n, slong bmax)
+_bell_bsplit_basecase(fmpz * PQ, ulong a, ulong b, void * args)
 {
-    if (b - a < 20)
-    {
-        mpz_t u;
-        slong k;
-        mpz_init(u);
-        flint_mpz_set_ui(P, UWORD(0));
-        flint_mpz_set_ui(Q, UWORD(0));
-        flint_mpz_set_ui(Q, (b - 1 == bmax) ? UWORD(1) : b);
-        for (k = b - 1; k >= a; k--)
-        {
-            flint_mpz_set_ui(u, k);
-            flint_mpz_pow_ui(u, u, n);
-            mpz_addmul(P, Q, u);
-            if (k != a)
-                flint_mpz_mul_ui(Q, Q, k);
-        }
-        mpz_clear(u);
-    }
-    else
+    const bell_bsplit_arg_t * arg = (const bell_bsplit_arg_t *) args;
+    fmpz * P = PQ;
+    fmpz * Q = PQ + 1;
+    fmpz_t u;
+    slong k;
+
+    fmpz_init(u);
+    fmpz_zero(P);
+    fmpz_set_ui(Q, (b - 1 == arg->bmax) ? UWORD(1) : b);
+    for (k = b - 1; k >= (slong) a; k--)
     {
-        slong m;
-        mpz_t P1, Q2;
-        m = (a + b) / 2;
-        mpz_init(P1);
-        mpz_init(Q2);
-        _mpz_bell_bsplit(P1, Q, a, m, n, bmax);
-        _mpz_bell_bsplit(P, Q2, m, b, n, bmax);
-        mpz_mul(Q, Q, Q2);
-        mpz_addmul(P, P1, Q2);
-        mpz_clear(P1);
-        mpz_clear(Q2);
+        fmpz_set_ui(u, k);
+        fmpz_pow_ui(u, u, arg->n);
+        fmpz_addmul(P, Q, u);
+        if (k != a)
+            fmpz_mul_ui(Q, Q, k);
     }
+    fmpz_clear(u);
+}
+
+static void
+_bell_bsplit_merge(fmpz * left, fmpz * right, void * args)
+{
+    fmpz_mul_fft(left, left, right + 1);
+    fmpz_add(left, left, right);
+    fmpz_mul_fft(left + 1, left + 1, right + 1);
 }
 
 void
@@ -88,37 +89,40 @@ arith_bell_number_bsplit(fmpz_t b, ulong n)
 {
     slong N;
     mp_bitcnt_t prec;
-    mpz_t P, Q;
+    fmpz PQ[2];
+    bell_bsplit_arg_t arg;
     mpfr_t Pf, Qf, E, one;
 
     N = _bell_series_cutoff(n);
 
-    mpz_init(P);
-    mpz_init(Q);
+    fmpz_init(PQ);
+    fmpz_init(PQ + 1);
 
-    _mpz_bell_bsplit(P, Q, 1, N + 1, n, N);
+    arg.n = n;
+    arg.bmax = N;
+    fmpz_bsplit(PQ, 2, 1, N + 1, 20,
+        _bell_bsplit_basecase, _bell_bsplit_merge, &arg);
 
-    prec = mpz_sizeinbase(P, 2) - mpz_sizeinbase(Q, 2) + 10;
+    prec = fmpz_bits(PQ) - fmpz_bits(PQ + 1) + 10;
 
     mpfr_init2(Pf, prec);
     mpfr_init2(Qf, prec);
     mpfr_init2(E, prec);
     mpfr_init2(one, 2);
 
-    mpfr_set_z(Pf, P, GMP_RNDN);
-    mpfr_set_z(Qf, Q, GMP_RNDN);
+    fmpz_get_mpfr(Pf, PQ, GMP_RNDN);
+    fmpz_get_mpfr(Qf, PQ + 1, GMP_RNDN);
     mpfr_set_ui(one, 1, GMP_RNDN);
     mpfr_exp(E, one, GMP_RNDN);
     mpfr_mul(Qf, Qf, E, GMP_RNDN);
     mpfr_div(Pf, Pf, Qf, GMP_RNDN);
-    mpfr_get_z(P, Pf, GMP_RNDN);
-
-    fmpz_set_mpz(b, P);
+    mpfr_get_z(_fmpz_promote(b), Pf, GMP_RNDN);
+    _fmpz_demote_val(b);
 
     mpfr_clear(one);
     mpfr_clear(Pf);
     mpfr_clear(Qf);
     mpfr_clear(E);
-    mpz_clear(P);
-    mpz_clear(Q);
+    fmpz_clear(PQ);
+    fmpz_clear(PQ + 1);
 }
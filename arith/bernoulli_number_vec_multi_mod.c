@@ -24,6 +24,7 @@
 ******************************************************************************/
 
 #include <math.h>
+#include <pthread.h>
 #include "arith.h"
 
 static void
@@ -60,16 +61,114 @@ __bernoulli_number_vec_mod_p(mp_ptr res, mp_ptr tmp, const fmpz * den,
 
 #define CRT_MAX_RESOLUTION 16
 
-void _arith_bernoulli_number_vec_multi_mod(fmpz * num, fmpz * den, slong n)
+typedef struct
 {
-    fmpz_comb_t comb[CRT_MAX_RESOLUTION];
-    fmpz_comb_temp_t temp[CRT_MAX_RESOLUTION];
-    mp_limb_t * primes;
-    mp_limb_t * residues;
     mp_ptr * polys;
+    mp_srcptr primes;
+    const fmpz * den;
+    slong m;
+    slong k0;
+    slong k1;
+}
+bernoulli_mod_arg_t;
+
+static void
+_bernoulli_mod_p_range(bernoulli_mod_arg_t * arg)
+{
     mp_ptr temppoly;
     nmod_t mod;
-    slong i, j, k, m, num_primes, num_primes_k, resolution;
+    slong k;
+
+    temppoly = _nmod_vec_init(arg->m);
+
+    for (k = arg->k0; k < arg->k1; k++)
+    {
+        nmod_init(&mod, arg->primes[k]);
+        __bernoulli_number_vec_mod_p(arg->polys[k], temppoly,
+            arg->den, arg->m, mod);
+    }
+
+    _nmod_vec_clear(temppoly);
+}
+
+static void *
+_bernoulli_mod_p_worker(void * arg_ptr)
+{
+    _bernoulli_mod_p_range((bernoulli_mod_arg_t *) arg_ptr);
+    flint_cleanup();
+    return NULL;
+}
+
+typedef struct
+{
+    fmpz * num;
+    const fmpz * den;
+    mp_ptr * polys;
+    fmpz_comb_struct * comb;
+    slong resolution;
+    slong n;
+    slong start;
+    slong step;
+}
+bernoulli_crt_arg_t;
+
+/* Reconstructs num[k] for even k = start, start + step, ... */
+static void
+_bernoulli_crt_range(bernoulli_crt_arg_t * arg)
+{
+    fmpz_comb_temp_t temp[CRT_MAX_RESOLUTION];
+    mp_limb_t * residues;
+    mp_bitcnt_t size, prime_bits = FLINT_BITS - 1;
+    slong i, j, k, num_primes_k;
+
+    residues = flint_malloc(arg->comb[arg->resolution - 1].num_primes
+                             * sizeof(mp_limb_t));
+    for (i = 0; i < arg->resolution; i++)
+        fmpz_comb_temp_init(temp[i], arg->comb + i);
+
+    for (k = arg->start; k < arg->n; k += arg->step)
+    {
+        size = arith_bernoulli_number_size(k) + fmpz_bits(arg->den + k) + 2;
+        /* Use only as large a comb as needed */
+        num_primes_k = (size + prime_bits - 1) / prime_bits;
+        for (i = 0; i < arg->resolution; i++)
+        {
+            if (arg->comb[i].num_primes >= num_primes_k)
+                break;
+        }
+        num_primes_k = arg->comb[i].num_primes;
+        for (j = 0; j < num_primes_k; j++)
+            residues[j] = arg->polys[j][k / 2];
+        fmpz_multi_CRT_ui(arg->num + k, residues, arg->comb + i, temp[i], 1);
+    }
+
+    for (i = 0; i < arg->resolution; i++)
+        fmpz_comb_temp_clear(temp[i]);
+    flint_free(residues);
+}
+
+static void *
+_bernoulli_crt_worker(void * arg_ptr)
+{
+    _bernoulli_crt_range((bernoulli_crt_arg_t *) arg_ptr);
+    flint_cleanup();
+    return NULL;
+}
+
+/*
+    The images modulo the individual primes are independent power 
+    series inversions, and so are the reconstructions of the entries; 
+    both are distributed over flint_get_num_threads() threads.  The 
+    entries grow with k, so the CRT is interleaved rather than split 
+    into blocks to keep the threads balanced.
+ */
+
+void _arith_bernoulli_number_vec_multi_mod(fmpz * num, fmpz * den, slong n)
+{
+    fmpz_comb_struct comb[CRT_MAX_RESOLUTION];
+    mp_limb_t * primes;
+    mp_ptr * polys;
+    slong i, k, m, num_primes, resolution, num_threads;
     mp_bitcnt_t size, prime_bits;
 
     if (n < 1)
@@ -88,28 +187,63 @@ void _arith_bernoulli_number_vec_multi_mod(fmpz * num, fmpz * den, slong n)
     prime_bits = FLINT_BITS - 1;
     num_primes = (size + prime_bits - 1) / prime_bits;
 
+    num_threads = flint_get_num_threads();
+    num_threads = FLINT_MAX(1, FLINT_MIN(num_threads, num_primes));
+
     primes = flint_malloc(num_primes * sizeof(mp_limb_t));
-    residues = flint_malloc(num_primes * sizeof(mp_limb_t));
     polys = flint_malloc(num_primes * sizeof(mp_ptr));
 
     /* Compute Bernoulli numbers mod p */
     primes[0] = n_nextprime(UWORD(1)<<prime_bits, 0);
     for (k = 1; k < num_primes; k++)
         primes[k] = n_nextprime(primes[k-1], 0);
-    temppoly = _nmod_vec_init(m);
     for (k = 0; k < num_primes; k++)
-    {
         polys[k] = _nmod_vec_init(m);
-        nmod_init(&mod, primes[k]);
-        __bernoulli_number_vec_mod_p(polys[k], temppoly, den, m, mod);
+
+    if (num_threads == 1)
+    {
+        bernoulli_mod_arg_t arg;
+
+        arg.polys = polys;
+        arg.primes = primes;
+        arg.den = den;
+        arg.m = m;
+        arg.k0 = 0;
+        arg.k1 = num_primes;
+
+        _bernoulli_mod_p_range(&arg);
+    }
+    else
+    {
+        pthread_t * threads;
+        bernoulli_mod_arg_t * args;
+
+        threads = flint_malloc(sizeof(pthread_t) * num_threads);
+        args = flint_malloc(sizeof(bernoulli_mod_arg_t) * num_threads);
+
+        for (i = 0; i < num_threads; i++)
+        {
+            args[i].polys = polys;
+            args[i].primes = primes;
+            args[i].den = den;
+            args[i].m = m;
+            args[i].k0 = (i * num_primes) / num_threads;
+            args[i].k1 = ((i + 1) * num_primes) / num_threads;
+
+            pthread_create(&threads[i], NULL,
+                _bernoulli_mod_p_worker, &args[i]);
+        }
+
+        for (i = 0; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
+
+        flint_free(threads);
+        flint_free(args);
     }
 
     /* Init CRT comb */
     for (i = 0; i < resolution; i++)
-    {
-        fmpz_comb_init(comb[i], primes, num_primes * (i + 1) / resolution);
-        fmpz_comb_temp_init(temp[i], comb[i]);
-    }
+        fmpz_comb_init(comb + i, primes, num_primes * (i + 1) / resolution);
 
     /* Trivial entries */
     if (n > 1)
@@ -118,33 +252,60 @@ void _arith_bernoulli_number_vec_multi_mod(fmpz * num, fmpz * den, slong n)
         fmpz_zero(num + k);
 
     /* Reconstruction */
-    for (k = 0; k < n; k += 2)
+    num_threads = flint_get_num_threads();
+    num_threads = FLINT_MAX(1, FLINT_MIN(num_threads, m));
+
+    if (num_threads == 1)
     {
-        size = arith_bernoulli_number_size(k) + fmpz_bits(den + k) + 2;
-        /* Use only as large a comb as needed */
-        num_primes_k = (size + prime_bits - 1) / prime_bits;
-        for (i = 0; i < resolution; i++)
+        bernoulli_crt_arg_t arg;
+
+        arg.num = num;
+        arg.den = den;
+        arg.polys = polys;
+        arg.comb = comb;
+        arg.resolution = resolution;
+        arg.n = n;
+        arg.start = 0;
+        arg.step = 2;
+
+        _bernoulli_crt_range(&arg);
+    }
+    else
+    {
+        pthread_t * threads;
+        bernoulli_crt_arg_t * args;
+
+        threads = flint_malloc(sizeof(pthread_t) * num_threads);
+        args = flint_malloc(sizeof(bernoulli_crt_arg_t) * num_threads);
+
+        for (i = 0; i < num_threads; i++)
         {
-            if (comb[i]->num_primes >= num_primes_k)
-                break;
+            args[i].num = num;
+            args[i].den = den;
+            args[i].polys = polys;
+            args[i].comb = comb;
+            args[i].resolution = resolution;
+            args[i].n = n;
+            args[i].start = 2 * i;
+            args[i].step = 2 * num_threads;
+
+            pthread_create(&threads[i], NULL,
+                _bernoulli_crt_worker, &args[i]);
         }
-        num_primes_k = comb[i]->num_primes;
-        for (j = 0; j < num_primes_k; j++)
-            residues[j] = polys[j][k / 2];
-        fmpz_multi_CRT_ui(num + k, residues, comb[i], temp[i], 1);
+
+        for (i = 0; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
+
+        flint_free(threads);
+        flint_free(args);
     }
 
     /* Cleanup */
     for (k = 0; k < num_primes; k++)
         _nmod_vec_clear(polys[k]);
-    _nmod_vec_clear(temppoly);
     for (i = 0; i < resolution; i++)
-    {
-        fmpz_comb_temp_clear(temp[i]);
-        fmpz_comb_clear(comb[i]);
-    }
+        fmpz_comb_clear(comb + i);
 
     flint_free(primes);
-    flint_free(residues);
     flint_free(polys);
 }
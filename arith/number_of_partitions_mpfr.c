@@ -26,6 +26,7 @@
 ******************************************************************************/
 
 #include <math.h>
+#include <pthread.h>
 #include "arith.h"
 
 #define DOUBLE_PREC 53
@@ -397,67 +398,55 @@ sinh_cosh_divk_precomp(mpfr_t sh, mpfr_t ch, mpfr_t ex, slong k)
 }
 
 
-void
-_arith_number_of_partitions_mpfr(mpfr_t x, ulong n, slong N0, slong N)
+typedef struct
 {
-    trig_prod_t prod;
-    mpfr_t acc, C, t1, t2, t3, t4, exp1;
-    mpz_t n24;
+    mpfr_ptr sum;
+    ulong n;
+    slong N;
+    slong * next;
+    pthread_mutex_t * mutex;
+    mpfr_srcptr C;
+    mpfr_srcptr exp1;
+    mpz_srcptr n24;
     double Cd;
-    slong k;
-    slong prec, guard_bits;
-#if VERBOSE
-    timeit_t t0;
-#endif
+}
+hrr_sum_arg_t;
 
-    if (n <= 2)
-    {
-        mpfr_set_ui(x, FLINT_MAX(1, n), MPFR_RNDN);
-        return;
-    }
+/*
+    Adds the terms of the Hardy-Ramanujan-Rademacher series to arg->sum, 
+    taking indices k from the shared counter until it passes N.  Since 
+    each worker sees increasing k, the working precision can be lowered 
+    as in the sequential loop.
+ */
 
-    /* Compute initial precision */
-    guard_bits = 2 * FLINT_BIT_COUNT(N) + 32;
-    prec = partitions_remainder_bound_log2(n, N0) + guard_bits;
-    prec = FLINT_MAX(prec, DOUBLE_PREC);
+static void
+_hrr_sum_terms(hrr_sum_arg_t * arg)
+{
+    trig_prod_t prod;
+    mpfr_t acc, t1, t2, t3, t4;
+    const ulong n = arg->n;
+    const slong N = arg->N;
+    slong k, prec;
+
+    prec = mpfr_get_prec(arg->sum);
 
-    mpfr_set_prec(x, prec);
     mpfr_init2(acc, prec);
-    mpfr_init2(C, prec);
     mpfr_init2(t1, prec);
     mpfr_init2(t2, prec);
     mpfr_init2(t3, prec);
     mpfr_init2(t4, prec);
 
-    mpfr_set_ui(x, 0, MPFR_RNDN);
     mpfr_set_ui(acc, 0, MPFR_RNDN);
 
-    mpz_init(n24);
-    flint_mpz_set_ui(n24, n);
-    flint_mpz_mul_ui(n24, n24, 24);
-    flint_mpz_sub_ui(n24, n24, 1);
-
-#if VERBOSE
-    timeit_start(t0);
-#endif
-
-    /* C = (pi/6)*sqrt(24*n-1) */
-    mpfr_const_pi(t1, MPFR_RNDN);
-    mpfr_sqrt_z(t2, n24, MPFR_RNDN);
-    mpfr_mul(t1, t1, t2, MPFR_RNDN);
-    mpfr_div_ui(C, t1, 6, MPFR_RNDN);
-    Cd = mpfr_get_d(C, MPFR_RNDN);
+    while (1)
+    {
+        pthread_mutex_lock(arg->mutex);
+        k = (*arg->next)++;
+        pthread_mutex_unlock(arg->mutex);
 
-    mpfr_init2(exp1, prec);
-    mpfr_exp(exp1, C, prec);
+        if (k > N)
+            break;
 
-#if VERBOSE
-    timeit_stop(t0);
-    flint_printf("TERM 1: %wd ms\n", t0->cpu);
-#endif
-
-    for (k = N0; k <= N; k++)
-    {
         trig_prod_init(prod);
         arith_hrr_expsum_factored(prod, k, n % k);
 
@@ -478,20 +467,20 @@ _arith_number_of_partitions_mpfr(mpfr_t x, ulong n, slong N0, slong N)
             prod->sqrt_p *= 3;
             prod->sqrt_q *= k;
             eval_trig_prod(t1, prod);
-            mpfr_div_z(t1, t1, n24, MPFR_RNDN);
+            mpfr_div_z(t1, t1, arg->n24, MPFR_RNDN);
 
             /* Multiply by (cosh(z) - sinh(z)/z) where z = C / k */
             if (prec <= DOUBLE_PREC)
             {
-                double z = Cd / k;
+                double z = arg->Cd / k;
                 mpfr_mul_d(t1, t1, cosh(z) - sinh(z)/z, MPFR_RNDN);
             }
             else
             {
-                mpfr_div_ui(t2, C, k, MPFR_RNDN);
+                mpfr_div_ui(t2, arg->C, k, MPFR_RNDN);
 
                 if (k < 35)
-                    sinh_cosh_divk_precomp(t3, t4, exp1, k);
+                    sinh_cosh_divk_precomp(t3, t4, (mpfr_ptr) arg->exp1, k);
                 else
                     mpfr_sinh_cosh(t3, t4, t2, MPFR_RNDN);
 
@@ -504,25 +493,153 @@ _arith_number_of_partitions_mpfr(mpfr_t x, ulong n, slong N0, slong N)
             mpfr_add(acc, acc, t1, MPFR_RNDN);
             if (mpfr_get_prec(acc) > 2 * prec + 32)
             {
-                mpfr_add(x, x, acc, MPFR_RNDN);
+                mpfr_add(arg->sum, arg->sum, acc, MPFR_RNDN);
                 mpfr_set_prec(acc, prec + 32);
                 mpfr_set_ui(acc, 0, MPFR_RNDN);
             }
         }
     }
 
-    mpfr_add(x, x, acc, MPFR_RNDN);
+    mpfr_add(arg->sum, arg->sum, acc, MPFR_RNDN);
 
-    mpz_clear(n24);
     mpfr_clear(acc);
-    mpfr_clear(exp1);
-    mpfr_clear(C);
     mpfr_clear(t1);
     mpfr_clear(t2);
     mpfr_clear(t3);
     mpfr_clear(t4);
 }
 
+static void *
+_hrr_sum_worker(void * arg_ptr)
+{
+    _hrr_sum_terms((hrr_sum_arg_t *) arg_ptr);
+    flint_cleanup();
+    return NULL;
+}
+
+/* Only spread the terms over threads if there are enough to share */
+#define HRR_THREADED_CUTOFF 200
+
+void
+_arith_number_of_partitions_mpfr(mpfr_t x, ulong n, slong N0, slong N)
+{
+    hrr_sum_arg_t * args;
+    pthread_mutex_t mutex;
+    mpfr_t C, t1, t2, exp1;
+    mpz_t n24;
+    double Cd;
+    slong i, next, num_threads;
+    slong prec, guard_bits;
+#if VERBOSE
+    timeit_t t0;
+#endif
+
+    if (n <= 2)
+    {
+        mpfr_set_ui(x, FLINT_MAX(1, n), MPFR_RNDN);
+        return;
+    }
+
+    /* Compute initial precision */
+    guard_bits = 2 * FLINT_BIT_COUNT(N) + 32;
+    prec = partitions_remainder_bound_log2(n, N0) + guard_bits;
+    prec = FLINT_MAX(prec, DOUBLE_PREC);
+
+    mpfr_set_prec(x, prec);
+    mpfr_init2(C, prec);
+    mpfr_init2(t1, prec);
+    mpfr_init2(t2, prec);
+
+    mpfr_set_ui(x, 0, MPFR_RNDN);
+
+    mpz_init(n24);
+    flint_mpz_set_ui(n24, n);
+    flint_mpz_mul_ui(n24, n24, 24);
+    flint_mpz_sub_ui(n24, n24, 1);
+
+#if VERBOSE
+    timeit_start(t0);
+#endif
+
+    /* C = (pi/6)*sqrt(24*n-1) */
+    mpfr_const_pi(t1, MPFR_RNDN);
+    mpfr_sqrt_z(t2, n24, MPFR_RNDN);
+    mpfr_mul(t1, t1, t2, MPFR_RNDN);
+    mpfr_div_ui(C, t1, 6, MPFR_RNDN);
+    Cd = mpfr_get_d(C, MPFR_RNDN);
+
+    mpfr_init2(exp1, prec);
+    mpfr_exp(exp1, C, prec);
+
+#if VERBOSE
+    timeit_stop(t0);
+    flint_printf("TERM 1: %wd ms\n", t0->cpu);
+#endif
+
+    num_threads = flint_get_num_threads();
+    if (N - N0 < HRR_THREADED_CUTOFF)
+        num_threads = 1;
+
+    args = flint_malloc(sizeof(hrr_sum_arg_t) * num_threads);
+    pthread_mutex_init(&mutex, NULL);
+    next = N0;
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].sum = (i == 0) ? x : flint_malloc(sizeof(__mpfr_struct));
+        if (i != 0)
+        {
+            mpfr_init2(args[i].sum, prec);
+            mpfr_set_ui(args[i].sum, 0, MPFR_RNDN);
+        }
+        args[i].n = n;
+        args[i].N = N;
+        args[i].next = &next;
+        args[i].mutex = &mutex;
+        args[i].C = C;
+        args[i].exp1 = exp1;
+        args[i].n24 = n24;
+        args[i].Cd = Cd;
+    }
+
+    if (num_threads == 1)
+    {
+        _hrr_sum_terms(args);
+    }
+    else
+    {
+        pthread_t * threads;
+
+        threads = flint_malloc(sizeof(pthread_t) * (num_threads - 1));
+
+        for (i = 1; i < num_threads; i++)
+            pthread_create(&threads[i - 1], NULL, _hrr_sum_worker, &args[i]);
+
+        _hrr_sum_terms(args);
+
+        for (i = 1; i < num_threads; i++)
+            pthread_join(threads[i - 1], NULL);
+
+        for (i = 1; i < num_threads; i++)
+        {
+            mpfr_add(x, x, args[i].sum, MPFR_RNDN);
+            mpfr_clear(args[i].sum);
+            flint_free(args[i].sum);
+        }
+
+        flint_free(threads);
+    }
+
+    pthread_mutex_destroy(&mutex);
+    flint_free(args);
+
+    mpz_clear(n24);
+    mpfr_clear(exp1);
+    mpfr_clear(C);
+    mpfr_clear(t1);
+    mpfr_clear(t2);
+}
+
 void
 arith_number_of_partitions_mpfr(mpfr_t x, ulong n)
 {
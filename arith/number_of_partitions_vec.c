@@ -34,6 +34,14 @@ arith_number_of_partitions_vec(fmpz * res, slong len)
     if (len < 1)
         return;
 
+    /* The multimodular algorithm is slower on a single thread, but its 
+       per-prime series inversions and CRT run in parallel */
+    if (len >= 1000 && flint_get_num_threads() >= 3)
+    {
+        arith_number_of_partitions_vec_multi_mod(res, len);
+        return;
+    }
+
     tmp = _fmpz_vec_init(len);
 
     tmp[0] = WORD(1);
@@ -0,0 +1,256 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <math.h>
+#include <pthread.h>
+#include "nmod_poly.h"
+#include "arith.h"
+
+#define CRT_MAX_RESOLUTION 16
+
+/* Upper bound for the bit size of p(n) < exp(pi sqrt(2n/3)) */
+static __inline__ mp_bitcnt_t
+partitions_size(slong n)
+{
+    return (mp_bitcnt_t) (2.5650996603237281911 * sqrt((double) n)
+                            * 1.44269504088896340736) + 2;
+}
+
+typedef struct
+{
+    mp_ptr * polys;
+    mp_srcptr primes;
+    slong len;
+    slong k0;
+    slong k1;
+}
+partitions_mod_arg_t;
+
+static void
+_partitions_mod_p_range(partitions_mod_arg_t * arg)
+{
+    nmod_t mod;
+    slong k;
+
+    for (k = arg->k0; k < arg->k1; k++)
+    {
+        nmod_init(&mod, arg->primes[k]);
+        arith_number_of_partitions_nmod_vec(arg->polys[k], arg->len, mod);
+    }
+}
+
+static void *
+_partitions_mod_p_worker(void * arg_ptr)
+{
+    _partitions_mod_p_range((partitions_mod_arg_t *) arg_ptr);
+    flint_cleanup();
+    return NULL;
+}
+
+typedef struct
+{
+    fmpz * res;
+    mp_ptr * polys;
+    fmpz_comb_struct * comb;
+    slong resolution;
+    slong len;
+    slong start;
+    slong step;
+}
+partitions_crt_arg_t;
+
+/* Reconstructs res[k] for k = start, start + step, ... */
+static void
+_partitions_crt_range(partitions_crt_arg_t * arg)
+{
+    fmpz_comb_temp_t temp[CRT_MAX_RESOLUTION];
+    mp_limb_t * residues;
+    mp_bitcnt_t size, prime_bits = FLINT_BITS - 1;
+    slong i, j, k, num_primes_k;
+
+    residues = flint_malloc(arg->comb[arg->resolution - 1].num_primes
+                             * sizeof(mp_limb_t));
+    for (i = 0; i < arg->resolution; i++)
+        fmpz_comb_temp_init(temp[i], arg->comb + i);
+
+    for (k = arg->start; k < arg->len; k += arg->step)
+    {
+        size = partitions_size(k);
+        /* Use only as large a comb as needed */
+        num_primes_k = (size + prime_bits - 1) / prime_bits;
+        for (i = 0; i < arg->resolution; i++)
+        {
+            if (arg->comb[i].num_primes >= num_primes_k)
+                break;
+        }
+        num_primes_k = arg->comb[i].num_primes;
+        for (j = 0; j < num_primes_k; j++)
+            residues[j] = arg->polys[j][k];
+        fmpz_multi_CRT_ui(arg->res + k, residues, arg->comb + i, temp[i], 0);
+    }
+
+    for (i = 0; i < arg->resolution; i++)
+        fmpz_comb_temp_clear(temp[i]);
+    flint_free(residues);
+}
+
+static void *
+_partitions_crt_worker(void * arg_ptr)
+{
+    _partitions_crt_range((partitions_crt_arg_t *) arg_ptr);
+    flint_cleanup();
+    return NULL;
+}
+
+void
+arith_number_of_partitions_vec_multi_mod(fmpz * res, slong len)
+{
+    fmpz_comb_struct comb[CRT_MAX_RESOLUTION];
+    mp_ptr primes;
+    mp_ptr * polys;
+    slong i, k, num_primes, resolution, num_threads;
+    mp_bitcnt_t size, prime_bits;
+
+    if (len < 1)
+        return;
+
+    resolution = FLINT_MAX(1, FLINT_MIN(CRT_MAX_RESOLUTION, len / 16));
+
+    size = partitions_size(len);
+    prime_bits = FLINT_BITS - 1;
+    num_primes = (size + prime_bits - 1) / prime_bits;
+
+    primes = flint_malloc(num_primes * sizeof(mp_limb_t));
+    polys = flint_malloc(num_primes * sizeof(mp_ptr));
+
+    /* Compute partition numbers mod p */
+    primes[0] = n_nextprime(UWORD(1)<<prime_bits, 0);
+    for (k = 1; k < num_primes; k++)
+        primes[k] = n_nextprime(primes[k-1], 0);
+    for (k = 0; k < num_primes; k++)
+        polys[k] = _nmod_vec_init(len);
+
+    num_threads = flint_get_num_threads();
+    num_threads = FLINT_MAX(1, FLINT_MIN(num_threads, num_primes));
+
+    if (num_threads == 1)
+    {
+        partitions_mod_arg_t arg;
+
+        arg.polys = polys;
+        arg.primes = primes;
+        arg.len = len;
+        arg.k0 = 0;
+        arg.k1 = num_primes;
+
+        _partitions_mod_p_range(&arg);
+    }
+    else
+    {
+        pthread_t * threads;
+        partitions_mod_arg_t * args;
+
+        threads = flint_malloc(sizeof(pthread_t) * num_threads);
+        args = flint_malloc(sizeof(partitions_mod_arg_t) * num_threads);
+
+        for (i = 0; i < num_threads; i++)
+        {
+            args[i].polys = polys;
+            args[i].primes = primes;
+            args[i].len = len;
+            args[i].k0 = (i * num_primes) / num_threads;
+            args[i].k1 = ((i + 1) * num_primes) / num_threads;
+
+            pthread_create(&threads[i], NULL,
+                _partitions_mod_p_worker, &args[i]);
+        }
+
+        for (i = 0; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
+
+        flint_free(threads);
+        flint_free(args);
+    }
+
+    /* Init CRT comb */
+    for (i = 0; i < resolution; i++)
+        fmpz_comb_init(comb + i, primes, num_primes * (i + 1) / resolution);
+
+    /* Reconstruction */
+    num_threads = flint_get_num_threads();
+    num_threads = FLINT_MAX(1, FLINT_MIN(num_threads, len));
+
+    if (num_threads == 1)
+    {
+        partitions_crt_arg_t arg;
+
+        arg.res = res;
+        arg.polys = polys;
+        arg.comb = comb;
+        arg.resolution = resolution;
+        arg.len = len;
+        arg.start = 0;
+        arg.step = 1;
+
+        _partitions_crt_range(&arg);
+    }
+    else
+    {
+        pthread_t * threads;
+        partitions_crt_arg_t * args;
+
+        threads = flint_malloc(sizeof(pthread_t) * num_threads);
+        args = flint_malloc(sizeof(partitions_crt_arg_t) * num_threads);
+
+        for (i = 0; i < num_threads; i++)
+        {
+            args[i].res = res;
+            args[i].polys = polys;
+            args[i].comb = comb;
+            args[i].resolution = resolution;
+            args[i].len = len;
+            args[i].start = i;
+            args[i].step = num_threads;
+
+            pthread_create(&threads[i], NULL,
+                _partitions_crt_worker, &args[i]);
+        }
+
+        for (i = 0; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
+
+        flint_free(threads);
+        flint_free(args);
+    }
+
+    /* Cleanup */
+    for (k = 0; k < num_primes; k++)
+        _nmod_vec_clear(polys[k]);
+    for (i = 0; i < resolution; i++)
+        fmpz_comb_clear(comb + i);
+
+    flint_free(primes);
+    flint_free(polys);
+}
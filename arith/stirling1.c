@@ -23,10 +23,42 @@
 
 ******************************************************************************/
 
+#include <pthread.h>
 #include "arith.h"
 
+#define STIRLING1_THREADED_CUTOFF 256
+
+typedef struct
+{
+    fmpz * res;
+    slong a;
+    slong b;
+    slong trunc;
+    slong num_threads;
+}
+rising_factorial_arg_t;
+
 static void
-_rising_factorial(fmpz * res, slong a, slong b, slong trunc)
+_rising_factorial(fmpz * res, slong a, slong b, slong trunc, slong num_threads);
+
+static void *
+_rising_factorial_worker(void * arg_ptr)
+{
+    rising_factorial_arg_t * arg = (rising_factorial_arg_t *) arg_ptr;
+
+    _rising_factorial(arg->res, arg->a, arg->b, arg->trunc, arg->num_threads);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/*
+    While more than one thread is available, the right half of the
+    product is computed by a new thread.
+ */
+
+static void
+_rising_factorial(fmpz * res, slong a, slong b, slong trunc, slong num_threads)
 {
     const slong span = b - a;
 
@@ -75,8 +107,27 @@ _rising_factorial(fmpz * res, slong a, slong b, slong trunc)
             fmpz *left  = _fmpz_vec_init(nleft);
             fmpz *right = _fmpz_vec_init(nright);
 
-            _rising_factorial(left, a, mid, trunc);
-            _rising_factorial(right, mid, b, trunc);
+            if (num_threads > 1 && span >= STIRLING1_THREADED_CUTOFF)
+            {
+                pthread_t thread;
+                rising_factorial_arg_t arg;
+
+                arg.res = right;
+                arg.a = mid;
+                arg.b = b;
+                arg.trunc = trunc;
+                arg.num_threads = num_threads / 2;
+
+                pthread_create(&thread, NULL, _rising_factorial_worker, &arg);
+                _rising_factorial(left, a, mid, trunc,
+                    num_threads - num_threads / 2);
+                pthread_join(thread, NULL);
+            }
+            else
+            {
+                _rising_factorial(left, a, mid, trunc, 1);
+                _rising_factorial(right, mid, b, trunc, 1);
+            }
 
             if (chk)
                 _fmpz_poly_mul(res, right, nright, left, nleft);
@@ -105,7 +156,7 @@ arith_stirling_number_1u(fmpz_t s, slong n, slong k)
     else
     {
         fmpz *tmp = _fmpz_vec_init(k+1);
-        _rising_factorial(tmp, 0, n, k+1);
+        _rising_factorial(tmp, 0, n, k+1, flint_get_num_threads());
         fmpz_set(s, tmp+k);
         _fmpz_vec_clear(tmp, k+1);
     }
@@ -123,7 +174,7 @@ void
 arith_stirling_number_1u_vec(fmpz * row, slong n, slong klen)
 {
     if (klen > 0)
-        _rising_factorial(row, 0, n, klen);
+        _rising_factorial(row, 0, n, klen, flint_get_num_threads());
 }
 
 void
@@ -23,10 +23,11 @@
 
 ******************************************************************************/
 
+#include <pthread.h>
 #include "arith.h"
 
 static __inline__ void
-_fmpz_addmul_alt(fmpz_t s, fmpz_t t, fmpz_t u, int parity)
+_fmpz_addmul_alt(fmpz_t s, const fmpz_t t, const fmpz_t u, int parity)
 {
     if (parity % 2)
         fmpz_submul(s, t, u);
@@ -34,28 +35,34 @@ _fmpz_addmul_alt(fmpz_t s, fmpz_t t, fmpz_t u, int parity)
         fmpz_addmul(s, t, u);
 }
 
+#define STIRLING2_THREADED_CUTOFF 64
+
+typedef struct
+{
+    fmpz_t s;
+    const fmpz * bc;
+    slong n;
+    slong k;
+    slong start;
+    slong step;
+}
+stirling2_powsum_arg_t;
+
+/*
+    Adds the terms for odd j = start, start + step, ... to s.
+ */
+
 static void
-_fmpz_stirling2_powsum(fmpz_t s, slong n, slong k)
+_stirling2_powsum_range(stirling2_powsum_arg_t * arg)
 {
-    fmpz_t t, u;
-    fmpz * bc;
-    slong j, m, max_bc;
+    const fmpz * bc = arg->bc;
+    const slong n = arg->n, k = arg->k, max_bc = (k+1) / 2;
+    fmpz_t u;
+    slong j, m;
 
-    fmpz_init(t);
     fmpz_init(u);
-    max_bc = (k+1) / 2;
 
-    bc = _fmpz_vec_init(max_bc + 1);
-    fmpz_one(bc);
-    for (j = 1; j <= max_bc; j++)
-    {
-        fmpz_set(bc+j, bc+j-1);
-        fmpz_mul_ui(bc+j, bc+j, k+1-j);
-        fmpz_divexact_ui(bc+j, bc+j, j);
-    }
-
-    fmpz_zero(s);
-    for (j = 1; j <= k; j += 2)
+    for (j = arg->start; j <= k; j += arg->step)
     {
         fmpz_set_ui(u, j);
         fmpz_pow_ui(u, u, n);
@@ -64,9 +71,9 @@ _fmpz_stirling2_powsum(fmpz_t s, slong n, slong k)
         while (1)
         {
             if (m > max_bc)
-                _fmpz_addmul_alt(s, bc+k-m, u, k + m);
+                _fmpz_addmul_alt(arg->s, bc+k-m, u, k + m);
             else
-                _fmpz_addmul_alt(s, bc+m, u, k + m);
+                _fmpz_addmul_alt(arg->s, bc+m, u, k + m);
             m *= 2;
             if (m > k)
                 break;
@@ -74,11 +81,79 @@ _fmpz_stirling2_powsum(fmpz_t s, slong n, slong k)
         }
     }
 
+    fmpz_clear(u);
+}
+
+static void *
+_stirling2_powsum_worker(void * arg_ptr)
+{
+    _stirling2_powsum_range((stirling2_powsum_arg_t *) arg_ptr);
+    flint_cleanup();
+    return NULL;
+}
+
+static void
+_fmpz_stirling2_powsum(fmpz_t s, slong n, slong k)
+{
+    fmpz_t t;
+    fmpz * bc;
+    slong i, j, max_bc, num_threads;
+    stirling2_powsum_arg_t * args;
+    pthread_t * threads;
+
+    fmpz_init(t);
+    max_bc = (k+1) / 2;
+
+    bc = _fmpz_vec_init(max_bc + 1);
+    fmpz_one(bc);
+    for (j = 1; j <= max_bc; j++)
+    {
+        fmpz_set(bc+j, bc+j-1);
+        fmpz_mul_ui(bc+j, bc+j, k+1-j);
+        fmpz_divexact_ui(bc+j, bc+j, j);
+    }
+
+    num_threads = (k >= STIRLING2_THREADED_CUTOFF) ?
+        FLINT_MIN(flint_get_num_threads(), (k + 1) / 2) : 1;
+
+    /* Interleave the odd j so that every thread gets a similar share
+       of large powers; each thread keeps its own partial sum */
+    args = flint_malloc(sizeof(stirling2_powsum_arg_t) * num_threads);
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        fmpz_init(args[i].s);
+        args[i].bc = bc;
+        args[i].n = n;
+        args[i].k = k;
+        args[i].start = 2*i + 1;
+        args[i].step = 2*num_threads;
+    }
+
+    for (i = 1; i < num_threads; i++)
+        pthread_create(&threads[i], NULL, _stirling2_powsum_worker, &args[i]);
+
+    _stirling2_powsum_range(&args[0]);
+
+    for (i = 1; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    fmpz_swap(s, args[0].s);
+    fmpz_clear(args[0].s);
+    for (i = 1; i < num_threads; i++)
+    {
+        fmpz_add(s, s, args[i].s);
+        fmpz_clear(args[i].s);
+    }
+
+    flint_free(args);
+    flint_free(threads);
+
     _fmpz_vec_clear(bc, max_bc + 1);
     fmpz_fac_ui(t, k);
     fmpz_divexact(s, s, t);
     fmpz_clear(t);
-    fmpz_clear(u);
 }
 
 void
@@ -111,6 +111,34 @@ int main(void)
         _fmpz_vec_clear(b2, n+1);
     }
 
+    /* Binary splitting with several threads */
+    for (k = 0; k < 2 * flint_test_multiplier(); k++)
+    {
+        fmpz_t u, v;
+
+        fmpz_init(u);
+        fmpz_init(v);
+
+        n = 1000 + n_randint(state, 2000);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+        arith_bell_number_bsplit(u, n);
+        flint_set_num_threads(1);
+        arith_bell_number_multi_mod(v, n);
+
+        if (!fmpz_equal(u, v))
+        {
+            flint_printf("FAIL (bsplit):\n");
+            flint_printf("n = %wd\n", n);
+            abort();
+        }
+
+        fmpz_clear(u);
+        fmpz_clear(v);
+    }
+
+    flint_set_num_threads(1);
+
     _fmpz_vec_clear(b1, maxn);
 
     FLINT_TEST_CLEANUP(state);
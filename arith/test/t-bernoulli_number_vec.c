@@ -62,7 +62,9 @@ int main()
     for (n = 0; n < N; n += (n<100) ? 1 : n/3)
     {
         _arith_bernoulli_number_vec_recursive(num1, den1, n);
+        flint_set_num_threads(1 + n_randint(state, 4));
         _arith_bernoulli_number_vec_multi_mod(num2, den2, n);
+        flint_set_num_threads(1);
         _arith_bernoulli_number_vec_zeta(num3, den3, n);
 
         for (i = 0; i < n; i++)
@@ -138,6 +138,7 @@ int main(void)
 
     for (i = 0; testdata[i][0] != 0; i++)
     {
+        flint_set_num_threads(1 + n_randint(state, 4));
         arith_number_of_partitions(p, testdata[i][0]);
 
         if (fmpz_fdiv_ui(p, 1000000000) != testdata[i][1])
@@ -152,6 +153,7 @@ int main(void)
     }
 
     fmpz_clear(p);
+    flint_set_num_threads(1);
 
     FLINT_TEST_CLEANUP(state);
     
@@ -36,7 +36,7 @@
 
 int main(void)
 {
-    fmpz * p;
+    fmpz * p, * q;
     mp_ptr pmod;
     slong k, n;
 
@@ -48,6 +48,7 @@ int main(void)
     fflush(stdout);
     
     p = _fmpz_vec_init(maxn);
+    q = _fmpz_vec_init(maxn);
     pmod = _nmod_vec_init(maxn);
 
     for (n = 0; n < maxn; n += (n < 50) ? + 1 : n/4)
@@ -59,6 +60,17 @@ int main(void)
         arith_number_of_partitions_vec(p, n);
         arith_number_of_partitions_nmod_vec(pmod, n, mod);
 
+        flint_set_num_threads(1 + n_randint(state, 4));
+        arith_number_of_partitions_vec_multi_mod(q, n);
+        flint_set_num_threads(1);
+
+        if (!_fmpz_vec_equal(p, q, n))
+        {
+            flint_printf("FAIL (multi_mod):\n");
+            flint_printf("n = %wd\n", n);
+            abort();
+        }
+
         for (k = 0; k < n; k++)
         {
             if (fmpz_fdiv_ui(p + k, mod.n) != pmod[k])
@@ -111,6 +123,7 @@ int main(void)
     }
 
     _fmpz_vec_clear(p, maxn);
+    _fmpz_vec_clear(q, maxn);
     _nmod_vec_clear(pmod);
 
     FLINT_TEST_CLEANUP(state);
@@ -207,6 +207,45 @@ int main(void)
         fmpz_mat_clear(mat3);
     }
 
+    /* Large arguments, computed with several threads */
+    for (mm = 0; mm < 10 * flint_test_multiplier(); mm++)
+    {
+        n = 256 + n_randint(state, 512);
+        k = n_randint(state, n + 1);
+
+        row = _fmpz_vec_init(n + 1);
+
+        flint_set_num_threads(1);
+        arith_stirling_number_1u_vec(row, n, n + 1);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+        arith_stirling_number_1u(s, n, k);
+
+        if (!fmpz_equal(s, row + k))
+        {
+            flint_printf("stirling1u mismatch: %wd, %wd (threads = %wd)\n",
+                n, k, flint_get_num_threads());
+            abort();
+        }
+
+        flint_set_num_threads(1);
+        arith_stirling_number_2_vec(row, n, n + 1);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+        arith_stirling_number_2(s, n, k);
+
+        if (!fmpz_equal(s, row + k))
+        {
+            flint_printf("stirling2 mismatch: %wd, %wd (threads = %wd)\n",
+                n, k, flint_get_num_threads());
+            abort();
+        }
+
+        _fmpz_vec_clear(row, n + 1);
+    }
+
+    flint_set_num_threads(1);
+
     fmpz_clear(s);
 
     FLINT_TEST_CLEANUP(state);
@@ -43,6 +43,9 @@ static char * docsin[] = {
     "../../fmpz_poly_mat/doc/fmpz_poly_mat.txt", 
     "../../nmod_vec/doc/nmod_vec.txt",
     "../../nmod_mat/doc/nmod_mat.txt",
+    "../../gf2_mat/doc/gf2_mat.txt",
+    "../../nmod_sparse_mat/doc/nmod_sparse_mat.txt",
+    "../../fmpz_sparse_mat/doc/fmpz_sparse_mat.txt",
     "../../nmod_poly/doc/nmod_poly.txt",
     "../../nmod_poly_factor/doc/nmod_poly_factor.txt",
     "../../nmod_poly_mat/doc/nmod_poly_mat.txt",
@@ -68,6 +71,8 @@ static char * docsin[] = {
     "../../padic_mat/doc/padic_mat.txt", 
     "../../padic_poly/doc/padic_poly.txt", 
     "../../qadic/doc/qadic.txt", 
+    "../../padic_nmod/doc/padic_nmod.txt", 
+    "../../qadic_nmod/doc/qadic_nmod.txt", 
     "../../arith/doc/arith.txt", 
     "../../ulong_extras/doc/ulong_extras.txt",
     "../../long_extras/doc/long_extras.txt",
@@ -96,6 +101,9 @@ static char * docsout[] = {
     "input/fmpz_poly_mat.tex", 
     "input/nmod_vec.tex",
     "input/nmod_mat.tex",
+    "input/gf2_mat.tex",
+    "input/nmod_sparse_mat.tex",
+    "input/fmpz_sparse_mat.tex",
     "input/nmod_poly.tex",
     "input/nmod_poly_factor.tex",
     "input/nmod_poly_mat.tex",
@@ -121,6 +129,8 @@ static char * docsout[] = {
     "input/padic_mat.tex", 
     "input/padic_poly.tex", 
     "input/qadic.tex", 
+    "input/padic_nmod.tex", 
+    "input/qadic_nmod.tex", 
     "input/arith.tex", 
     "input/ulong_extras.tex",
     "input/long_extras.tex",
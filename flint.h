@@ -102,6 +102,9 @@ FLINT_DLL void flint_free(void * ptr);
 typedef void (*flint_cleanup_function_t)(void);
 FLINT_DLL void flint_register_cleanup_function(flint_cleanup_function_t cleanup_function);
 FLINT_DLL void flint_cleanup(void);
+FLINT_DLL void flint_register_master_cleanup_function(
+                                  flint_cleanup_function_t cleanup_function);
+FLINT_DLL void flint_cleanup_master(void);
 
 #if defined(_WIN64) || defined(__mips64)
 #define WORD_FMT "%ll"
@@ -209,7 +212,7 @@ void flint_randclear(flint_rand_t state)
 
 #define FLINT_TEST_CLEANUP(xxx) \
    flint_randclear(xxx); \
-   flint_cleanup();
+   flint_cleanup_master();
 
 /*
   We define this here as there is no mpfr.h
@@ -23,6 +23,7 @@
 
 ******************************************************************************/
 
+#include "fmpz_vec.h"
 #include "fmpq.h"
 
 #if FLINT_BITS == 64
@@ -216,33 +217,52 @@ harmonic_odd_direct(fmpz_t P, fmpz_t Q, ulong a, ulong b, ulong n, int d)
     }
 }
 
+/*
+    The engine in fmpz_bsplit splits [a, b) at the same midpoints as the
+    recursion above, so the d belonging to a subinterval is recovered by
+    walking down the chain of intervals [1, b_t) that start at 1.
+ */
+
 static void
-harmonic_odd_balanced(fmpz_t P, fmpz_t Q, ulong a, ulong b, ulong n, int d)
+harmonic_odd_basecase(fmpz * PQ, ulong a, ulong b, void * args)
 {
-    if (b - a < 50)
+    ulong n = *((const ulong *) args);
+    ulong bt = n + 1;
+    int d = 1;
+
+    while (bt != b && a < 1 + (bt - 1) / 2)
     {
-        harmonic_odd_direct(P, Q, a, b, n, d);
+        bt = 1 + (bt - 1) / 2;
+        d++;
     }
-    else
-    {
-        ulong m;
-        fmpz_t R, S;
 
-        fmpz_init(R);
-        fmpz_init(S);
+    harmonic_odd_direct(PQ, PQ + 1, a, b, n, d);
+}
 
-        m = a + (b - a) / 2;
+static void
+harmonic_odd_merge(fmpz * left, fmpz * right, void * args)
+{
+    fmpz_t t;
+
+    fmpz_init(t);
+    fmpz_mul_fft(t, left + 1, right);
+    fmpz_mul_fft(left, left, right + 1);
+    fmpz_add(left, left, t);
+    fmpz_mul_fft(left + 1, left + 1, right + 1);
+    fmpz_clear(t);
+}
 
-        harmonic_odd_balanced(P, Q, a, m, n, d + (a==1));
-        harmonic_odd_balanced(R, S, m, b, n, d);
+static void
+harmonic_odd_balanced(fmpz_t P, fmpz_t Q, ulong n)
+{
+    fmpz * PQ = _fmpz_vec_init(2);
 
-        fmpz_mul(P, P, S);
-        fmpz_addmul(P, Q, R);
-        fmpz_mul(Q, Q, S);
+    fmpz_bsplit(PQ, 2, 1, n + 1, 50,
+        harmonic_odd_basecase, harmonic_odd_merge, &n);
 
-        fmpz_clear(R);
-        fmpz_clear(S);
-    }
+    fmpz_swap(P, PQ);
+    fmpz_swap(Q, PQ + 1);
+    _fmpz_vec_clear(PQ, 2);
 }
 
 void
@@ -259,7 +279,7 @@ _fmpq_harmonic_ui(fmpz_t num, fmpz_t den, ulong n)
         if ((slong) n < 0)
             abort();
 
-        harmonic_odd_balanced(num, den, 1, n + 1, n, 1);
+        harmonic_odd_balanced(num, den, n);
         _fmpq_canonicalise(num, den);
     }
 }
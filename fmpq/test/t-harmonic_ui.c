@@ -108,6 +108,27 @@ int main(void)
         }
     }
 
+    /* Several threads */
+    for (i = 0; i < 10; i++)
+    {
+        ulong n = 1000 + n_randint(state, 5000);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        mpq_harmonic_balanced(x, 1, n);
+        fmpq_harmonic_ui(t, n);
+        fmpq_get_mpq(y, t);
+
+        if (!mpq_equal(x, y))
+        {
+            flint_printf("FAIL: %wu (threads = %wd)\n", n,
+                flint_get_num_threads());
+            abort();
+        }
+    }
+
+    flint_set_num_threads(1);
+
     numerical_test(t, 1000, 7.4854708605503449127);
     numerical_test(t, 1001, 7.4864698615493459117);
     numerical_test(t, 1002, 7.4874678655413618797);
@@ -718,6 +718,52 @@ FLINT_DLL void _fmpq_poly_revert_series(fmpz * res, fmpz_t den,
 FLINT_DLL void fmpq_poly_revert_series(fmpq_poly_t res, 
                     const fmpq_poly_t poly, slong n);
 
+/*  Multimodular power series  ***********************************************/
+
+typedef void (*fmpq_poly_nmod_series_func_t)(mp_ptr res, mp_srcptr poly,
+                                                    slong n, nmod_t mod);
+
+#define FMPQ_POLY_SERIES_BOUND_GRID 257
+
+#define FMPQ_POLY_EXP_SERIES_MULTI_MOD_CUTOFF 256
+
+#define FMPQ_POLY_LOG_SERIES_MULTI_MOD_CUTOFF 256
+
+#define FMPQ_POLY_REVERT_SERIES_MULTI_MOD_CUTOFF 400
+
+FLINT_DLL double _fmpq_poly_majorant_log2(const fmpz * poly, const fmpz_t den,
+    slong len, double t);
+
+FLINT_DLL double _fmpq_poly_majorant_radius_log2(const fmpz * poly,
+    const fmpz_t den, slong len);
+
+FLINT_DLL double _fmpq_poly_series_bound(const double * a, const double * b,
+    slong num, slong n);
+
+FLINT_DLL void _fmpq_poly_series_lcm_ui(fmpz_t res, ulong n);
+
+FLINT_DLL void _fmpq_poly_series_multi_mod(fmpz * res, const fmpz * poly,
+    const fmpz_t den, slong len, slong n, fmpq_poly_nmod_series_func_t f,
+    const fmpz_t scale, const fmpz_t avoid, mp_bitcnt_t bits);
+
+FLINT_DLL void _fmpq_poly_exp_series_multi_mod(fmpz * g, fmpz_t gden,
+    const fmpz * h, const fmpz_t hden, slong hlen, slong n);
+
+FLINT_DLL void fmpq_poly_exp_series_multi_mod(fmpq_poly_t res,
+    const fmpq_poly_t poly, slong n);
+
+FLINT_DLL void _fmpq_poly_log_series_multi_mod(fmpz * g, fmpz_t gden,
+    const fmpz * f, const fmpz_t fden, slong flen, slong n);
+
+FLINT_DLL void fmpq_poly_log_series_multi_mod(fmpq_poly_t res,
+    const fmpq_poly_t f, slong n);
+
+FLINT_DLL void _fmpq_poly_revert_series_multi_mod(fmpz * Qinv, fmpz_t den,
+    const fmpz * Q, const fmpz_t Qden, slong Qlen, slong n);
+
+FLINT_DLL void fmpq_poly_revert_series_multi_mod(fmpq_poly_t res,
+    const fmpq_poly_t poly, slong n);
+
 /*  Gaussian content  ********************************************************/
 
 FLINT_DLL void _fmpq_poly_content(fmpq_t res, 
@@ -178,6 +178,11 @@ _fmpq_poly_exp_series(fmpz * B, fmpz_t Bden,
     {
         _fmpq_poly_exp_series_basecase(B, Bden, A, Aden, Alen, n);
     }
+    else if (n >= FMPQ_POLY_EXP_SERIES_MULTI_MOD_CUTOFF
+             && flint_get_num_threads() > 1)
+    {
+        _fmpq_poly_exp_series_multi_mod(B, Bden, A, Aden, Alen, n);
+    }
     else
     {
         _fmpq_poly_exp_series_newton(B, Bden, A, Aden, Alen, n);
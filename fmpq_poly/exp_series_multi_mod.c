@@ -0,0 +1,124 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <math.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "nmod_poly.h"
+#include "fmpq_poly.h"
+
+/*
+    The denominator of exp(h / hden) mod x^n divides hden^(n-1) (n-1)!,
+    and by Cauchy's estimate the coefficient of x^k is bounded by 
+    exp(M(r)) / r^k, where M(r) is the majorant \sum |h_j / hden| r^j.
+ */
+
+void
+_fmpq_poly_exp_series_multi_mod(fmpz * g, fmpz_t gden,
+    const fmpz * h, const fmpz_t hden, slong hlen, slong n)
+{
+    double a[FMPQ_POLY_SERIES_BOUND_GRID], b[FMPQ_POLY_SERIES_BOUND_GRID];
+    double t, t0, L;
+    fmpz_t c, D;
+    slong i;
+    mp_bitcnt_t bits;
+
+    hlen = FLINT_MIN(hlen, n);
+
+    fmpz_init(c);
+    fmpz_init(D);
+    fmpz_fac_ui(D, n - 1);
+    fmpz_pow_ui(c, hden, n - 1);
+    fmpz_mul(D, D, c);
+    fmpz_clear(c);
+
+    t0 = _fmpq_poly_majorant_radius_log2(h, hden, hlen);
+
+    for (i = 0; i < FMPQ_POLY_SERIES_BOUND_GRID; i++)
+    {
+        t = t0 + (i - FMPQ_POLY_SERIES_BOUND_GRID / 2) * 0.25;
+        L = _fmpq_poly_majorant_log2(h, hden, hlen, t);
+
+        a[i] = (L < 60.0) ? pow(2.0, L) / log(2.0) : HUGE_VAL;
+        b[i] = -t;
+    }
+
+    bits = fmpz_bits(D)
+        + (mp_bitcnt_t) _fmpq_poly_series_bound(a, b,
+            FMPQ_POLY_SERIES_BOUND_GRID, n) + 2;
+
+    _fmpq_poly_series_multi_mod(g, h, hden, hlen, n,
+        _nmod_poly_exp_series, D, hden, bits);
+
+    fmpz_swap(gden, D);
+    fmpz_clear(D);
+
+    _fmpq_poly_canonicalise(g, gden, n);
+}
+
+void
+fmpq_poly_exp_series_multi_mod(fmpq_poly_t res, const fmpq_poly_t poly,
+    slong n)
+{
+    if (n == 0)
+    {
+        fmpq_poly_zero(res);
+        return;
+    }
+
+    if (poly->length == 0 || n == 1)
+    {
+        fmpq_poly_one(res);
+        return;
+    }
+
+    if (!fmpz_is_zero(poly->coeffs))
+    {
+        flint_printf("Exception (fmpq_poly_exp_series_multi_mod). "
+            "Constant term != 0.\n");
+        abort();
+    }
+
+    if (res != poly)
+    {
+        fmpq_poly_fit_length(res, n);
+        _fmpq_poly_exp_series_multi_mod(res->coeffs, res->den,
+            poly->coeffs, poly->den, poly->length, n);
+    }
+    else
+    {
+        fmpq_poly_t t;
+        fmpq_poly_init2(t, n);
+        _fmpq_poly_exp_series_multi_mod(t->coeffs, t->den,
+            poly->coeffs, poly->den, poly->length, n);
+        fmpq_poly_swap(res, t);
+        fmpq_poly_clear(t);
+    }
+
+    _fmpq_poly_set_length(res, n);
+    _fmpq_poly_normalise(res);
+}
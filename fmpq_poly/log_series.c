@@ -39,6 +39,13 @@ void _fmpq_poly_log_series(fmpz * g, fmpz_t gden,
 
     flen = FLINT_MIN(flen, n);
 
+    if (n >= FMPQ_POLY_LOG_SERIES_MULTI_MOD_CUTOFF
+        && flint_get_num_threads() >= 4)
+    {
+        _fmpq_poly_log_series_multi_mod(g, gden, f, fden, flen, n);
+        return;
+    }
+
     f_diff = _fmpz_vec_init(flen - 1);
     f_inv = _fmpz_vec_init(n);
     fmpz_init(f_diff_den);
@@ -0,0 +1,134 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <math.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "nmod_poly.h"
+#include "fmpq_poly.h"
+
+/*
+    Writing f / fden = 1 + u, the coefficient of x^k in log(1 + u) has 
+    denominator dividing k fden^k, and is bounded by -log(1 - M(r)) / r^k 
+    whenever the majorant M(r) = \sum |f_j / fden| r^j is less than 1.
+ */
+
+void
+_fmpq_poly_log_series_multi_mod(fmpz * g, fmpz_t gden,
+    const fmpz * f, const fmpz_t fden, slong flen, slong n)
+{
+    double a[FMPQ_POLY_SERIES_BOUND_GRID], b[FMPQ_POLY_SERIES_BOUND_GRID];
+    double t, t0, L, M;
+    fmpz_t c, D;
+    slong i;
+    mp_bitcnt_t bits;
+
+    flen = FLINT_MIN(flen, n);
+
+    fmpz_init(c);
+    fmpz_init(D);
+    _fmpq_poly_series_lcm_ui(D, n - 1);
+    fmpz_pow_ui(c, fden, n - 1);
+    fmpz_mul(D, D, c);
+    fmpz_clear(c);
+
+    t0 = _fmpq_poly_majorant_radius_log2(f, fden, flen);
+
+    for (i = 0; i < FMPQ_POLY_SERIES_BOUND_GRID; i++)
+    {
+        t = t0 + (i - FMPQ_POLY_SERIES_BOUND_GRID / 2) * 0.25;
+        L = _fmpq_poly_majorant_log2(f, fden, flen, t);
+
+        if (L == -HUGE_VAL)
+        {
+            a[i] = -HUGE_VAL;
+        }
+        else if (L < -30.0)
+        {
+            /* -log(1 - M) <= M (1 + M), avoiding underflow in 2^L */
+            a[i] = L + 1e-6;
+        }
+        else if (L < -0.01)
+        {
+            M = -log(1.0 - pow(2.0, L));
+            a[i] = log(M) / log(2.0);
+        }
+        else
+        {
+            a[i] = HUGE_VAL;
+        }
+        b[i] = -t;
+    }
+
+    bits = fmpz_bits(D)
+        + (mp_bitcnt_t) _fmpq_poly_series_bound(a, b,
+            FMPQ_POLY_SERIES_BOUND_GRID, n) + 2;
+
+    _fmpq_poly_series_multi_mod(g, f, fden, flen, n,
+        _nmod_poly_log_series, D, fden, bits);
+
+    fmpz_swap(gden, D);
+    fmpz_clear(D);
+
+    _fmpq_poly_canonicalise(g, gden, n);
+}
+
+void
+fmpq_poly_log_series_multi_mod(fmpq_poly_t res, const fmpq_poly_t f, slong n)
+{
+    if (f->length < 1 || !fmpz_equal(f->coeffs, f->den))
+    {
+        flint_printf("Exception (fmpq_poly_log_series_multi_mod). "
+            "Constant term != 1.\n");
+        abort();
+    }
+
+    if (f->length == 1 || n < 2)
+    {
+        fmpq_poly_zero(res);
+        return;
+    }
+
+    if (res != f)
+    {
+        fmpq_poly_fit_length(res, n);
+        _fmpq_poly_log_series_multi_mod(res->coeffs, res->den,
+            f->coeffs, f->den, f->length, n);
+    }
+    else
+    {
+        fmpq_poly_t t;
+        fmpq_poly_init2(t, n);
+        _fmpq_poly_log_series_multi_mod(t->coeffs, t->den,
+            f->coeffs, f->den, f->length, n);
+        fmpq_poly_swap(res, t);
+        fmpq_poly_clear(t);
+    }
+
+    _fmpq_poly_set_length(res, n);
+    _fmpq_poly_normalise(res);
+}
@@ -41,7 +41,12 @@ _fmpq_poly_revert_series(fmpz * Qinv, fmpz_t den,
         return;
     }
 
-    _fmpq_poly_revert_series_lagrange_fast(Qinv, den, Q, Qden, Qlen, n);
+    if (n >= FMPQ_POLY_REVERT_SERIES_MULTI_MOD_CUTOFF
+        || (n >= FMPQ_POLY_REVERT_SERIES_MULTI_MOD_CUTOFF / 4
+            && flint_get_num_threads() > 1))
+        _fmpq_poly_revert_series_multi_mod(Qinv, den, Q, Qden, Qlen, n);
+    else
+        _fmpq_poly_revert_series_lagrange_fast(Qinv, den, Q, Qden, Qlen, n);
 }
 
 void
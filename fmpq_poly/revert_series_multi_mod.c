@@ -0,0 +1,135 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <math.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "nmod_poly.h"
+#include "fmpq_poly.h"
+
+/*
+    Write Q / Qden = (Q_1 / Qden) x (1 + v).  By Lagrange inversion, 
+    k Qinv_k = (Qden / Q_1)^k [x^(k-1)] (1 + v)^(-k), so the denominator 
+    of Qinv_k divides k Q_1^(2k-1), and if the majorant 
+    M(r) = \sum |Q_(j+1) / Q_1| r^j is less than 1 then 
+    |Qinv_k| <= |Qden / Q_1|^k (1 - M(r))^(-k) r^(1-k).
+ */
+
+void
+_fmpq_poly_revert_series_multi_mod(fmpz * Qinv, fmpz_t den,
+    const fmpz * Q, const fmpz_t Qden, slong Qlen, slong n)
+{
+    double a[FMPQ_POLY_SERIES_BOUND_GRID], b[FMPQ_POLY_SERIES_BOUND_GRID];
+    double t, t0, L, M, c;
+    fmpz_t u, D;
+    slong i;
+    mp_bitcnt_t bits;
+
+    Qlen = FLINT_MIN(Qlen, n);
+
+    fmpz_init(u);
+    fmpz_init(D);
+    _fmpq_poly_series_lcm_ui(D, n - 1);
+    fmpz_abs(u, Q + 1);
+    fmpz_pow_ui(u, u, 2 * n - 3);
+    fmpz_mul(D, D, u);
+
+    c = (double) fmpz_bits(Qden) - (fmpz_bits(Q + 1) - 1);
+    t0 = _fmpq_poly_majorant_radius_log2(Q + 1, Q + 1, Qlen - 1);
+
+    for (i = 0; i < FMPQ_POLY_SERIES_BOUND_GRID; i++)
+    {
+        t = t0 + (i - FMPQ_POLY_SERIES_BOUND_GRID / 2) * 0.25;
+        L = _fmpq_poly_majorant_log2(Q + 1, Q + 1, Qlen - 1, t);
+
+        if (L < -0.01)
+        {
+            /* -log(1 - M) <= M (1 + M) */
+            M = pow(2.0, L);
+            M = (M < 1e-8) ? M * (1.0 + M) : -log(1.0 - M);
+            a[i] = t;
+            b[i] = c + M / log(2.0) - t;
+        }
+        else
+        {
+            a[i] = HUGE_VAL;
+            b[i] = 0.0;
+        }
+    }
+
+    bits = fmpz_bits(D)
+        + (mp_bitcnt_t) _fmpq_poly_series_bound(a, b,
+            FMPQ_POLY_SERIES_BOUND_GRID, n) + 2;
+
+    fmpz_mul(u, Qden, Q + 1);
+    _fmpq_poly_series_multi_mod(Qinv, Q, Qden, Qlen, n,
+        _nmod_poly_revert_series, D, u, bits);
+    fmpz_clear(u);
+
+    fmpz_swap(den, D);
+    fmpz_clear(D);
+
+    _fmpq_poly_canonicalise(Qinv, den, n);
+}
+
+void
+fmpq_poly_revert_series_multi_mod(fmpq_poly_t res,
+            const fmpq_poly_t poly, slong n)
+{
+    if (poly->length < 2 || !fmpz_is_zero(poly->coeffs)
+                         || fmpz_is_zero(poly->coeffs + 1))
+    {
+        flint_printf("Exception (fmpq_poly_revert_series_multi_mod). Input must \n"
+               "have zero constant term and nonzero coefficient of x^1.\n");
+        abort();
+    }
+
+    if (n < 2)
+    {
+        fmpq_poly_zero(res);
+        return;
+    }
+
+    if (res != poly)
+    {
+        fmpq_poly_fit_length(res, n);
+        _fmpq_poly_revert_series_multi_mod(res->coeffs,
+                res->den, poly->coeffs, poly->den, poly->length, n);
+    }
+    else
+    {
+        fmpq_poly_t t;
+        fmpq_poly_init2(t, n);
+        _fmpq_poly_revert_series_multi_mod(t->coeffs,
+                t->den, poly->coeffs, poly->den, poly->length, n);
+        fmpq_poly_swap(res, t);
+        fmpq_poly_clear(t);
+    }
+
+    _fmpq_poly_set_length(res, n);
+    _fmpq_poly_normalise(res);
+}
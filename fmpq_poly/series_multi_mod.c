@@ -0,0 +1,344 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <math.h>
+#include <pthread.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "fmpq_poly.h"
+#include "ulong_extras.h"
+
+static double
+_fmpz_abs_log2(const fmpz_t x)
+{
+    slong e;
+    double m = fmpz_get_d_2exp(&e, x);
+
+    return log(fabs(m)) / log(2.0) + e;
+}
+
+double
+_fmpq_poly_majorant_log2(const fmpz * poly, const fmpz_t den,
+    slong len, double t)
+{
+    double * c, m, s;
+    slong j;
+
+    c = flint_malloc(FLINT_MAX(len, 1) * sizeof(double));
+    m = -HUGE_VAL;
+
+    for (j = 1; j < len; j++)
+    {
+        if (fmpz_is_zero(poly + j))
+            c[j] = -HUGE_VAL;
+        else
+            c[j] = _fmpz_abs_log2(poly + j) + t * j;
+
+        m = FLINT_MAX(m, c[j]);
+    }
+
+    if (m != -HUGE_VAL)
+    {
+        s = 0.0;
+        for (j = 1; j < len; j++)
+            if (c[j] != -HUGE_VAL)
+                s += pow(2.0, c[j] - m);
+
+        m += log(s) / log(2.0) - _fmpz_abs_log2(den);
+    }
+
+    flint_free(c);
+
+    return m;
+}
+
+double
+_fmpq_poly_majorant_radius_log2(const fmpz * poly, const fmpz_t den,
+    slong len)
+{
+    double c, m = 0.0;
+    slong j;
+
+    for (j = 1; j < len; j++)
+    {
+        if (!fmpz_is_zero(poly + j))
+        {
+            c = (_fmpz_abs_log2(poly + j) - _fmpz_abs_log2(den)) / j;
+            m = FLINT_MAX(m, c);
+        }
+    }
+
+    return -m;
+}
+
+double
+_fmpq_poly_series_bound(const double * a, const double * b, slong num, slong n)
+{
+    double c, m, r = 0.0;
+    slong i, k;
+
+    for (k = 0; k < n; k++)
+    {
+        m = HUGE_VAL;
+        for (i = 0; i < num; i++)
+        {
+            c = a[i] + k * b[i];
+            m = FLINT_MIN(m, c);
+        }
+        r = FLINT_MAX(r, m);
+    }
+
+    return r;
+}
+
+void
+_fmpq_poly_series_lcm_ui(fmpz_t res, ulong n)
+{
+    n_primes_t iter;
+    mp_ptr v;
+    mp_limb_t p, q;
+    slong len = 0;
+
+    v = flint_malloc((n / 2 + 1) * sizeof(mp_limb_t));
+
+    n_primes_init(iter);
+    while ((p = n_primes_next(iter)) <= n)
+    {
+        for (q = p; q <= n / p; q *= p) ;
+        v[len++] = q;
+    }
+    n_primes_clear(iter);
+
+    _fmpz_ui_vec_prod(res, v, len);
+
+    flint_free(v);
+}
+
+typedef struct
+{
+    mp_ptr * res;
+    mp_srcptr primes;
+    const fmpz * poly;
+    const fmpz * den;
+    const fmpz * scale;
+    slong len;
+    slong n;
+    fmpq_poly_nmod_series_func_t f;
+    slong k0;
+    slong k1;
+}
+series_mod_arg_t;
+
+static void
+_series_mod_p_range(series_mod_arg_t * arg)
+{
+    mp_ptr t;
+    mp_limb_t c;
+    nmod_t mod;
+    slong j, k;
+
+    t = _nmod_vec_init(arg->n);
+
+    for (k = arg->k0; k < arg->k1; k++)
+    {
+        nmod_init(&mod, arg->primes[k]);
+
+        c = n_invmod(fmpz_fdiv_ui(arg->den, mod.n), mod.n);
+        for (j = 0; j < arg->len; j++)
+            t[j] = nmod_mul(fmpz_fdiv_ui(arg->poly + j, mod.n), c, mod);
+        _nmod_vec_zero(t + arg->len, arg->n - arg->len);
+
+        arg->f(arg->res[k], t, arg->n, mod);
+
+        c = fmpz_fdiv_ui(arg->scale, mod.n);
+        _nmod_vec_scalar_mul_nmod(arg->res[k], arg->res[k], arg->n, c, mod);
+    }
+
+    _nmod_vec_clear(t);
+}
+
+static void *
+_series_mod_p_worker(void * arg_ptr)
+{
+    _series_mod_p_range((series_mod_arg_t *) arg_ptr);
+    flint_cleanup();
+    return NULL;
+}
+
+typedef struct
+{
+    fmpz * res;
+    mp_ptr * polys;
+    const fmpz_comb_struct * comb;
+    slong num_primes;
+    slong n;
+    slong start;
+    slong step;
+}
+series_crt_arg_t;
+
+static void
+_series_crt_range(series_crt_arg_t * arg)
+{
+    fmpz_comb_temp_t temp;
+    mp_ptr residues;
+    slong j, k;
+
+    residues = flint_malloc(arg->num_primes * sizeof(mp_limb_t));
+    fmpz_comb_temp_init(temp, arg->comb);
+
+    for (j = arg->start; j < arg->n; j += arg->step)
+    {
+        for (k = 0; k < arg->num_primes; k++)
+            residues[k] = arg->polys[k][j];
+        fmpz_multi_CRT_ui(arg->res + j, residues, arg->comb, temp, 1);
+    }
+
+    fmpz_comb_temp_clear(temp);
+    flint_free(residues);
+}
+
+static void *
+_series_crt_worker(void * arg_ptr)
+{
+    _series_crt_range((series_crt_arg_t *) arg_ptr);
+    flint_cleanup();
+    return NULL;
+}
+
+/*
+    The images modulo the individual primes are computed independently,
+    in parallel when several threads are available, and so are the 
+    reconstructions of the coefficients.
+ */
+
+void
+_fmpq_poly_series_multi_mod(fmpz * res, const fmpz * poly, const fmpz_t den,
+    slong len, slong n, fmpq_poly_nmod_series_func_t f,
+    const fmpz_t scale, const fmpz_t avoid, mp_bitcnt_t bits)
+{
+    fmpz_comb_t comb;
+    mp_ptr primes, * polys;
+    mp_limb_t p;
+    slong i, k, num_primes, num_threads;
+    mp_bitcnt_t prime_bits = FLINT_BITS - 1;
+    pthread_t * threads;
+
+    len = FLINT_MIN(len, n);
+
+    /* One extra bit for the sign */
+    num_primes = (bits + 1) / prime_bits + 1;
+
+    primes = flint_malloc(num_primes * sizeof(mp_limb_t));
+    polys = flint_malloc(num_primes * sizeof(mp_ptr));
+
+    p = UWORD(1) << prime_bits;
+    for (k = 0; k < num_primes; k++)
+    {
+        do {
+            p = n_nextprime(p, 0);
+        } while (fmpz_fdiv_ui(avoid, p) == 0);
+
+        primes[k] = p;
+        polys[k] = _nmod_vec_init(n);
+    }
+
+    threads = flint_malloc(sizeof(pthread_t) * flint_get_num_threads());
+
+    num_threads = FLINT_MAX(1, FLINT_MIN(flint_get_num_threads(), num_primes));
+
+    {
+        series_mod_arg_t * args;
+
+        args = flint_malloc(sizeof(series_mod_arg_t) * num_threads);
+
+        for (i = 0; i < num_threads; i++)
+        {
+            args[i].res = polys;
+            args[i].primes = primes;
+            args[i].poly = poly;
+            args[i].den = den;
+            args[i].scale = scale;
+            args[i].len = len;
+            args[i].n = n;
+            args[i].f = f;
+            args[i].k0 = (i * num_primes) / num_threads;
+            args[i].k1 = ((i + 1) * num_primes) / num_threads;
+        }
+
+        for (i = 1; i < num_threads; i++)
+            pthread_create(&threads[i], NULL, _series_mod_p_worker, &args[i]);
+
+        _series_mod_p_range(&args[0]);
+
+        for (i = 1; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
+
+        flint_free(args);
+    }
+
+    fmpz_comb_init(comb, primes, num_primes);
+
+    {
+        series_crt_arg_t * args;
+
+        num_threads = FLINT_MAX(1, FLINT_MIN(flint_get_num_threads(), n));
+        args = flint_malloc(sizeof(series_crt_arg_t) * num_threads);
+
+        for (i = 0; i < num_threads; i++)
+        {
+            args[i].res = res;
+            args[i].polys = polys;
+            args[i].comb = comb;
+            args[i].num_primes = num_primes;
+            args[i].n = n;
+            args[i].start = i;
+            args[i].step = num_threads;
+        }
+
+        for (i = 1; i < num_threads; i++)
+            pthread_create(&threads[i], NULL, _series_crt_worker, &args[i]);
+
+        _series_crt_range(&args[0]);
+
+        for (i = 1; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
+
+        flint_free(args);
+    }
+
+    fmpz_comb_clear(comb);
+
+    for (k = 0; k < num_primes; k++)
+        _nmod_vec_clear(polys[k]);
+
+    flint_free(threads);
+    flint_free(primes);
+    flint_free(polys);
+}
@@ -280,6 +280,8 @@ FLINT_DLL double fmpz_get_d(const fmpz_t f);
 
 FLINT_DLL void fmpz_set_d(fmpz_t f, double c);
 
+FLINT_DLL void fmpz_set_d_2exp(fmpz_t f, double m, slong exp);
+
 FLINT_DLL void fmpz_get_mpf(mpf_t x, const fmpz_t f);
 
 FLINT_DLL void fmpz_set_mpf(fmpz_t f, const mpf_t x);
@@ -442,6 +444,10 @@ FLINT_DLL void fmpz_mul_si(fmpz_t f, const fmpz_t g, slong x);
 
 FLINT_DLL void fmpz_mul(fmpz_t f, const fmpz_t g, const fmpz_t h);
 
+#define FMPZ_MUL_FFT_CUTOFF 4096
+
+FLINT_DLL void fmpz_mul_fft(fmpz_t f, const fmpz_t g, const fmpz_t h);
+
 FLINT_DLL void fmpz_mul_2exp(fmpz_t f, const fmpz_t g, ulong exp);
 
 FLINT_DLL void fmpz_add_ui(fmpz_t f, const fmpz_t g, ulong x);
@@ -623,10 +629,14 @@ FLINT_DLL void fmpz_mul_tdiv_q_2exp(fmpz_t f, const fmpz_t g, const fmpz_t h, ul
 
 FLINT_DLL void fmpz_mul_si_tdiv_q_2exp(fmpz_t f, const fmpz_t g, slong x, ulong exp);
 
+#define FMPZ_FAC_UI_SWING_CUTOFF 20000
+
 FLINT_DLL void fmpz_fac_ui(fmpz_t f, ulong n);
 
 FLINT_DLL void fmpz_fib_ui(fmpz_t f, ulong n);
 
+#define FMPZ_BIN_UIUI_PRIME_CUTOFF 10000
+
 FLINT_DLL void fmpz_bin_uiui(fmpz_t res, ulong n, ulong k);
 
 FLINT_DLL void _fmpz_rfac_ui(fmpz_t r, const fmpz_t x, ulong a, ulong b);
@@ -635,6 +645,19 @@ FLINT_DLL void fmpz_rfac_ui(fmpz_t r, const fmpz_t x, ulong n);
 
 FLINT_DLL void fmpz_rfac_uiui(fmpz_t r, ulong x, ulong n);
 
+FLINT_DLL void _fmpz_ui_vec_prod(fmpz_t res, mp_srcptr v, slong len);
+
+/* Binary splitting  *********************************************************/
+
+typedef void (*fmpz_bsplit_basecase_t)(fmpz * res, ulong a, ulong b, void * args);
+
+typedef void (*fmpz_bsplit_merge_t)(fmpz * left, fmpz * right, void * args);
+
+#define FMPZ_BSPLIT_THREADED_CUTOFF 1024
+
+FLINT_DLL void fmpz_bsplit(fmpz * res, slong len, ulong a, ulong b, ulong cutoff,
+    fmpz_bsplit_basecase_t basecase, fmpz_bsplit_merge_t merge, void * args);
+
 FLINT_DLL int fmpz_bit_pack(mp_ptr arr, mp_bitcnt_t shift, mp_bitcnt_t bits, 
                   const fmpz_t coeff, int negate, int borrow);
 
@@ -29,11 +29,90 @@
 #include "flint.h"
 #include "ulong_extras.h"
 #include "fmpz.h"
+#include "longlong.h"
+
+/*
+    Computes the binomial coefficient from its prime factorisation, the 
+    exponent of p being the number of borrows when subtracting k from n 
+    in base p (Kummer).  The prime powers are packed into limbs and 
+    multiplied by _fmpz_ui_vec_prod, which runs in parallel.
+ */
+
+static void
+_fmpz_bin_uiui_prime(fmpz_t res, ulong n, ulong k)
+{
+    n_primes_t iter;
+    mp_ptr v;
+    mp_limb_t p, acc, hi, lo;
+    slong len, alloc;
+
+    alloc = 1024;
+    v = flint_malloc(alloc * sizeof(mp_limb_t));
+    len = 0;
+    acc = 1;
+
+    n_primes_init(iter);
+
+    while ((p = n_primes_next(iter)) <= n)
+    {
+        ulong a = n, b = k;
+        int borrow = 0;
+
+        /* Number of borrows in the base-p subtraction n - k */
+        while (a > 0)
+        {
+            borrow = (b % p + borrow > a % p);
+            a /= p;
+            b /= p;
+
+            if (borrow)
+            {
+                umul_ppmm(hi, lo, acc, p);
+                if (hi != 0)
+                {
+                    if (len == alloc)
+                    {
+                        alloc *= 2;
+                        v = flint_realloc(v, alloc * sizeof(mp_limb_t));
+                    }
+                    v[len++] = acc;
+                    acc = p;
+                }
+                else
+                    acc = lo;
+            }
+
+            if (p > n / p && !borrow)
+                break;
+        }
+    }
+
+    n_primes_clear(iter);
+
+    if (len == alloc)
+        v = flint_realloc(v, (alloc + 1) * sizeof(mp_limb_t));
+    v[len++] = acc;
+
+    _fmpz_ui_vec_prod(res, v, len);
+
+    flint_free(v);
+}
 
-/* TODO: speedup for small n,k */
 void fmpz_bin_uiui(fmpz_t res, ulong n, ulong k)
 {
-    __mpz_struct * t = _fmpz_promote(res);
-    flint_mpz_bin_uiui(t, n, k);
-    _fmpz_demote_val(res);
+    if (k > n)
+    {
+        fmpz_zero(res);
+    }
+    else if (FLINT_MIN(k, n - k) < FMPZ_BIN_UIUI_PRIME_CUTOFF
+             || flint_get_num_threads() == 1)
+    {
+        __mpz_struct * t = _fmpz_promote(res);
+        flint_mpz_bin_uiui(t, n, k);
+        _fmpz_demote_val(res);
+    }
+    else
+    {
+        _fmpz_bin_uiui_prime(res, n, k);
+    }
 }
@@ -0,0 +1,121 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <pthread.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+
+typedef struct
+{
+    fmpz * res;
+    slong len;
+    ulong a;
+    ulong b;
+    ulong cutoff;
+    fmpz_bsplit_basecase_t basecase;
+    fmpz_bsplit_merge_t merge;
+    void * args;
+    slong num_threads;
+}
+bsplit_arg_t;
+
+static void _fmpz_bsplit(bsplit_arg_t * arg);
+
+static void *
+_fmpz_bsplit_worker(void * arg_ptr)
+{
+    _fmpz_bsplit((bsplit_arg_t *) arg_ptr);
+    flint_cleanup();
+    return NULL;
+}
+
+/*
+    Splits [a, b) exactly in half.  While more than one thread is 
+    available to a node, its right half is computed by a new thread 
+    and its left half by the current one, so that the independent 
+    subtrees near the root run in parallel.
+ */
+
+static void
+_fmpz_bsplit(bsplit_arg_t * arg)
+{
+    if (arg->b - arg->a < arg->cutoff)
+    {
+        arg->basecase(arg->res, arg->a, arg->b, arg->args);
+    }
+    else
+    {
+        const ulong m = arg->a + (arg->b - arg->a) / 2;
+        bsplit_arg_t left = *arg, right = *arg;
+
+        right.res = _fmpz_vec_init(arg->len);
+        left.b = m;
+        right.a = m;
+
+        if (arg->num_threads > 1 && arg->b - arg->a >= FMPZ_BSPLIT_THREADED_CUTOFF)
+        {
+            pthread_t thread;
+
+            right.num_threads = arg->num_threads / 2;
+            left.num_threads = arg->num_threads - right.num_threads;
+
+            pthread_create(&thread, NULL, _fmpz_bsplit_worker, &right);
+            _fmpz_bsplit(&left);
+            pthread_join(thread, NULL);
+        }
+        else
+        {
+            left.num_threads = right.num_threads = 1;
+
+            _fmpz_bsplit(&left);
+            _fmpz_bsplit(&right);
+        }
+
+        arg->merge(arg->res, right.res, arg->args);
+
+        _fmpz_vec_clear(right.res, arg->len);
+    }
+}
+
+void
+fmpz_bsplit(fmpz * res, slong len, ulong a, ulong b, ulong cutoff,
+    fmpz_bsplit_basecase_t basecase, fmpz_bsplit_merge_t merge, void * args)
+{
+    bsplit_arg_t arg;
+
+    arg.res = res;
+    arg.len = len;
+    arg.a = a;
+    arg.b = b;
+    arg.cutoff = FLINT_MAX(cutoff, 2);
+    arg.basecase = basecase;
+    arg.merge = merge;
+    arg.args = args;
+    arg.num_threads = flint_get_num_threads();
+
+    _fmpz_bsplit(&arg);
+}
@@ -29,6 +29,7 @@
 #include "flint.h"
 #include "ulong_extras.h"
 #include "fmpz.h"
+#include "longlong.h"
 
 #if FLINT64
 #define FLINT_NUM_TINY_FACTORIALS 21
@@ -47,10 +48,113 @@ const mp_limb_t flint_tiny_factorials[] =
 #endif
 };
 
+/* Packs the prime power factors p^e of the odd part of the swing 
+   factorial n! / (floor(n/2)!)^2 into limbs, returning the count */
+static slong
+_fmpz_oddswing_limbs(mp_ptr v, ulong n, mp_srcptr primes, slong num_primes)
+{
+    mp_limb_t acc, hi, lo;
+    ulong q;
+    slong i, len = 0;
+
+    acc = 1;
+
+    for (i = 1; i < num_primes && primes[i] <= n; i++)
+    {
+        const mp_limb_t p = primes[i];
+
+        for (q = n / p; q > 0; q /= p)
+        {
+            if (q & 1)
+            {
+                umul_ppmm(hi, lo, acc, p);
+                if (hi != 0)
+                {
+                    v[len++] = acc;
+                    acc = p;
+                }
+                else
+                    acc = lo;
+            }
+        }
+    }
+
+    if (acc != 1)
+        v[len++] = acc;
+
+    return len;
+}
+
+static void
+_fmpz_fac_ui_swing(fmpz_t f, ulong n)
+{
+    mp_ptr primes, v;
+    slong num_primes, alloc, len, levels;
+    ulong i;
+    n_primes_t iter;
+    fmpz_t t;
+    mp_limb_t p;
+
+    alloc = 1024;
+    primes = flint_malloc(alloc * sizeof(mp_limb_t));
+    num_primes = 0;
+
+    n_primes_init(iter);
+    while ((p = n_primes_next(iter)) <= n)
+    {
+        if (num_primes == alloc)
+        {
+            alloc *= 2;
+            primes = flint_realloc(primes, alloc * sizeof(mp_limb_t));
+        }
+        primes[num_primes++] = p;
+    }
+    n_primes_clear(iter);
+
+    /* Each odd prime contributes at most log_3(n) factors */
+    v = flint_malloc((num_primes + FLINT_BITS * (n_sqrt(n) + 1))
+                        * sizeof(mp_limb_t));
+
+    for (levels = 0; (n >> levels) >= FLINT_NUM_TINY_FACTORIALS; levels++) ;
+
+    /* Odd part of (n >> levels)! */
+    p = flint_tiny_factorials[n >> levels];
+    count_trailing_zeros(i, p);
+    fmpz_set_ui(f, p >> i);
+
+    fmpz_init(t);
+
+    for (i = levels; i > 0; i--)
+    {
+        len = _fmpz_oddswing_limbs(v, n >> (i - 1), primes, num_primes);
+        _fmpz_ui_vec_prod(t, v, len);
+        fmpz_mul_fft(f, f, f);
+        fmpz_mul_fft(f, f, t);
+    }
+
+    /* The 2-adic valuation of n! */
+    for (p = 0, i = n / 2; i > 0; i /= 2)
+        p += i;
+    fmpz_mul_2exp(f, f, p);
+
+    fmpz_clear(t);
+    flint_free(primes);
+    flint_free(v);
+}
+
+/*
+    GMP also uses the prime swing algorithm, and is as fast on a single 
+    thread.  With several threads available, the swing products go 
+    through _fmpz_ui_vec_prod instead, which splits them over threads 
+    and multiplies the large halves with FLINT's FFT.
+ */
+
 void fmpz_fac_ui(fmpz_t f, ulong n)
 {
     if (n < FLINT_NUM_TINY_FACTORIALS)
         fmpz_set_ui(f, flint_tiny_factorials[n]);
-    else
+    else if (n < FMPZ_FAC_UI_SWING_CUTOFF || flint_get_num_threads() == 1)
         flint_mpz_fac_ui(_fmpz_promote(f), n);
+    else
+        _fmpz_fac_ui_swing(f, n);
 }
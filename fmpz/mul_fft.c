@@ -0,0 +1,91 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fft.h"
+
+void
+fmpz_mul_fft(fmpz_t f, const fmpz_t g, const fmpz_t h)
+{
+    __mpz_struct * a, * b, * r;
+    mp_size_t an, bn;
+    mp_ptr t;
+    int neg;
+
+    if (!COEFF_IS_MPZ(*g) || !COEFF_IS_MPZ(*h))
+    {
+        fmpz_mul(f, g, h);
+        return;
+    }
+
+    a = COEFF_TO_PTR(*g);
+    b = COEFF_TO_PTR(*h);
+    an = FLINT_ABS(a->_mp_size);
+    bn = FLINT_ABS(b->_mp_size);
+
+    /* GMP squares faster, and is faster on very unbalanced operands */
+    if (a == b || FLINT_MIN(an, bn) < FMPZ_MUL_FFT_CUTOFF
+               || FLINT_MAX(an, bn) > 8 * FLINT_MIN(an, bn))
+    {
+        fmpz_mul(f, g, h);
+        return;
+    }
+
+    neg = (a->_mp_size ^ b->_mp_size) < 0;
+
+    if (an < bn)
+    {
+        __mpz_struct * c = a;
+        mp_size_t cn = an;
+
+        a = b; an = bn;
+        b = c; bn = cn;
+    }
+
+    r = _fmpz_promote(f);
+
+    if (r != a && r != b)
+    {
+        if (r->_mp_alloc < an + bn)
+            mpz_realloc2(r, (an + bn) * FLINT_BITS);
+        flint_mpn_mul_fft_main(r->_mp_d, a->_mp_d, an, b->_mp_d, bn);
+    }
+    else  /* The FFT does not support aliasing of the output */
+    {
+        t = flint_malloc((an + bn) * sizeof(mp_limb_t));
+        flint_mpn_mul_fft_main(t, a->_mp_d, an, b->_mp_d, bn);
+        if (r->_mp_alloc < an + bn)
+            mpz_realloc2(r, (an + bn) * FLINT_BITS);
+        flint_mpn_copyi(r->_mp_d, t, an + bn);
+        flint_free(t);
+    }
+
+    an = an + bn;
+    while (an > 0 && r->_mp_d[an - 1] == 0)
+        an--;
+    r->_mp_size = neg ? -an : an;
+}
@@ -0,0 +1,52 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <math.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+
+void
+fmpz_set_d_2exp(fmpz_t f, double m, slong exp)
+{
+    int e;
+
+    m = frexp(m, &e);
+    exp += e;
+
+    if (exp >= 53)
+    {
+        fmpz_set_d(f, ldexp(m, 53));
+        fmpz_mul_2exp(f, f, exp - 53);
+    }
+    else if (exp < 0)
+    {
+        fmpz_zero(f);
+    }
+    else
+    {
+        fmpz_set_d(f, ldexp(m, exp));
+    }
+}
@@ -68,7 +68,35 @@ main(void)
         mpz_clear(z);
     }
 
-    
+    /* Prime factorisation, used with several threads */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        fmpz_init(x);
+        fmpz_init(y);
+        mpz_init(z);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        n = n_randint(state, 10 * FMPZ_BIN_UIUI_PRIME_CUTOFF);
+        k = n_randint(state, n + 2);
+
+        fmpz_bin_uiui(x, n, k);
+        flint_mpz_bin_uiui(z, n, k);
+        fmpz_set_mpz(y, z);
+
+        if (!fmpz_equal(x, y))
+        {
+            flint_printf("FAIL: n,k = %wu,%wu (threads = %wd)\n", n, k,
+                flint_get_num_threads());
+            abort();
+        }
+
+        fmpz_clear(x);
+        fmpz_clear(y);
+        mpz_clear(z);
+    }
+
+    flint_set_num_threads(1);
 
     FLINT_TEST_CLEANUP(state);
     flint_printf("PASS\n");
@@ -0,0 +1,109 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+
+/* Computes P = prod_{a <= k < b} k and S = sum_{a <= k < b} k^2 */
+
+static void
+_basecase(fmpz * res, ulong a, ulong b, void * args)
+{
+    ulong k;
+
+    fmpz_one(res);
+    fmpz_zero(res + 1);
+
+    for (k = a; k < b; k++)
+    {
+        fmpz_mul_ui(res, res, k);
+        fmpz_add_ui(res + 1, res + 1, k * k);
+    }
+}
+
+static void
+_merge(fmpz * left, fmpz * right, void * args)
+{
+    fmpz_mul_fft(left, left, right);
+    fmpz_add(left + 1, left + 1, right + 1);
+}
+
+int
+main(void)
+{
+    int i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("bsplit....");
+    fflush(stdout);
+
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fmpz * res;
+        fmpz_t P, S;
+        ulong a, b, k, cutoff;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        res = _fmpz_vec_init(2);
+        fmpz_init(P);
+        fmpz_init(S);
+
+        a = n_randint(state, 1000) + 1;
+        b = a + n_randint(state, 5000) + 1;
+        cutoff = n_randint(state, 100);
+
+        fmpz_bsplit(res, 2, a, b, cutoff, _basecase, _merge, NULL);
+
+        fmpz_one(P);
+        for (k = a; k < b; k++)
+        {
+            fmpz_mul_ui(P, P, k);
+            fmpz_add_ui(S, S, k * k);
+        }
+
+        if (!fmpz_equal(res, P) || !fmpz_equal(res + 1, S))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("a = %wu, b = %wu, cutoff = %wu\n", a, b, cutoff);
+            abort();
+        }
+
+        _fmpz_vec_clear(res, 2);
+        fmpz_clear(P);
+        fmpz_clear(S);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -67,6 +67,31 @@ main(void)
         }
     }
 
+    /* Prime swing algorithm, used with several threads */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        mpz_t z;
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+
+        n = n_randint(state, 3 * FMPZ_FAC_UI_SWING_CUTOFF);
+
+        mpz_init(z);
+        fmpz_fac_ui(x, n);
+        flint_mpz_fac_ui(z, n);
+        fmpz_set_mpz(y, z);
+        mpz_clear(z);
+
+        if (!fmpz_equal(x, y))
+        {
+            flint_printf("FAIL: %wd (threads = %wd)\n", n,
+                flint_get_num_threads());
+            abort();
+        }
+    }
+
+    flint_set_num_threads(1);
+
     fmpz_clear(x);
     fmpz_clear(y);
 
@@ -0,0 +1,104 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_fft....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz_t a, b, c, d;
+        mp_bitcnt_t bits1, bits2;
+        int alias;
+
+        fmpz_init(a);
+        fmpz_init(b);
+        fmpz_init(c);
+        fmpz_init(d);
+
+        /* Sizes straddling the FFT cutoff */
+        bits1 = n_randint(state, 3 * FMPZ_MUL_FFT_CUTOFF * FLINT_BITS) + 1;
+        bits2 = (n_randint(state, 4) == 0) ? n_randint(state, 200) + 1 :
+            n_randint(state, 3 * FMPZ_MUL_FFT_CUTOFF * FLINT_BITS) + 1;
+
+        fmpz_randtest(a, state, bits1);
+        fmpz_randtest(b, state, bits2);
+        fmpz_randtest(c, state, 100);
+
+        fmpz_mul(d, a, b);
+
+        alias = n_randint(state, 4);
+        if (alias == 0)
+        {
+            fmpz_mul_fft(c, a, b);
+        }
+        else if (alias == 1)
+        {
+            fmpz_set(c, a);
+            fmpz_mul_fft(c, c, b);
+        }
+        else if (alias == 2)
+        {
+            fmpz_set(c, b);
+            fmpz_mul_fft(c, a, c);
+        }
+        else
+        {
+            fmpz_mul(d, a, a);
+            fmpz_set(c, a);
+            fmpz_mul_fft(c, c, c);
+        }
+
+        result = fmpz_equal(c, d);
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("alias = %d, bits1 = %wu, bits2 = %wu\n",
+                alias, bits1, bits2);
+            abort();
+        }
+
+        fmpz_clear(a);
+        fmpz_clear(b);
+        fmpz_clear(c);
+        fmpz_clear(d);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
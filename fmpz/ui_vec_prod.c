@@ -0,0 +1,59 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+
+#define UI_VEC_PROD_BASECASE 32
+
+static void
+_ui_vec_prod_basecase(fmpz * res, ulong a, ulong b, void * args)
+{
+    mp_srcptr v = (mp_srcptr) args;
+    ulong i;
+
+    fmpz_set_ui(res, v[a]);
+    for (i = a + 1; i < b; i++)
+        fmpz_mul_ui(res, res, v[i]);
+}
+
+static void
+_ui_vec_prod_merge(fmpz * left, fmpz * right, void * args)
+{
+    fmpz_mul_fft(left, left, right);
+}
+
+void
+_fmpz_ui_vec_prod(fmpz_t res, mp_srcptr v, slong len)
+{
+    if (len <= 0)
+        fmpz_one(res);
+    else if (len < UI_VEC_PROD_BASECASE)
+        _ui_vec_prod_basecase(res, 0, len, (void *) v);
+    else
+        fmpz_bsplit(res, 1, 0, len, UI_VEC_PROD_BASECASE,
+            _ui_vec_prod_basecase, _ui_vec_prod_merge, (void *) v);
+}
@@ -297,6 +297,25 @@ FLINT_DLL void fmpz_mat_det_divisor(fmpz_t d, const fmpz_mat_t A);
 FLINT_DLL void _fmpz_mat_charpoly(fmpz *cp, const fmpz_mat_t mat);
 FLINT_DLL void fmpz_mat_charpoly(fmpz_poly_t cp, const fmpz_mat_t mat);
 
+#define FMPZ_MAT_CHARPOLY_MODULAR_CUTOFF 12
+
+FLINT_DLL slong _fmpz_mat_charpoly_bound_bits(const fmpz_mat_t A);
+
+FLINT_DLL void _fmpz_mat_charpoly_multi_mod(mp_ptr * residues, slong * lens,
+    const fmpz_mat_t A, mp_srcptr primes, slong num_primes, int minpoly);
+
+FLINT_DLL slong _fmpz_mat_charpoly_modular_crt(fmpz * res, const fmpz_mat_t A,
+                                slong bits, int proved, int minpoly);
+
+FLINT_DLL void _fmpz_mat_charpoly_modular(fmpz * cp, const fmpz_mat_t A,
+                                          int proved);
+
+FLINT_DLL void fmpz_mat_charpoly_modular(fmpz_poly_t cp, const fmpz_mat_t A,
+                                         int proved);
+
+FLINT_DLL void fmpz_mat_minpoly_modular(fmpz_poly_t p, const fmpz_mat_t A,
+                                        int proved);
+
 /* Rank *********************************************************************/
 
 FLINT_DLL slong fmpz_mat_rank(const fmpz_mat_t A);
@@ -369,6 +388,7 @@ FLINT_DLL void fmpz_mat_snf_diagonal(fmpz_mat_t S, const fmpz_mat_t A);
 FLINT_DLL void fmpz_mat_snf_kannan_bachem(fmpz_mat_t S, const fmpz_mat_t A);
 FLINT_DLL void fmpz_mat_snf_iliopoulos(fmpz_mat_t S, const fmpz_mat_t A,
         const fmpz_t mod);
+FLINT_DLL void fmpz_mat_snf_modular(fmpz_mat_t S, const fmpz_mat_t A);
 FLINT_DLL int fmpz_mat_is_in_snf(const fmpz_mat_t A);
 
 /* Special matrices **********************************************************/
@@ -119,6 +119,9 @@ void fmpz_mat_charpoly(fmpz_poly_t cp, const fmpz_mat_t mat)
     fmpz_poly_fit_length(cp, mat->r + 1);
     _fmpz_poly_set_length(cp, mat->r + 1);
 
-    _fmpz_mat_charpoly(cp->coeffs, mat);
+    if (mat->r < FMPZ_MAT_CHARPOLY_MODULAR_CUTOFF)
+        _fmpz_mat_charpoly(cp->coeffs, mat);
+    else
+        _fmpz_mat_charpoly_modular(cp->coeffs, mat, 1);
 }
 
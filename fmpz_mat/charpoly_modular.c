@@ -0,0 +1,71 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_mat.h"
+
+/*
+    Returns a bound for the number of bits of the coefficients of the
+    characteristic polynomial of A, including one bit for the sign.
+    The coefficient of x^{n-k} is a sum of binomial(n, k) principal minors
+    of order k, each bounded by (sqrt(k) B)^k by Hadamard's inequality.
+ */
+slong
+_fmpz_mat_charpoly_bound_bits(const fmpz_mat_t A)
+{
+    slong n = A->r, b;
+
+    b = FLINT_ABS(fmpz_mat_max_bits(A));
+
+    return n * (b + (FLINT_BIT_COUNT(n) + 1) / 2) + n + 1;
+}
+
+void
+_fmpz_mat_charpoly_modular(fmpz * cp, const fmpz_mat_t A, int proved)
+{
+    if (A->r == 0)
+        fmpz_one(cp);
+    else
+        _fmpz_mat_charpoly_modular_crt(cp, A,
+            _fmpz_mat_charpoly_bound_bits(A), proved, 0);
+}
+
+void
+fmpz_mat_charpoly_modular(fmpz_poly_t cp, const fmpz_mat_t A, int proved)
+{
+    if (A->r != A->c)
+    {
+        flint_printf("Exception (fmpz_mat_charpoly_modular). "
+                     "Non-square matrix.\n");
+        abort();
+    }
+
+    fmpz_poly_fit_length(cp, A->r + 1);
+    _fmpz_mat_charpoly_modular(cp->coeffs, A, proved);
+    _fmpz_poly_set_length(cp, A->r + 1);
+}
@@ -0,0 +1,202 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <pthread.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_poly.h"
+#include "fmpz_poly.h"
+#include "fmpz_mat.h"
+
+typedef struct
+{
+    const fmpz_mat_struct * A;
+    mp_ptr * residues;
+    slong * lens;
+    mp_srcptr primes;
+    slong i0;
+    slong i1;
+    int minpoly;
+}
+charpoly_arg_t;
+
+static void
+_fmpz_mat_charpoly_multi_mod_range(charpoly_arg_t * arg)
+{
+    slong i, n = arg->A->r;
+    nmod_mat_t Amod;
+    nmod_poly_t f;
+
+    for (i = arg->i0; i < arg->i1; i++)
+    {
+        nmod_mat_init(Amod, n, n, arg->primes[i]);
+        nmod_poly_init(f, arg->primes[i]);
+
+        fmpz_mat_get_nmod_mat(Amod, arg->A);
+
+        if (arg->minpoly)
+            nmod_mat_minpoly(f, Amod);
+        else
+            nmod_mat_charpoly(f, Amod);
+
+        _nmod_vec_zero(arg->residues[i], n + 1);
+        _nmod_vec_set(arg->residues[i], f->coeffs, f->length);
+        arg->lens[i] = f->length;
+
+        nmod_poly_clear(f);
+        nmod_mat_clear(Amod);
+    }
+}
+
+static void *
+_fmpz_mat_charpoly_multi_mod_worker(void * arg_ptr)
+{
+    _fmpz_mat_charpoly_multi_mod_range((charpoly_arg_t *) arg_ptr);
+    flint_cleanup();
+    return NULL;
+}
+
+void
+_fmpz_mat_charpoly_multi_mod(mp_ptr * residues, slong * lens,
+    const fmpz_mat_t A, mp_srcptr primes, slong num_primes, int minpoly)
+{
+    slong i, num_threads = flint_get_num_threads();
+    pthread_t * threads;
+    charpoly_arg_t * args;
+
+    num_threads = FLINT_MAX(1, FLINT_MIN(num_threads, num_primes));
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(charpoly_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].A = A;
+        args[i].residues = residues;
+        args[i].lens = lens;
+        args[i].primes = primes;
+        args[i].i0 = (i * num_primes) / num_threads;
+        args[i].i1 = ((i + 1) * num_primes) / num_threads;
+        args[i].minpoly = minpoly;
+    }
+
+    for (i = 1; i < num_threads; i++)
+        pthread_create(&threads[i], NULL,
+            _fmpz_mat_charpoly_multi_mod_worker, &args[i]);
+
+    _fmpz_mat_charpoly_multi_mod_range(&args[0]);
+
+    for (i = 1; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
+
+slong
+_fmpz_mat_charpoly_modular_crt(fmpz * res, const fmpz_mat_t A,
+                               slong bits, int proved, int minpoly)
+{
+    slong i, n = A->r, len = 0, num_threads;
+    mp_ptr primes, * residues;
+    slong * lens;
+    mp_limb_t p;
+    fmpz_t prod, stable_prod;
+    fmpz * t;
+    int done = 0;
+
+    num_threads = FLINT_MAX(1, flint_get_num_threads());
+
+    primes = flint_malloc(sizeof(mp_limb_t) * num_threads);
+    residues = flint_malloc(sizeof(mp_ptr) * num_threads);
+    lens = flint_malloc(sizeof(slong) * num_threads);
+    for (i = 0; i < num_threads; i++)
+        residues[i] = flint_malloc(sizeof(mp_limb_t) * (n + 1));
+
+    t = _fmpz_vec_init(n + 1);
+    fmpz_init(prod);
+    fmpz_init(stable_prod);
+    fmpz_one(prod);
+    fmpz_one(stable_prod);
+    _fmpz_vec_zero(res, n + 1);
+
+    p = UWORD(1) << NMOD_MAT_OPTIMAL_MODULUS_BITS;
+
+    /* one prime per thread at a time, until prod exceeds 2^bits */
+    while (!done)
+    {
+        for (i = 0; i < num_threads; i++)
+        {
+            p = n_nextprime(p, 0);
+            primes[i] = p;
+        }
+
+        _fmpz_mat_charpoly_multi_mod(residues, lens, A, primes,
+                                     num_threads, minpoly);
+
+        for (i = 0; i < num_threads && !done; i++)
+        {
+            /* residues of smaller degree come from unlucky primes */
+            if (lens[i] < len)
+                continue;
+
+            if (lens[i] > len)
+            {
+                len = lens[i];
+                fmpz_one(prod);
+                fmpz_one(stable_prod);
+                _fmpz_vec_zero(res, n + 1);
+            }
+
+            _fmpz_poly_CRT_ui(t, res, len, prod, residues[i], len, primes[i],
+                              n_preinvert_limb(primes[i]), 1);
+
+            if (_fmpz_vec_equal(t, res, len))
+                fmpz_mul_ui(stable_prod, stable_prod, primes[i]);
+            else
+                fmpz_set_ui(stable_prod, primes[i]);
+
+            _fmpz_vec_swap(t, res, len);
+            fmpz_mul_ui(prod, prod, primes[i]);
+
+            done = (fmpz_bits(prod) > bits)
+                || (!proved && fmpz_bits(stable_prod) > 100);
+        }
+    }
+
+    _fmpz_vec_clear(t, n + 1);
+    fmpz_clear(prod);
+    fmpz_clear(stable_prod);
+
+    for (i = 0; i < num_threads; i++)
+        flint_free(residues[i]);
+
+    flint_free(primes);
+    flint_free(residues);
+    flint_free(lens);
+
+    return len;
+}
@@ -0,0 +1,60 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mat.h"
+
+void
+fmpz_mat_minpoly_modular(fmpz_poly_t p, const fmpz_mat_t A, int proved)
+{
+    slong n = A->r, bits, len;
+
+    if (A->r != A->c)
+    {
+        flint_printf("Exception (fmpz_mat_minpoly_modular). "
+                     "Non-square matrix.\n");
+        abort();
+    }
+
+    if (n == 0)
+    {
+        fmpz_poly_one(p);
+        return;
+    }
+
+    /*
+        The minimal polynomial is a monic factor of the characteristic
+        polynomial f, so its coefficients are bounded by 2^n ||f||_2
+        (Mignotte), where ||f||_2 <= sqrt(n + 1) ||f||_inf.
+     */
+    bits = _fmpz_mat_charpoly_bound_bits(A) + n
+                                    + (FLINT_BIT_COUNT(n + 1) + 1) / 2 + 1;
+
+    fmpz_poly_fit_length(p, n + 1);
+    len = _fmpz_mat_charpoly_modular_crt(p->coeffs, A, bits, proved, 1);
+    _fmpz_poly_set_length(p, len);
+}
@@ -28,7 +28,6 @@
 void
 fmpz_mat_snf(fmpz_mat_t S, const fmpz_mat_t A)
 {
-    fmpz_t det;
     slong m = A->r, n = A->c, b = fmpz_mat_max_bits(A), cutoff = 9;
 
     if (b <= 2)
@@ -44,21 +43,8 @@ fmpz_mat_snf(fmpz_mat_t S, const fmpz_mat_t A)
     else if (b <= 64)
         cutoff = 10;
 
-    if (FLINT_MAX(m, n) < cutoff || m != n)
+    if (FLINT_MAX(m, n) < cutoff)
         fmpz_mat_snf_kannan_bachem(S, A);
     else
-    {
-        fmpz_init(det);
-        fmpz_mat_det(det, A);
-        if (!fmpz_is_zero(det))
-        {
-            fmpz_abs(det, det);
-            fmpz_mat_snf_iliopoulos(S, A, det);
-        }
-        else
-        {
-            fmpz_mat_snf_kannan_bachem(S, A);
-        }
-        fmpz_clear(det);
-    }
+        fmpz_mat_snf_modular(S, A);
 }
@@ -0,0 +1,138 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include "fmpz_mat.h"
+
+/*
+    Sets S to the Smith normal form of the nonsingular square matrix A,
+    where det = |det(A)|. The lattice spanned by A contains s Z^n where
+    s is the largest invariant factor, so we may work modulo s instead
+    of modulo det. A candidate for s is found by Dixon solving; if it
+    is a proper divisor of s, the product of the computed invariant
+    factors is too small and we fall back to reducing modulo det.
+*/
+static void
+_fmpz_mat_snf_nonsingular(fmpz_mat_t S, const fmpz_mat_t A, const fmpz_t det)
+{
+    fmpz_t s, p;
+    slong i;
+
+    fmpz_init(s);
+    fmpz_init(p);
+
+    fmpz_mat_det_divisor(s, A);
+
+    if (!fmpz_is_zero(s) && fmpz_cmp(s, det) < 0)
+    {
+        fmpz_mat_snf_iliopoulos(S, A, s);
+
+        fmpz_one(p);
+        for (i = 0; i < A->r; i++)
+            fmpz_mul(p, p, fmpz_mat_entry(S, i, i));
+
+        if (!fmpz_equal(p, det))
+            fmpz_mat_snf_iliopoulos(S, A, det);
+    }
+    else
+        fmpz_mat_snf_iliopoulos(S, A, det);
+
+    fmpz_clear(s);
+    fmpz_clear(p);
+}
+
+void
+fmpz_mat_snf_modular(fmpz_mat_t S, const fmpz_mat_t A)
+{
+    fmpz_mat_t H, Hr, Ht, T, Sr;
+    fmpz_t det;
+    slong i, j, m, n, r;
+
+    m = A->r;
+    n = A->c;
+
+    if (m == 0 || n == 0)
+        return;
+
+    fmpz_init(det);
+
+    if (m == n)
+        fmpz_mat_det(det, A);
+
+    if (!fmpz_is_zero(det))
+    {
+        fmpz_abs(det, det);
+        fmpz_mat_init(Sr, n, n);
+        _fmpz_mat_snf_nonsingular(Sr, A, det);
+        fmpz_mat_swap(S, Sr);
+        fmpz_mat_clear(Sr);
+        fmpz_clear(det);
+        return;
+    }
+
+    /* Reduce to a nonsingular r x r matrix T with the same nonzero
+       invariant factors: the nonzero rows Hr of the row Hermite form
+       of A span the same lattice, and the Hermite form of the transpose
+       of Hr is T stacked over zeros. */
+    fmpz_mat_init(H, m, n);
+    fmpz_mat_hnf(H, A);
+
+    for (r = FLINT_MIN(m, n); r > 0; r--)
+    {
+        for (j = 0; j < n && fmpz_is_zero(fmpz_mat_entry(H, r - 1, j)); j++) ;
+        if (j < n)
+            break;
+    }
+
+    fmpz_mat_zero(S);
+
+    if (r != 0)
+    {
+        fmpz_mat_window_init(Hr, H, 0, 0, r, n);
+        fmpz_mat_init(Ht, n, r);
+        fmpz_mat_transpose(Ht, Hr);
+        fmpz_mat_hnf(Ht, Ht);
+
+        fmpz_mat_window_init(T, Ht, 0, 0, r, r);
+        fmpz_mat_init(Sr, r, r);
+
+        /* T is upper triangular with positive diagonal */
+        fmpz_one(det);
+        for (i = 0; i < r; i++)
+            fmpz_mul(det, det, fmpz_mat_entry(T, i, i));
+
+        _fmpz_mat_snf_nonsingular(Sr, T, det);
+
+        for (i = 0; i < r; i++)
+            fmpz_swap(fmpz_mat_entry(S, i, i), fmpz_mat_entry(Sr, i, i));
+
+        fmpz_mat_clear(Sr);
+        fmpz_mat_window_clear(T);
+        fmpz_mat_clear(Ht);
+        fmpz_mat_window_clear(Hr);
+    }
+
+    fmpz_mat_clear(H);
+    fmpz_clear(det);
+}
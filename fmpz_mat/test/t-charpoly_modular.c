@@ -0,0 +1,82 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong n, rep;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("charpoly_modular....");
+    fflush(stdout);
+
+    for (rep = 0; rep < 1000 * flint_test_multiplier(); rep++)
+    {
+        fmpz_mat_t A;
+        fmpz_poly_t f, g;
+
+        n = n_randint(state, 12);
+
+        fmpz_mat_init(A, n, n);
+        fmpz_poly_init(f);
+        fmpz_poly_init(g);
+
+        fmpz_mat_randtest(A, state, 1 + n_randint(state, 100));
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+        fmpz_mat_charpoly_modular(f, A, n_randint(state, 2));
+        flint_set_num_threads(1);
+
+        fmpz_poly_fit_length(g, n + 1);
+        _fmpz_mat_charpoly(g->coeffs, A);
+        _fmpz_poly_set_length(g, n + 1);
+
+        if (!fmpz_poly_equal(f, g))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("Matrix A:\n"), fmpz_mat_print(A), flint_printf("\n");
+            flint_printf("f = "), fmpz_poly_print_pretty(f, "X"), flint_printf("\n");
+            flint_printf("g = "), fmpz_poly_print_pretty(g, "X"), flint_printf("\n");
+            abort();
+        }
+
+        fmpz_mat_clear(A);
+        fmpz_poly_clear(f);
+        fmpz_poly_clear(g);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
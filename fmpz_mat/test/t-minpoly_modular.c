@@ -0,0 +1,141 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mat.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong rep;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("minpoly_modular....");
+    fflush(stdout);
+
+    for (rep = 0; rep < 500 * flint_test_multiplier(); rep++)
+    {
+        fmpz_mat_t A, B, C, T;
+        fmpz_poly_t f, g, q, r;
+        nmod_mat_t Amod;
+        nmod_poly_t fmod, gmod;
+        mp_limb_t p;
+        slong i, j, a, b, k, m, n;
+
+        m = n_randint(state, 5);
+        k = 1 + n_randint(state, 3);
+        n = m * k;
+
+        fmpz_mat_init(A, n, n);
+        fmpz_mat_init(B, n, n);
+        fmpz_mat_init(T, n, n);
+        fmpz_poly_init(f);
+        fmpz_poly_init(g);
+        fmpz_poly_init(q);
+        fmpz_poly_init(r);
+
+        /* k copies of an m x m block on the diagonal */
+        fmpz_mat_init(C, m, m);
+        fmpz_mat_randtest(C, state, 1 + n_randint(state, 30));
+        for (j = 0; j < k; j++)
+            for (a = 0; a < m; a++)
+                for (b = 0; b < m; b++)
+                    fmpz_set(fmpz_mat_entry(A, j * m + a, j * m + b),
+                             fmpz_mat_entry(C, a, b));
+        fmpz_mat_clear(C);
+
+        if (n_randint(state, 3) == 0)
+            fmpz_mat_randtest(A, state, 1 + n_randint(state, 30));
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+        fmpz_mat_minpoly_modular(f, A, n_randint(state, 2));
+        flint_set_num_threads(1);
+        fmpz_mat_charpoly(g, A);
+
+        /* f(A) = 0 by Horner's rule */
+        fmpz_mat_zero(B);
+        for (i = f->length - 1; i >= 0; i--)
+        {
+            fmpz_mat_mul(T, B, A);
+            fmpz_mat_swap(T, B);
+            for (j = 0; j < n; j++)
+                fmpz_add(fmpz_mat_entry(B, j, j), fmpz_mat_entry(B, j, j),
+                         f->coeffs + i);
+        }
+
+        fmpz_poly_divrem(q, r, g, f);
+
+        if (!fmpz_mat_is_zero(B) || !fmpz_poly_is_zero(r)
+            || !fmpz_is_one(fmpz_poly_lead(f)))
+        {
+            flint_printf("FAIL (annihilator):\n");
+            flint_printf("Matrix A:\n"), fmpz_mat_print(A), flint_printf("\n");
+            flint_printf("f = "), fmpz_poly_print_pretty(f, "X"), flint_printf("\n");
+            abort();
+        }
+
+        /* Compare with the minimal polynomial modulo a large prime */
+        p = n_randprime(state, FLINT_BITS - 1, 1);
+        nmod_mat_init(Amod, n, n, p);
+        nmod_poly_init(fmod, p);
+        nmod_poly_init(gmod, p);
+
+        fmpz_mat_get_nmod_mat(Amod, A);
+        nmod_mat_minpoly(gmod, Amod);
+        fmpz_poly_get_nmod_poly(fmod, f);
+
+        if (!nmod_poly_equal(fmod, gmod))
+        {
+            flint_printf("FAIL (modular image):\n");
+            flint_printf("Matrix A:\n"), fmpz_mat_print(A), flint_printf("\n");
+            flint_printf("f = "), fmpz_poly_print_pretty(f, "X"), flint_printf("\n");
+            nmod_poly_print(gmod), flint_printf("\n");
+            abort();
+        }
+
+        nmod_mat_clear(Amod);
+        nmod_poly_clear(fmod);
+        nmod_poly_clear(gmod);
+
+        fmpz_mat_clear(A);
+        fmpz_mat_clear(B);
+        fmpz_mat_clear(T);
+        fmpz_poly_clear(f);
+        fmpz_poly_clear(g);
+        fmpz_poly_clear(q);
+        fmpz_poly_clear(r);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,110 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mat.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("snf_modular....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        fmpz_mat_t A, S, S2;
+        slong m, n, r, b, d;
+        int equal;
+
+        m = n_randint(state, 12);
+        n = n_randint(state, 12);
+        r = n_randint(state, FLINT_MIN(m, n) + 1);
+
+        fmpz_mat_init(A, m, n);
+        fmpz_mat_init(S, m, n);
+        fmpz_mat_init(S2, m, n);
+
+        /* sparse */
+        b = 1 + n_randint(state, 10) * n_randint(state, 10);
+        d = n_randint(state, 2*m*n + 1);
+        fmpz_mat_randrank(A, state, r, b);
+
+        /* dense */
+        if (n_randint(state, 2))
+            fmpz_mat_randops(A, state, d);
+
+        fmpz_mat_snf_modular(S, A);
+
+        if (!fmpz_mat_is_in_snf(S))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("matrix not in snf!\n");
+            fmpz_mat_print_pretty(A); flint_printf("\n\n");
+            fmpz_mat_print_pretty(S); flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_mat_snf_kannan_bachem(S2, A);
+        equal = fmpz_mat_equal(S, S2);
+
+        if (!equal)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("snfs found by different methods should be the same!\n");
+            fmpz_mat_print_pretty(A); flint_printf("\n\n");
+            fmpz_mat_print_pretty(S); flint_printf("\n\n");
+            fmpz_mat_print_pretty(S2); flint_printf("\n\n");
+            abort();
+        }
+
+        /* aliasing */
+        fmpz_mat_snf_modular(A, A);
+
+        if (!fmpz_mat_equal(A, S))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("aliasing failed!\n");
+            fmpz_mat_print_pretty(A); flint_printf("\n\n");
+            fmpz_mat_print_pretty(S); flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_mat_clear(S2);
+        fmpz_mat_clear(S);
+        fmpz_mat_clear(A);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -54,6 +54,9 @@
 
 #define FMPZ_MOD_POLY_INV_NEWTON_CUTOFF  64 /* Inv series newton: Basecase -> Newton */
 
+#define FMPZ_MOD_POLY_MULTI_POINT_PREINV_CUTOFF 32 /* Node length for
+                                                      precomputed inverses */
+
 /*  Type definitions *********************************************************/
 
 typedef struct
@@ -93,6 +96,16 @@ typedef struct
 
 typedef fmpz_mod_poly_frobenius_powers_struct fmpz_mod_poly_frobenius_powers_t[1];
 
+typedef struct
+{
+    fmpz_poly_struct ** tree;
+    fmpz ** tree_inv;
+    slong len;
+    fmpz p;
+} fmpz_mod_poly_multi_point_struct;
+
+typedef fmpz_mod_poly_multi_point_struct fmpz_mod_poly_multi_point_t[1];
+
 typedef struct
 {
     fmpz_mat_struct A;
@@ -907,6 +920,21 @@ FLINT_DLL void _fmpz_mod_poly_evaluate_fmpz_vec_fast(fmpz * ys,
 FLINT_DLL void fmpz_mod_poly_evaluate_fmpz_vec_fast(fmpz * ys,
                         const fmpz_mod_poly_t poly, const fmpz * xs, slong n);
 
+FLINT_DLL void fmpz_mod_poly_multi_point_init(fmpz_mod_poly_multi_point_t P,
+                             const fmpz * xs, slong len, const fmpz_t p);
+
+FLINT_DLL void fmpz_mod_poly_multi_point_clear(fmpz_mod_poly_multi_point_t P);
+
+FLINT_DLL void _fmpz_mod_poly_multi_point_evaluate(fmpz * ys,
+    const fmpz * poly, slong plen, const fmpz_mod_poly_multi_point_t P);
+
+FLINT_DLL void fmpz_mod_poly_multi_point_evaluate(fmpz * ys,
+    const fmpz_mod_poly_t poly, const fmpz_mod_poly_multi_point_t P);
+
+FLINT_DLL void fmpz_mod_poly_multi_point_evaluate_vec(fmpz ** ys,
+    const fmpz_mod_poly_struct * polys, slong num,
+    const fmpz_mod_poly_multi_point_t P);
+
 FLINT_DLL void _fmpz_mod_poly_evaluate_fmpz_vec(fmpz * ys, const fmpz * coeffs, 
                         slong len, const fmpz * xs, slong n, const fmpz_t mod);
 
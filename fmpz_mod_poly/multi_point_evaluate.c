@@ -0,0 +1,154 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+#include "fmpz_mod_poly.h"
+
+/*
+    Sets r to a modulo the monic node b. If binv is not NULL it holds the
+    inverse of the reversal of b to length b->length - 1, which is used
+    whenever the division is in range for Newton division.
+*/
+static __inline__ void
+_fmpz_mod_poly_multi_point_rem(fmpz * r, fmpz * q, const fmpz * a,
+    slong alen, const fmpz_poly_struct * b, const fmpz * binv,
+    const fmpz_t one, const fmpz_t p)
+{
+    const slong blen = b->length;
+
+    if (binv != NULL && alen > blen + 1 && alen <= 2 * blen - 2)
+        _fmpz_mod_poly_divrem_newton_n_preinv(q, r, a, alen,
+                                      b->coeffs, blen, binv, blen - 1, p);
+    else
+        _fmpz_mod_poly_rem(r, a, alen, b->coeffs, blen, one, p);
+}
+
+void
+_fmpz_mod_poly_multi_point_evaluate(fmpz * vs, const fmpz * poly,
+    slong plen, const fmpz_mod_poly_multi_point_t P)
+{
+    const slong len = P->len;
+    const fmpz * p = &(P->p);
+    slong height, i, j, pow, left;
+    slong tree_height;
+    fmpz_t temp, one;
+    fmpz * t, * u, * q, * pb, * pc, * pi, * swap;
+    fmpz_poly_struct * pa;
+
+    /* avoid worrying about some degenerate cases */
+    if (len < 2 || plen < 2)
+    {
+        if (len == 1)
+        {
+            fmpz_init(temp);
+            fmpz_negmod(temp, P->tree[0]->coeffs, p);
+            _fmpz_mod_poly_evaluate_fmpz(vs, poly, plen, temp, p);
+            fmpz_clear(temp);
+        }
+        else if (len != 0 && plen == 0)
+            _fmpz_vec_zero(vs, len);
+        else if (len != 0 && plen == 1)
+            for (i = 0; i < len; i++)
+                fmpz_set(vs + i, poly);
+
+        return;
+    }
+
+    fmpz_init_set_ui(one, 1);
+    t = _fmpz_vec_init(2*len);
+    u = _fmpz_vec_init(2*len);
+    q = _fmpz_vec_init(len);
+
+    /* Initial reduction. We allow the polynomial to be larger
+       or smaller than the number of points. */
+    height = FLINT_BIT_COUNT(plen - 1) - 1;
+    tree_height = FLINT_CLOG2(len);
+    while (height >= tree_height)
+        height--;
+    pow = WORD(1) << height;
+
+    for (i = j = 0; i < len; i += pow, j++)
+    {
+        pa = P->tree[height] + j;
+        pi = (pa->length == pow + 1 && P->tree_inv[height] != NULL) ?
+                  P->tree_inv[height] + i : NULL;
+        _fmpz_mod_poly_multi_point_rem(t + i, q, poly, plen, pa, pi, one, p);
+    }
+
+    for (i = height - 1; i >= 0; i--)
+    {
+        pow = WORD(1) << i;
+        left = len;
+        pa = P->tree[i];
+        pi = P->tree_inv[i];
+        pb = t;
+        pc = u;
+
+        while (left >= 2 * pow)
+        {
+            _fmpz_mod_poly_multi_point_rem(pc, q, pb, 2 * pow,
+                                           pa, pi, one, p);
+            _fmpz_mod_poly_multi_point_rem(pc + pow, q, pb, 2 * pow,
+                                pa + 1, pi == NULL ? NULL : pi + pow, one, p);
+
+            pa += 2;
+            pb += 2 * pow;
+            pc += 2 * pow;
+            pi = (pi == NULL) ? NULL : pi + 2 * pow;
+            left -= 2 * pow;
+        }
+
+        if (left > pow)
+        {
+            _fmpz_mod_poly_multi_point_rem(pc, q, pb, left, pa, pi, one, p);
+            _fmpz_mod_poly_rem(pc + pow, pb, left,
+                            (pa + 1)->coeffs, (pa + 1)->length, one, p);
+        }
+        else if (left > 0)
+           _fmpz_vec_set(pc, pb, left);
+
+        swap = t;
+        t = u;
+        u = swap;
+    }
+
+    _fmpz_vec_set(vs, t, len);
+
+    fmpz_clear(one);
+    _fmpz_vec_clear(t, 2*len);
+    _fmpz_vec_clear(u, 2*len);
+    _fmpz_vec_clear(q, len);
+}
+
+void
+fmpz_mod_poly_multi_point_evaluate(fmpz * ys,
+    const fmpz_mod_poly_t poly, const fmpz_mod_poly_multi_point_t P)
+{
+    _fmpz_mod_poly_multi_point_evaluate(ys, poly->coeffs, poly->length, P);
+}
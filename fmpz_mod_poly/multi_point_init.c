@@ -0,0 +1,81 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+#include "fmpz_mod_poly.h"
+
+void
+fmpz_mod_poly_multi_point_init(fmpz_mod_poly_multi_point_t P,
+                             const fmpz * xs, slong len, const fmpz_t p)
+{
+    slong i, j, height, pow;
+    fmpz * tmp;
+    fmpz_t one;
+
+    P->len = len;
+    P->tree = NULL;
+    P->tree_inv = NULL;
+    fmpz_init_set(&(P->p), p);
+
+    if (len == 0)
+        return;
+
+    P->tree = _fmpz_mod_poly_tree_alloc(len);
+    _fmpz_mod_poly_tree_build(P->tree, xs, len, p);
+
+    /* Inverses of the reversed full nodes, on the levels where
+       remainders are computed by Newton division */
+    height = FLINT_CLOG2(len);
+    P->tree_inv = flint_malloc(sizeof(fmpz *) * (height + 1));
+    tmp = _fmpz_vec_init(len + 1);
+    fmpz_init_set_ui(one, 1);
+
+    for (i = 0; i <= height; i++)
+    {
+        pow = WORD(1) << i;
+
+        if (i == height || pow + 1 < FMPZ_MOD_POLY_MULTI_POINT_PREINV_CUTOFF)
+        {
+            P->tree_inv[i] = NULL;
+            continue;
+        }
+
+        P->tree_inv[i] = _fmpz_vec_init(len);
+
+        for (j = 0; j + pow <= len; j += pow)
+        {
+            _fmpz_poly_reverse(tmp, P->tree[i][j / pow].coeffs,
+                                                        pow + 1, pow + 1);
+            _fmpz_mod_poly_inv_series(P->tree_inv[i] + j, tmp, pow, one, p);
+        }
+    }
+
+    fmpz_clear(one);
+    _fmpz_vec_clear(tmp, len + 1);
+}
@@ -0,0 +1,120 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+#include "fmpz_mod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result = 1;
+    FLINT_TEST_INIT(state);
+    
+    flint_printf("multi_point_evaluate....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz_mod_poly_multi_point_t M;
+        fmpz_mod_poly_struct * P;
+        fmpz * x, * y, ** z;
+        fmpz_t mod;
+        slong j, k, num, npoints;
+
+        fmpz_init(mod);
+        
+        do 
+        {
+           fmpz_randtest_unsigned(mod, state, n_randint(state, 4) == 0 ? 100 : 5);
+           fmpz_add_ui(mod, mod, 2);
+        } while (!fmpz_is_probabprime(mod));
+        
+        npoints = n_randint(state, n_randint(state, 8) == 0 ? 200 : 20);
+        num = n_randint(state, 4);
+
+        x = _fmpz_vec_init(npoints);
+        y = _fmpz_vec_init(npoints);
+        z = flint_malloc(sizeof(fmpz *) * num);
+        P = flint_malloc(sizeof(fmpz_mod_poly_struct) * num);
+
+        for (j = 0; j < npoints; j++)
+            fmpz_randtest_mod(x + j, state, mod);
+
+        for (k = 0; k < num; k++)
+        {
+            z[k] = _fmpz_vec_init(npoints);
+            fmpz_mod_poly_init(P + k, mod);
+            fmpz_mod_poly_randtest(P + k, state,
+                                   n_randint(state, 2 * npoints + 2));
+        }
+
+        fmpz_mod_poly_multi_point_init(M, x, npoints, mod);
+        fmpz_mod_poly_multi_point_evaluate_vec(z, P, num, M);
+
+        for (k = 0; k < num; k++)
+        {
+            fmpz_mod_poly_evaluate_fmpz_vec_iter(y, P + k, x, npoints);
+
+            result = _fmpz_vec_equal(y, z[k], npoints);
+
+            if (!result)
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("mod=");
+                fmpz_print(mod);
+                flint_printf(", npoints=%wd, k=%wd\n\n", npoints, k);
+                flint_printf("P: "); fmpz_mod_poly_print(P + k);
+                flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        fmpz_mod_poly_multi_point_clear(M);
+
+        for (k = 0; k < num; k++)
+        {
+            _fmpz_vec_clear(z[k], npoints);
+            fmpz_mod_poly_clear(P + k);
+        }
+
+        flint_free(z);
+        flint_free(P);
+        fmpz_clear(mod);
+        _fmpz_vec_clear(x, npoints);
+        _fmpz_vec_clear(y, npoints);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
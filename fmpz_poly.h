@@ -55,6 +55,10 @@
 
 #define FMPZ_POLY_INV_NEWTON_CUTOFF 32
 
+#define FMPZ_POLY_MUL_THREADED_CUTOFF 256  /* Split products between threads */
+#define FMPZ_POLY_PRODUCT_ROOTS_THREADED_CUTOFF 512
+#define FMPZ_POLY_GCD_MODULAR_THREADED_CUTOFF 64
+
 /*  Type definitions *********************************************************/
 
 typedef struct
@@ -461,6 +465,9 @@ FLINT_DLL void _fmpz_poly_mul(fmpz * res, const fmpz * poly1,
 FLINT_DLL void fmpz_poly_mul(fmpz_poly_t res, 
                           const fmpz_poly_t poly1, const fmpz_poly_t poly2);
 
+FLINT_DLL void _fmpz_poly_mul_threaded(fmpz * res, const fmpz * poly1,
+           slong len1, const fmpz * poly2, slong len2, slong num_threads);
+
 FLINT_DLL void _fmpz_poly_mullow(fmpz * res, const fmpz * poly1, slong len1, 
                                      const fmpz * poly2, slong len2, slong n);
 
@@ -589,6 +596,9 @@ FLINT_DLL void _fmpz_poly_gcd_modular(fmpz * res, const fmpz * poly1, slong len1
 FLINT_DLL void fmpz_poly_gcd_modular(fmpz_poly_t res,
                            const fmpz_poly_t poly1, const fmpz_poly_t poly2);
 
+FLINT_DLL void _fmpz_poly_gcd_modular_threaded(fmpz * res, const fmpz * poly1,
+                slong len1, const fmpz * poly2, slong len2, slong num_threads);
+
 FLINT_DLL void _fmpz_poly_gcd(fmpz * res, const fmpz * poly1, slong len1, 
                                                const fmpz * poly2, slong len2);
 
@@ -1123,6 +1133,10 @@ FLINT_DLL void fmpz_poly_hensel_lift_tree_recursive(slong *link,
     fmpz_poly_t *v, fmpz_poly_t *w, fmpz_poly_t f, slong j, slong inv, 
     const fmpz_t p0, const fmpz_t p1);
 
+FLINT_DLL void fmpz_poly_hensel_lift_tree_recursive_threaded(slong *link, 
+    fmpz_poly_t *v, fmpz_poly_t *w, fmpz_poly_t f, slong j, slong inv, 
+    const fmpz_t p0, const fmpz_t p1, slong num_threads);
+
 FLINT_DLL void fmpz_poly_hensel_lift_tree(slong *link, fmpz_poly_t *v, fmpz_poly_t *w, 
     fmpz_poly_t f, slong r, const fmpz_t p, slong e0, slong e1, slong inv);
 
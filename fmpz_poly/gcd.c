@@ -53,7 +53,12 @@ _fmpz_poly_gcd(fmpz * res, const fmpz * poly1, slong len1,
                 return;
         }
 
-        _fmpz_poly_gcd_modular(res, poly1, len1, poly2, len2);
+        if (len2 >= FMPZ_POLY_GCD_MODULAR_THREADED_CUTOFF
+                && flint_get_num_threads() > 1)
+            _fmpz_poly_gcd_modular_threaded(res, poly1, len1, poly2, len2,
+                                            flint_get_num_threads());
+        else
+            _fmpz_poly_gcd_modular(res, poly1, len1, poly2, len2);
     }
 }
 
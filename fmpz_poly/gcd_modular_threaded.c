@@ -0,0 +1,443 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <pthread.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+#include "mpn_extras.h"
+
+typedef struct
+{
+    mp_ptr h;
+    slong hlen;
+    mp_limb_t p;
+    const fmpz * A;
+    slong len1;
+    const fmpz * B;
+    slong len2;
+    const fmpz * g;
+    int g_pm1;
+}
+gcd_mod_p_arg_t;
+
+typedef struct
+{
+    const fmpz * C;
+    slong clen;
+    const fmpz * A;
+    slong len1;
+    const fmpz * B;
+    slong len2;
+    int divides;
+}
+gcd_check_arg_t;
+
+typedef struct
+{
+    gcd_mod_p_arg_t * primes;
+    slong num_primes;
+    gcd_check_arg_t * check;
+}
+gcd_task_arg_t;
+
+/* Computes the gcd of A and B modulo p, scaled to have leading coeff g */
+static void
+_gcd_mod_p(gcd_mod_p_arg_t * arg)
+{
+    mp_ptr a, b;
+    mp_limb_t h_inv, g_mod;
+    nmod_t mod;
+
+    nmod_init(&mod, arg->p);
+
+    a = _nmod_vec_init(arg->len1 + arg->len2);
+    b = a + arg->len1;
+
+    _fmpz_vec_get_nmod_vec(a, arg->A, arg->len1, mod);
+    _fmpz_vec_get_nmod_vec(b, arg->B, arg->len2, mod);
+
+    arg->hlen = _nmod_poly_gcd(arg->h, a, arg->len1, b, arg->len2, mod);
+
+    if (arg->g_pm1)
+        _nmod_poly_make_monic(arg->h, arg->h, arg->hlen, mod);
+    else
+    {
+        h_inv = n_invmod(arg->h[arg->hlen - 1], mod.n);
+        g_mod = fmpz_fdiv_ui(arg->g, mod.n);
+        h_inv = n_mulmod2_preinv(h_inv, g_mod, mod.n, mod.ninv);
+        _nmod_vec_scalar_mul_nmod(arg->h, arg->h, arg->hlen, h_inv, mod);
+    }
+
+    _nmod_vec_clear(a);
+}
+
+/* Checks by trial division whether the candidate C divides A and B */
+static void
+_gcd_check(gcd_check_arg_t * arg)
+{
+    fmpz * Q = _fmpz_vec_init(arg->len1);
+
+    arg->divides = _fmpz_poly_divides(Q, arg->B, arg->len2, arg->C, arg->clen)
+                && _fmpz_poly_divides(Q, arg->A, arg->len1, arg->C, arg->clen);
+
+    _fmpz_vec_clear(Q, arg->len1);
+}
+
+static void
+_gcd_task(gcd_task_arg_t * arg)
+{
+    slong i;
+
+    if (arg->check != NULL)
+        _gcd_check(arg->check);
+
+    for (i = 0; i < arg->num_primes; i++)
+        _gcd_mod_p(arg->primes + i);
+}
+
+static void *
+_gcd_task_worker(void * arg_ptr)
+{
+    _gcd_task((gcd_task_arg_t *) arg_ptr);
+    flint_cleanup();
+    return NULL;
+}
+
+/* Divides (res, hlen) by its content, made to have the sign of the leading 
+   coefficient, which is returned in hc */
+static void
+_gcd_primitive_part(fmpz * res, fmpz_t hc, slong hlen)
+{
+    _fmpz_vec_content(hc, res, hlen);
+
+    if (fmpz_sgn(res + hlen - 1) < 0)
+        fmpz_neg(hc, hc);
+
+    _fmpz_vec_scalar_divexact_fmpz(res, res, hlen, hc);
+}
+
+void _fmpz_poly_gcd_modular_threaded(fmpz * res, const fmpz * poly1,
+                 slong len1, const fmpz * poly2, slong len2, slong num_threads)
+{
+    mp_bitcnt_t bits1, bits2, nb1, nb2, bits_small, pbits, curr_bits = 0, new_bits;   
+    fmpz_t ac, bc, hc, d, g, l, eval_A, eval_B, eval_GCD, modulus;
+    fmpz * A, * B, * C, * lead_A, * lead_B;
+    mp_ptr hbuf;
+    mp_limb_t p;
+    slong i, j, n, n0, unlucky, hlen = 0, clen = 0, bound, batch, num_tasks;
+    int g_pm1, check, done;
+    gcd_mod_p_arg_t * primes;
+    gcd_check_arg_t check_arg;
+    gcd_task_arg_t * tasks;
+    pthread_t * threads;
+
+    if (num_threads < 2)
+    {
+        _fmpz_poly_gcd_modular(res, poly1, len1, poly2, len2);
+        return;
+    }
+
+    fmpz_init(ac);
+    fmpz_init(bc);
+    fmpz_init(d);
+
+    /* compute gcd of content of poly1 and poly2 */
+    _fmpz_vec_content(ac, poly1, len1);
+    _fmpz_vec_content(bc, poly2, len2);
+    fmpz_gcd(d, ac, bc);
+
+    /* special case, one of the polys is a constant */
+    if (len2 == 1) /* if len1 == 1 then so does len2 */
+    {
+        fmpz_set(res, d);
+
+        fmpz_clear(ac);
+        fmpz_clear(bc);
+        fmpz_clear(d);
+        return;
+    }
+
+    /* divide poly1 and poly2 by their content */
+    A = _fmpz_vec_init(len1);
+    B = _fmpz_vec_init(len2);
+    _fmpz_vec_scalar_divexact_fmpz(A, poly1, len1, ac);
+    _fmpz_vec_scalar_divexact_fmpz(B, poly2, len2, bc);
+    fmpz_clear(ac);
+    fmpz_clear(bc);
+
+    /* get bound on size of gcd coefficients */
+    lead_A = A + len1 - 1;
+    lead_B = B + len2 - 1;
+
+    bits1 = _fmpz_vec_max_bits(A, len1); bits1 = FLINT_ABS(bits1);
+    bits2 = _fmpz_vec_max_bits(B, len2); bits2 = FLINT_ABS(bits2);
+
+    fmpz_init(l);
+   
+    if (len1 < 64 && len2 < 64) /* compute the squares of the 2-norms */
+    {
+        fmpz_set_ui(l, 0);
+        for (i = 0; i < len1; i++)
+            fmpz_addmul(l, A + i, A + i);
+        nb1 = fmpz_bits(l);
+        fmpz_set_ui(l, 0);
+        for (i = 0; i < len2; i++)
+            fmpz_addmul(l, B + i, B + i);
+        nb2 = fmpz_bits(l);
+    } else /* approximate to save time */
+    {
+        nb1 = 2*bits1 + FLINT_BIT_COUNT(len1);
+        nb2 = 2*bits2 + FLINT_BIT_COUNT(len2);
+    }
+
+    /* get gcd of leading coefficients */
+    fmpz_init(g);
+    fmpz_gcd(g, lead_A, lead_B);
+    fmpz_mul(l, lead_A, lead_B);
+
+    g_pm1 = fmpz_is_pm1(g);
+   
+    /* evaluate -A and -B at -1 */
+    fmpz_init(eval_A);
+    for (i = 0; i < len1; i++)
+    {
+        if (i & 1) fmpz_add(eval_A, eval_A, A + i);
+        else fmpz_sub(eval_A, eval_A, A + i);
+    }
+
+    fmpz_init(eval_B);
+    for (i = 0; i < len2; i++)
+    {
+        if (i & 1) fmpz_add(eval_B, eval_B, B + i);
+        else fmpz_sub(eval_B, eval_B, B + i);
+    }
+
+    /* compute a heuristic bound after which we should begin checking if we're done */
+    fmpz_init(eval_GCD);
+    fmpz_gcd(eval_GCD, eval_A, eval_B);
+
+    bits_small = FLINT_MAX(fmpz_bits(eval_GCD), fmpz_bits(g));
+    if (bits_small < WORD(2)) bits_small = 2;
+
+    fmpz_clear(eval_GCD);
+    fmpz_clear(eval_A);
+    fmpz_clear(eval_B);
+
+    /* set size of first prime */
+    pbits = FLINT_BITS - 1;
+    p = (UWORD(1)<<pbits);
+
+    fmpz_init(modulus);
+    fmpz_init(hc);
+
+    /* candidate gcd currently being verified */
+    C = _fmpz_vec_init(len2);
+
+    /* space for one batch of images modulo primes */
+    hbuf = _nmod_vec_init(num_threads * len2);
+    primes = flint_malloc(sizeof(gcd_mod_p_arg_t) * num_threads);
+    tasks = flint_malloc(sizeof(gcd_task_arg_t) * num_threads);
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        primes[i].h = hbuf + i * len2;
+        primes[i].A = A;
+        primes[i].len1 = len1;
+        primes[i].B = B;
+        primes[i].len2 = len2;
+        primes[i].g = g;
+        primes[i].g_pm1 = g_pm1;
+    }
+
+    check_arg.C = C;
+    check_arg.A = A;
+    check_arg.len1 = len1;
+    check_arg.B = B;
+    check_arg.len2 = len2;
+
+    _fmpz_vec_zero(res, len2);
+
+    n = len2; 
+    /* current bound on length of result, see _fmpz_poly_gcd_modular */
+    n0 = len1 - 1;
+    bound = (n0 + 3)*FLINT_MAX(nb1, nb2) + (n0 + 1); /* initialise bound */
+    unlucky = 0;
+    check = 0;
+    done = 0;
+
+    while (!done)
+    {
+        /* 
+           If a candidate is waiting to be verified, one thread runs the
+           trial divisions while the others compute further images
+        */
+        batch = num_threads - check;
+
+        for (i = 0; i < batch; )
+        {
+            p = n_nextprime(p, 0);
+            if (fmpz_fdiv_ui(l, p) == 0)
+            {
+                unlucky += pbits;
+                continue;
+            }
+            primes[i++].p = p;
+        }
+
+        num_tasks = batch + check;
+
+        for (i = check; i < num_tasks; i++)
+        {
+            tasks[i].check = NULL;
+            tasks[i].primes = primes + i - check;
+            tasks[i].num_primes = 1;
+        }
+
+        if (check)
+        {
+            tasks[0].check = &check_arg;
+            tasks[0].primes = primes;
+            tasks[0].num_primes = 0;
+        }
+
+        check_arg.clen = clen;
+
+        for (i = 1; i < num_tasks; i++)
+            pthread_create(&threads[i], NULL, _gcd_task_worker, &tasks[i]);
+
+        _gcd_task(&tasks[0]);
+
+        for (i = 1; i < num_tasks; i++)
+            pthread_join(threads[i], NULL);
+
+        if (check && check_arg.divides)
+        {
+            _fmpz_vec_set(res, C, clen);
+            _fmpz_vec_zero(res + clen, len2 - clen);
+            hlen = clen;
+            break;
+        }
+
+        check = 0;
+
+        /* incorporate the new images in order */
+        for (j = 0; j < batch && !done; j++)
+        {
+            mp_ptr h = primes[j].h;
+            slong h_len = primes[j].hlen;
+            nmod_t mod;
+
+            nmod_init(&mod, primes[j].p);
+
+            if (h_len == 1) /* gcd is 1 */
+            {
+                fmpz_one(res);
+                _fmpz_vec_zero(res + 1, len2 - 1);
+                hlen = 1;
+                done = 1;
+                break;
+            }
+
+            if (h_len > n + 1) /* discard this prime */
+            {
+                unlucky += pbits;
+                continue;
+            }
+
+            if (h_len <= n) /* we have a new bound on size of result */
+            {
+                unlucky += fmpz_bits(modulus);
+                hlen = h_len;
+                _fmpz_vec_set_nmod_vec(res, h, hlen, mod);
+                _fmpz_vec_zero(res + hlen, len2 - hlen);
+
+                curr_bits = FLINT_ABS(_fmpz_vec_max_bits(res, hlen));
+                fmpz_set_ui(modulus, mod.n);
+                n = hlen - 1;
+
+                if (!g_pm1 && pbits + unlucky >= bound) 
+                {
+                    _gcd_primitive_part(res, hc, hlen);
+                    done = 1;
+                }
+                else
+                    check = g_pm1 || pbits >= bits_small;
+
+                continue;
+            }
+
+            _fmpz_poly_CRT_ui(res, res, hlen, modulus, h, hlen, mod.n, mod.ninv, 1);
+            fmpz_mul_ui(modulus, modulus, mod.n);
+
+            new_bits = _fmpz_vec_max_bits(res, hlen);
+            new_bits = FLINT_ABS(new_bits);
+
+            if (new_bits == curr_bits || fmpz_bits(modulus) >= bits_small)
+            {
+                if (fmpz_bits(modulus) + unlucky >= bound)
+                {
+                    if (!g_pm1)
+                        _gcd_primitive_part(res, hc, hlen);
+                    done = 1;
+                }
+                else
+                    check = 1;
+            }
+
+            curr_bits = new_bits;
+        }
+
+        /* take a copy of the candidate for verification in the next round */
+        if (!done && check)
+        {
+            clen = hlen;
+            _fmpz_vec_set(C, res, clen);
+            if (!g_pm1)
+                _gcd_primitive_part(C, hc, clen);
+        }
+    }
+
+    /* finally multiply by content */
+    _fmpz_vec_scalar_mul_fmpz(res, res, hlen, d);
+
+    flint_free(threads);
+    flint_free(tasks);
+    flint_free(primes);
+    _nmod_vec_clear(hbuf);
+    _fmpz_vec_clear(C, len2);
+
+    fmpz_clear(modulus);
+    fmpz_clear(g); 
+    fmpz_clear(l); 
+    fmpz_clear(hc);
+    fmpz_clear(d);
+
+    _fmpz_vec_clear(A, len1);
+    _fmpz_vec_clear(B, len2);
+}
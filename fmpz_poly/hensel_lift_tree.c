@@ -40,7 +40,12 @@ void fmpz_poly_hensel_lift_tree(slong *link, fmpz_poly_t *v, fmpz_poly_t *w,
     fmpz_pow_ui(p0, p, e0);
     fmpz_pow_ui(p1, p, e1 - e0);
 
-    fmpz_poly_hensel_lift_tree_recursive(link, v, w, f, 2*r - 4, inv, p0, p1);
+    if (flint_get_num_threads() > 1)
+        fmpz_poly_hensel_lift_tree_recursive_threaded(link, v, w, f, 2*r - 4,
+                                      inv, p0, p1, flint_get_num_threads());
+    else
+        fmpz_poly_hensel_lift_tree_recursive(link, v, w, f, 2*r - 4,
+                                                            inv, p0, p1);
 
     fmpz_clear(p0);
     fmpz_clear(p1);
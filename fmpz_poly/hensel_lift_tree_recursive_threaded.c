@@ -0,0 +1,117 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include <pthread.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+
+typedef struct
+{
+    slong * link;
+    fmpz_poly_t * v;
+    fmpz_poly_t * w;
+    fmpz_poly_struct * f;
+    slong j;
+    slong inv;
+    const fmpz * p0;
+    const fmpz * p1;
+    slong num_threads;
+}
+hensel_lift_tree_arg_t;
+
+static void *
+_fmpz_poly_hensel_lift_tree_worker(void * arg_ptr)
+{
+    hensel_lift_tree_arg_t arg = *((hensel_lift_tree_arg_t *) arg_ptr);
+
+    fmpz_poly_hensel_lift_tree_recursive_threaded(arg.link,
+        arg.v, arg.w, arg.f, arg.j,
+        arg.inv, arg.p0, arg.p1, arg.num_threads);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void fmpz_poly_hensel_lift_tree_recursive_threaded(slong *link, 
+    fmpz_poly_t *v, fmpz_poly_t *w, fmpz_poly_t f, slong j, slong inv, 
+    const fmpz_t p0, const fmpz_t p1, slong num_threads)
+{
+    if (num_threads <= 1)
+    {
+        fmpz_poly_hensel_lift_tree_recursive(link, v, w, f, j, inv, p0, p1);
+    }
+    else if (j >= 0)
+    {
+        if (inv == 1)
+            fmpz_poly_hensel_lift(v[j], v[j + 1], w[j], w[j + 1], f, 
+                                  v[j], v[j + 1], w[j], w[j + 1], 
+                                  p0, p1);
+        else if (inv == -1)
+            fmpz_poly_hensel_lift_only_inverse(w[j], w[j+1], 
+                                 v[j], v[j+1], w[j], w[j+1], p0, p1);
+        else
+            fmpz_poly_hensel_lift_without_inverse(v[j], v[j+1], f, 
+                                                  v[j], v[j+1], w[j], w[j+1], 
+                                                  p0, p1);
+
+        /*
+            The subtrees below v[j] and v[j + 1] touch disjoint entries of
+            v and w, so they can be lifted concurrently; leaves need no work
+         */
+        if (link[j] >= 0 && link[j + 1] >= 0)
+        {
+            pthread_t thread;
+            hensel_lift_tree_arg_t arg;
+
+            arg.link = link;
+            arg.v = v;
+            arg.w = w;
+            arg.f = v[j];
+            arg.j = link[j];
+            arg.inv = inv;
+            arg.p0 = p0;
+            arg.p1 = p1;
+            arg.num_threads = num_threads / 2;
+
+            pthread_create(&thread, NULL,
+                _fmpz_poly_hensel_lift_tree_worker, &arg);
+
+            fmpz_poly_hensel_lift_tree_recursive_threaded(link, v, w,
+                v[j + 1], link[j + 1], inv, p0, p1,
+                num_threads - num_threads / 2);
+
+            pthread_join(thread, NULL);
+        }
+        else
+        {
+            fmpz_poly_hensel_lift_tree_recursive_threaded(link, v, w, v[j],
+                link[j], inv, p0, p1, num_threads);
+            fmpz_poly_hensel_lift_tree_recursive_threaded(link, v, w,
+                v[j + 1], link[j + 1], inv, p0, p1, num_threads);
+        }
+    }
+}
@@ -23,14 +23,38 @@
 
 ******************************************************************************/
 
+#include <pthread.h>
 #include <gmp.h>
 #include "flint.h"
 #include "fmpz.h"
 #include "fmpz_poly.h"
 
-void
-_fmpz_poly_product_roots_fmpz_vec(fmpz * poly, const fmpz * xs, slong n)
+typedef struct
+{
+    fmpz * poly;
+    const fmpz * xs;
+    slong n;
+    slong num_threads;
+}
+product_roots_arg_t;
+
+static void _fmpz_poly_product_roots(product_roots_arg_t * arg);
+
+static void *
+_fmpz_poly_product_roots_worker(void * arg_ptr)
+{
+    _fmpz_poly_product_roots((product_roots_arg_t *) arg_ptr);
+    flint_cleanup();
+    return NULL;
+}
+
+static void
+_fmpz_poly_product_roots(product_roots_arg_t * arg)
 {
+    fmpz * poly = arg->poly;
+    const fmpz * xs = arg->xs;
+    const slong n = arg->n;
+
     if (n == 0)
     {
         fmpz_one(poly);
@@ -53,21 +77,61 @@ _fmpz_poly_product_roots_fmpz_vec(fmpz * poly, const fmpz * xs, slong n)
     }
     else
     {
-        slong m;
+        const slong m = (n + 1) / 2;
+        product_roots_arg_t left = *arg, right = *arg;
         fmpz * tmp;
 
-        m = (n + 1) / 2;
-
         tmp = _fmpz_vec_init(n + 2);
 
-        _fmpz_poly_product_roots_fmpz_vec(tmp, xs, m);
-        _fmpz_poly_product_roots_fmpz_vec(tmp + m + 1, xs + m, n - m);
-        _fmpz_poly_mul(poly, tmp, m + 1, tmp + m + 1, n - m + 1);
+        left.poly = tmp;
+        left.n = m;
+        right.poly = tmp + m + 1;
+        right.xs = xs + m;
+        right.n = n - m;
+
+        /* the two halves are independent, so while several threads are
+           available the right half is done by a new thread */
+        if (arg->num_threads > 1
+            && n >= FMPZ_POLY_PRODUCT_ROOTS_THREADED_CUTOFF)
+        {
+            pthread_t thread;
+
+            right.num_threads = arg->num_threads / 2;
+            left.num_threads = arg->num_threads - right.num_threads;
+
+            pthread_create(&thread, NULL,
+                           _fmpz_poly_product_roots_worker, &right);
+            _fmpz_poly_product_roots(&left);
+            pthread_join(thread, NULL);
+        }
+        else
+        {
+            left.num_threads = right.num_threads = 1;
+
+            _fmpz_poly_product_roots(&left);
+            _fmpz_poly_product_roots(&right);
+        }
+
+        _fmpz_poly_mul_threaded(poly, tmp, m + 1, tmp + m + 1, n - m + 1,
+                                                      arg->num_threads);
 
         _fmpz_vec_clear(tmp, n + 2);
     }
 }
 
+void
+_fmpz_poly_product_roots_fmpz_vec(fmpz * poly, const fmpz * xs, slong n)
+{
+    product_roots_arg_t arg;
+
+    arg.poly = poly;
+    arg.xs = xs;
+    arg.n = n;
+    arg.num_threads = flint_get_num_threads();
+
+    _fmpz_poly_product_roots(&arg);
+}
+
 void
 fmpz_poly_product_roots_fmpz_vec(fmpz_poly_t poly, const fmpz * xs, slong n)
 {
@@ -23,6 +23,7 @@
    
 ******************************************************************************/
 
+#include <pthread.h>
 #include <gmp.h>
 #include "flint.h"
 #include "fmpz.h"
@@ -30,19 +31,66 @@
 #include "fmpz_poly.h"
 #include "mpn_extras.h"
 
+typedef struct
+{
+    mp_ptr rarr;
+    mp_srcptr parr;
+    const fmpz * A;
+    slong len1;
+    const fmpz * B;
+    slong len2;
+    slong k0;
+    slong k1;
+}
+resultant_modular_arg_t;
+
+static void
+_resultant_modular_range(resultant_modular_arg_t * arg)
+{
+    mp_ptr a, b;
+    nmod_t mod;
+    slong k;
+
+    a = _nmod_vec_init(arg->len1);
+    b = _nmod_vec_init(arg->len2);
+
+    for (k = arg->k0; k < arg->k1; k++)
+    {
+        nmod_init(&mod, arg->parr[k]);
+
+        /* reduce polynomials modulo p */
+        _fmpz_vec_get_nmod_vec(a, arg->A, arg->len1, mod);
+        _fmpz_vec_get_nmod_vec(b, arg->B, arg->len2, mod);
+
+        /* compute resultant over Z/pZ */
+        arg->rarr[k] = _nmod_poly_resultant(a, arg->len1, b, arg->len2, mod);
+    }
+
+    _nmod_vec_clear(a);
+    _nmod_vec_clear(b);
+}
+
+static void *
+_resultant_modular_worker(void * arg_ptr)
+{
+    _resultant_modular_range((resultant_modular_arg_t *) arg_ptr);
+    flint_cleanup();
+    return NULL;
+}
 
 void _fmpz_poly_resultant_modular(fmpz_t res, const fmpz * poly1, slong len1, 
                                         const fmpz * poly2, slong len2)
 {
     mp_bitcnt_t bits1, bits2, bound, pbits, curr_bits = 0; 
-    slong i, num_primes;
+    slong i, num_primes, num_threads;
     fmpz_comb_t comb;
     fmpz_comb_temp_t comb_temp;
-    fmpz_t ac, bc, l, modulus;
+    fmpz_t ac, bc, l;
     fmpz * A, * B, * lead_A, * lead_B;
-    mp_ptr a, b, rarr, parr;
+    mp_ptr rarr, parr;
     mp_limb_t p;
-    nmod_t mod;
+    pthread_t * threads;
+    resultant_modular_arg_t * args;
     
     /* special case, one of the polys is a constant */
     if (len2 == 1) /* if len1 == 1 then so does len2 */
@@ -91,45 +139,54 @@ void _fmpz_poly_resultant_modular(fmpz_t res, const fmpz * poly1, slong len1,
     parr = _nmod_vec_init(num_primes);
     rarr = _nmod_vec_init(num_primes);
 
-    fmpz_init(modulus);
-    fmpz_set_ui(modulus, 1);
-    fmpz_zero(res);
-
-    /* make space for polynomials mod p */
-    a = _nmod_vec_init(len1);
-    b = _nmod_vec_init(len2);
-    
+    /* select primes not dividing the product of the leading coefficients */
     for (i = 0; curr_bits < bound; )
     {
-        /* get new prime and initialise modulus */
         p = n_nextprime(p, 0);
         if (fmpz_fdiv_ui(l, p) == 0)
             continue;
         
         curr_bits += pbits;
+        parr[i++] = p;
+    }
 
-        nmod_init(&mod, p);
+    /* compute the resultants modulo each prime, sharing primes among threads */
+    num_threads = FLINT_MAX(1, FLINT_MIN(flint_get_num_threads(), num_primes));
 
-        /* reduce polynomials modulo p */
-        _fmpz_vec_get_nmod_vec(a, A, len1, mod);
-        _fmpz_vec_get_nmod_vec(b, B, len2, mod);
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(resultant_modular_arg_t) * num_threads);
 
-        /* compute resultant over Z/pZ */
-        parr[i] = p;
-        rarr[i++] = _nmod_poly_resultant(a, len1, b, len2, mod);
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].rarr = rarr;
+        args[i].parr = parr;
+        args[i].A = A;
+        args[i].len1 = len1;
+        args[i].B = B;
+        args[i].len2 = len2;
+        args[i].k0 = (i * num_primes) / num_threads;
+        args[i].k1 = ((i + 1) * num_primes) / num_threads;
     }
 
+    for (i = 1; i < num_threads; i++)
+        pthread_create(&threads[i], NULL, _resultant_modular_worker, &args[i]);
+
+    _resultant_modular_range(&args[0]);
+
+    for (i = 1; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+
+    /* reconstruct the resultant from all residues with a single CRT tree */
     fmpz_comb_init(comb, parr, num_primes);
     fmpz_comb_temp_init(comb_temp, comb);
     
     fmpz_multi_CRT_ui(res, rarr, comb, comb_temp, 1);
         
-    fmpz_clear(modulus);
     fmpz_comb_temp_clear(comb_temp);
     fmpz_comb_clear(comb);
-        
-    _nmod_vec_clear(a);
-    _nmod_vec_clear(b);
 
     _nmod_vec_clear(parr);
     _nmod_vec_clear(rarr);
@@ -0,0 +1,107 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+    
+    flint_printf("gcd_modular_threaded....");
+    fflush(stdout);
+
+    /* Compare with the single threaded version, with a common factor */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t a, b, c, d, e;
+        slong num_threads, len1, len2;
+
+        fmpz_poly_init(a);
+        fmpz_poly_init(b);
+        fmpz_poly_init(c);
+        fmpz_poly_init(d);
+        fmpz_poly_init(e);
+
+        fmpz_poly_randtest(a, state, n_randint(state, 60), 1 + n_randint(state, 200));
+        fmpz_poly_randtest(b, state, n_randint(state, 60), 1 + n_randint(state, 200));
+        fmpz_poly_randtest(c, state, n_randint(state, 30), 1 + n_randint(state, 200));
+        if (n_randint(state, 4) != 0)
+        {
+            fmpz_poly_mul(a, a, c);
+            fmpz_poly_mul(b, b, c);
+        }
+
+        if (a->length < b->length)
+            fmpz_poly_swap(a, b);
+
+        num_threads = 2 + n_randint(state, 7);
+        len1 = a->length;
+        len2 = b->length;
+
+        fmpz_poly_gcd_modular(d, a, b);
+
+        if (len2 == 0)
+            fmpz_poly_set(e, d);
+        else
+        {
+            fmpz_poly_fit_length(e, len2);
+            _fmpz_poly_gcd_modular_threaded(e->coeffs, a->coeffs, len1,
+                                            b->coeffs, len2, num_threads);
+            _fmpz_poly_set_length(e, len2);
+            _fmpz_poly_normalise(e);
+        }
+
+        result = (fmpz_poly_equal(d, e));
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("num_threads = %wd\n", num_threads);
+            fmpz_poly_print(a), flint_printf("\n\n");
+            fmpz_poly_print(b), flint_printf("\n\n");
+            fmpz_poly_print(d), flint_printf("\n\n");
+            fmpz_poly_print(e), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(b);
+        fmpz_poly_clear(c);
+        fmpz_poly_clear(d);
+        fmpz_poly_clear(e);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -85,6 +85,40 @@ main(void)
         _fmpz_vec_clear(x, n);
     }
 
+    /* check threaded against one thread */
+    for (i = 0; i < 5 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t P, Q;
+        fmpz * x;
+        slong n, bits;
+
+        n = n_randint(state, 3 * FMPZ_POLY_PRODUCT_ROOTS_THREADED_CUTOFF);
+        bits = n_randint(state, 10);
+
+        x = _fmpz_vec_init(n);
+        _fmpz_vec_randtest(x, state, n, bits);
+
+        fmpz_poly_init(P);
+        fmpz_poly_init(Q);
+
+        flint_set_num_threads(2 + n_randint(state, 7));
+        fmpz_poly_product_roots_fmpz_vec(P, x, n);
+        flint_set_num_threads(1);
+        fmpz_poly_product_roots_fmpz_vec(Q, x, n);
+
+        result = (fmpz_poly_equal(P, Q));
+        if (!result)
+        {
+            flint_printf("FAIL (threaded):\n");
+            flint_printf("n = %wd\n", n);
+            abort();
+        }
+
+        fmpz_poly_clear(P);
+        fmpz_poly_clear(Q);
+        _fmpz_vec_clear(x, n);
+    }
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
@@ -119,6 +119,41 @@ main(void)
         fmpz_poly_clear(p);
     }
 
+    /* Check that the threaded and single threaded resultants agree */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        fmpz_t a, b;
+        fmpz_poly_t f, g;
+
+        fmpz_init(a);
+        fmpz_init(b);
+        fmpz_poly_init(f);
+        fmpz_poly_init(g);
+        fmpz_poly_randtest(f, state, n_randint(state, 100), 200);
+        fmpz_poly_randtest(g, state, n_randint(state, 100), 200);
+
+        flint_set_num_threads(2 + n_randint(state, 7));
+        fmpz_poly_resultant_modular(a, f, g);
+        flint_set_num_threads(1);
+        fmpz_poly_resultant_modular(b, f, g);
+
+        result = (fmpz_equal(a, b));
+        if (!result)
+        {
+            flint_printf("FAIL (threaded):\n");
+            flint_printf("f(x) = "), fmpz_poly_print_pretty(f, "x"), flint_printf("\n\n");
+            flint_printf("g(x) = "), fmpz_poly_print_pretty(g, "x"), flint_printf("\n\n");
+            flint_printf("a = "), fmpz_print(a), flint_printf("\n\n");
+            flint_printf("b = "), fmpz_print(b), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_clear(a);
+        fmpz_clear(b);
+        fmpz_poly_clear(f);
+        fmpz_poly_clear(g);
+    }
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
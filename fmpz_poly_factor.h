@@ -74,6 +74,13 @@ FLINT_DLL void fmpz_poly_factor_zassenhaus_recombination(fmpz_poly_factor_t fina
 	const fmpz_poly_factor_t lifted_fac, 
     const fmpz_poly_t F, const fmpz_t P, slong exp);
     
+FLINT_DLL void _fmpz_poly_factor_mignotte(fmpz_t B, const fmpz * f, slong m);
+
+FLINT_DLL void fmpz_poly_factor_mignotte(fmpz_t B, const fmpz_poly_t f);
+
+FLINT_DLL void fmpz_poly_factor_van_hoeij(fmpz_poly_factor_t final_fac,
+    const nmod_poly_factor_t fac, const fmpz_poly_t f, slong exp, ulong p);
+
 FLINT_DLL void fmpz_poly_factor_squarefree(fmpz_poly_factor_t fac, const fmpz_poly_t F);
 
 FLINT_DLL void _fmpz_poly_factor_zassenhaus(fmpz_poly_factor_t final_fac, 
@@ -81,6 +88,10 @@ FLINT_DLL void _fmpz_poly_factor_zassenhaus(fmpz_poly_factor_t final_fac,
 
 FLINT_DLL void fmpz_poly_factor_zassenhaus(fmpz_poly_factor_t fac, const fmpz_poly_t G);
 
+#define FMPZ_POLY_FACTOR_VAN_HOEIJ_CUTOFF 6
+
+FLINT_DLL void fmpz_poly_factor(fmpz_poly_factor_t fac, const fmpz_poly_t G);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,351 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include "fmpz_poly.h"
+#include "fmpz_mat.h"
+#include "fmpz_lll.h"
+
+/* Number of times the precision is doubled before giving up on the
+   lattice and falling back to exhaustive recombination */
+#define VAN_HOEIJ_MAX_LIFTS 16
+
+/*
+    Sets row i of T to the first T->c power sums lc^j Tr_j(g_i) modulo P
+    of the roots of the monic lifted factor g_i, using Newton's identities.
+ */
+static void
+_fmpz_poly_factor_van_hoeij_traces(fmpz_mat_t T,
+    const fmpz_poly_factor_t lifted_fac, const fmpz_t lc, const fmpz_t P)
+{
+    const slong N = T->c;
+    slong i, j, k, d;
+    fmpz_t c;
+
+    fmpz_init(c);
+
+    for (i = 0; i < lifted_fac->num; i++)
+    {
+        const fmpz * g = (lifted_fac->p + i)->coeffs;
+        fmpz * tr = T->rows[i];
+
+        d = (lifted_fac->p + i)->length - 1;
+
+        for (k = 1; k <= N; k++)
+        {
+            fmpz * s = tr + k - 1;
+
+            if (k <= d)
+                fmpz_mul_si(s, g + d - k, -k);
+            else
+                fmpz_zero(s);
+
+            for (j = 1; j < k && j <= d; j++)
+                fmpz_submul(s, g + d - j, tr + k - j - 1);
+
+            fmpz_mod(s, s, P);
+        }
+
+        fmpz_one(c);
+        for (k = 0; k < N; k++)
+        {
+            fmpz_mul(c, c, lc);
+            fmpz_mod(c, c, P);
+            fmpz_mul(tr + k, tr + k, c);
+            fmpz_mod(tr + k, tr + k, P);
+        }
+    }
+
+    fmpz_clear(c);
+}
+
+/*
+    If the columns of the d x r matrix U fall into exactly d classes of
+    equal columns, tries the corresponding partition of the lifted factors.
+    When every part gives a factor of f, these are the irreducible factors
+    of f; they are then appended to final_fac and 1 is returned.
+ */
+static int
+_fmpz_poly_factor_van_hoeij_try(fmpz_poly_factor_t final_fac,
+    const fmpz_mat_t U, slong d, const fmpz_poly_factor_t lifted_fac,
+    const fmpz_poly_t f, const fmpz_t P, slong exp)
+{
+    const slong r = lifted_fac->num;
+    slong i, j, k, num;
+    slong * part;
+    fmpz_poly_factor_t fac;
+    fmpz_poly_t F, G, Q, R;
+    int success = 1;
+
+    if (d == 1)
+    {
+        fmpz_poly_factor_insert(final_fac, f, exp);
+        return 1;
+    }
+
+    part = flint_malloc(sizeof(slong) * r);
+    num = 0;
+
+    for (i = 0; i < r; i++)
+    {
+        for (j = 0; j < i; j++)
+        {
+            for (k = 0; k < d; k++)
+                if (!fmpz_equal(fmpz_mat_entry(U, k, i),
+                                fmpz_mat_entry(U, k, j)))
+                    break;
+
+            if (k == d)
+                break;
+        }
+
+        part[i] = (j < i) ? part[j] : num++;
+    }
+
+    if (num != d)
+    {
+        flint_free(part);
+        return 0;
+    }
+
+    fmpz_poly_factor_init(fac);
+    fmpz_poly_init(F);
+    fmpz_poly_init(G);
+    fmpz_poly_init(Q);
+    fmpz_poly_init(R);
+
+    fmpz_poly_set(F, f);
+
+    for (k = 0; k < num - 1 && success; k++)
+    {
+        fmpz_poly_set_fmpz(G, fmpz_poly_lead(F));
+
+        for (i = 0; i < r; i++)
+        {
+            if (part[i] == k)
+            {
+                fmpz_poly_mul(G, G, lifted_fac->p + i);
+                fmpz_poly_scalar_smod_fmpz(G, G, P);
+            }
+        }
+
+        fmpz_poly_primitive_part(G, G);
+        fmpz_poly_divrem(Q, R, F, G);
+
+        if (fmpz_poly_is_zero(R))
+        {
+            fmpz_poly_factor_insert(fac, G, exp);
+            fmpz_poly_swap(F, Q);
+        }
+        else
+            success = 0;
+    }
+
+    if (success)
+    {
+        fmpz_poly_factor_insert(fac, F, exp);
+        fmpz_poly_factor_concat(final_fac, fac);
+    }
+
+    fmpz_poly_clear(F);
+    fmpz_poly_clear(G);
+    fmpz_poly_clear(Q);
+    fmpz_poly_clear(R);
+    fmpz_poly_factor_clear(fac);
+    flint_free(part);
+
+    return success;
+}
+
+void
+fmpz_poly_factor_van_hoeij(fmpz_poly_factor_t final_fac,
+    const nmod_poly_factor_t fac, const fmpz_poly_t f, slong exp, ulong p)
+{
+    const slong r = fac->num, n = f->length - 1;
+    slong a, d, i, j, k, prev, lifts, hbits;
+    slong * link;
+    fmpz_poly_t * v, * w;
+    fmpz_poly_factor_t lifted_fac;
+    fmpz_mat_t U, T, M;
+    fmpz_t P, P2, B, C, gs_B, pp;
+    fmpz_lll_t fl;
+
+    link = flint_malloc((2*r - 2) * sizeof(slong));
+    v    = flint_malloc(2*(2*r - 2) * sizeof(fmpz_poly_t));
+    w    = v + (2*r - 2);
+
+    for (i = 0; i < 2*r - 2; i++)
+    {
+        fmpz_poly_init(v[i]);
+        fmpz_poly_init(w[i]);
+    }
+
+    fmpz_init(P);
+    fmpz_init(P2);
+    fmpz_init(B);
+    fmpz_init(C);
+    fmpz_init(gs_B);
+    fmpz_init_set_ui(pp, p);
+
+    fmpz_poly_factor_init(lifted_fac);
+    fmpz_mat_init(U, r, r);
+    fmpz_mat_init(T, r, n);
+    fmpz_mat_one(U);
+    fmpz_lll_context_init_default(fl);
+
+    /*
+        By Fujiwara's bound, the roots of f are bounded in absolute value
+        by R = 2 max_k |a_{n-k} / a_n|^{1/k}. For a factor g of f,
+        lc(f)^j Tr_j(g) is then an integer bounded by n (|lc(f)| R)^j, and
+        we write b_j for the number of bits of this bound. The precision
+        must also allow the factors themselves to be recovered, so it is
+        at least twice lc(f) times the Mignotte bound.
+     */
+    hbits = 0;
+    for (k = 1; k <= n; k++)
+    {
+        slong e = fmpz_bits(f->coeffs + n - k)
+                - fmpz_bits(fmpz_poly_lead(f)) + 1;
+
+        if (e > 0)
+            hbits = FLINT_MAX(hbits, (e + k - 1) / k);
+    }
+    hbits += 1 + fmpz_bits(fmpz_poly_lead(f));
+
+    fmpz_poly_factor_mignotte(B, f);
+    fmpz_mul(B, B, fmpz_poly_lead(f));
+    fmpz_abs(B, B);
+    fmpz_mul_ui(B, B, 2);
+    fmpz_add_ui(B, B, 1);
+    a = fmpz_clog_ui(B, p);
+    a = FLINT_MAX(a, (FLINT_BIT_COUNT(n) + hbits + r + 20)
+                                                / FLINT_BIT_COUNT(p) + 1);
+
+    prev = _fmpz_poly_hensel_start_lift(lifted_fac, link, v, w, f, fac, a);
+    fmpz_pow_ui(P, pp, a);
+    _fmpz_poly_factor_van_hoeij_traces(T, lifted_fac, fmpz_poly_lead(f), P);
+
+    d = r;
+    j = 1;
+    lifts = 0;
+
+    while (!_fmpz_poly_factor_van_hoeij_try(final_fac, U, d,
+                                                lifted_fac, f, P, exp))
+    {
+        slong bmax;
+        fmpz * x;
+
+        /* Add the next trace if it is known to sufficient precision */
+        if (j > n || (slong) fmpz_bits(P) < FLINT_BIT_COUNT(n)
+                                                  + j * hbits + d + 20)
+        {
+            if (lifts == VAN_HOEIJ_MAX_LIFTS)
+            {
+                fmpz_poly_factor_zassenhaus_recombination(final_fac,
+                                                   lifted_fac, f, P, exp);
+                break;
+            }
+
+            /* Double the precision and start over with the first trace */
+            prev = _fmpz_poly_hensel_continue_lift(lifted_fac,
+                                        link, v, w, f, prev, a, 2 * a, pp);
+            a = 2 * a;
+            fmpz_pow_ui(P, pp, a);
+            _fmpz_poly_factor_van_hoeij_traces(T, lifted_fac,
+                                               fmpz_poly_lead(f), P);
+            lifts++;
+            j = 1;
+            continue;
+        }
+
+        /*
+            Lattice spanned by the rows (C u_k, u_k . t_j) for the rows
+            u_k of U, together with the row (0, P), where C = 2^{b_j}.
+            The vector (C e_S, Tr_j(g_S)) of a true factor with local
+            factors S has squared norm at most (r + 1) C^2, and is kept
+            by LLL with removals.
+         */
+        bmax = FLINT_BIT_COUNT(n) + j * hbits;
+
+        fmpz_mat_init(M, d + 1, r + 1);
+        fmpz_fdiv_q_2exp(P2, P, 1);
+        fmpz_one(C);
+        fmpz_mul_2exp(C, C, bmax);
+
+        for (k = 0; k < d; k++)
+        {
+            for (i = 0; i < r; i++)
+                fmpz_mul(fmpz_mat_entry(M, k, i),
+                         fmpz_mat_entry(U, k, i), C);
+
+            x = fmpz_mat_entry(M, k, r);
+            for (i = 0; i < r; i++)
+                fmpz_addmul(x, fmpz_mat_entry(U, k, i),
+                               fmpz_mat_entry(T, i, j - 1));
+
+            fmpz_mod(x, x, P);
+            if (fmpz_cmp(x, P2) > 0)
+                fmpz_sub(x, x, P);
+        }
+
+        fmpz_set(fmpz_mat_entry(M, d, r), P);
+
+        fmpz_mul(gs_B, C, C);
+        fmpz_mul_ui(gs_B, gs_B, r + 1);
+
+        d = fmpz_lll_with_removal(M, NULL, gs_B, fl);
+
+        fmpz_mat_clear(U);
+        fmpz_mat_init(U, d, r);
+
+        for (k = 0; k < d; k++)
+            for (i = 0; i < r; i++)
+                fmpz_fdiv_q_2exp(fmpz_mat_entry(U, k, i),
+                                 fmpz_mat_entry(M, k, i), bmax);
+
+        fmpz_mat_clear(M);
+        j++;
+    }
+
+    fmpz_mat_clear(U);
+    fmpz_mat_clear(T);
+    fmpz_poly_factor_clear(lifted_fac);
+
+    fmpz_clear(P);
+    fmpz_clear(P2);
+    fmpz_clear(B);
+    fmpz_clear(C);
+    fmpz_clear(gs_B);
+    fmpz_clear(pp);
+
+    for (i = 0; i < 2*r - 2; i++)
+    {
+        fmpz_poly_clear(v[i]);
+        fmpz_poly_clear(w[i]);
+    }
+
+    flint_free(link);
+    flint_free(v);
+}
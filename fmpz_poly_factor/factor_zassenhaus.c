@@ -25,80 +25,112 @@
 ******************************************************************************/
 
 #include <stdlib.h>
+#include <pthread.h>
 #include "fmpz_poly.h"
 
 #define TRACE_ZASSENHAUS 0
 
-/*
-    Let $f$ be a polynomial of degree $m = \deg(f) \geq 2$. 
-    If another polynomial $g$ divides $f$ then, for all 
-    $0 \leq j \leq \deg(g)$, 
-    \begin{equation*}
-    \abs{b_j} \leq \binom{n-1}{j} \abs{f} + \binom{n-1}{j-1} \abs{a_m}
-    \end{equation*}
-    where $\abs{f}$ denotes the $2$-norm of $f$.  This bound 
-    is due to Mignotte, see e.g., Cohen p.\ 134.
-
-    This function sets $B$ such that, for all $0 \leq j \leq \deg(g)$, 
-    $\abs{b_j} \leq B$.
-
-    Consequently, when proceeding with Hensel lifting, we 
-    proceed to choose an $a$ such that $p^a \geq 2 B + 1$, 
-    e.g., $a = \ceil{\log_p(2B + 1)}$.
-
-    Note that the formula degenerates for $j = 0$ and $j = n$ 
-    and so in this case we use that the leading (resp.\ constant) 
-    term of $g$ divides the leading (resp.\ constant) term of $f$.
- */
-static void _fmpz_poly_factor_mignotte(fmpz_t B, const fmpz *f, slong m)
+/* Minimum number of primes tried */
+#define ZASSENHAUS_PRIMES 3
+
+typedef struct
 {
-    slong j;
-    fmpz_t b, f2, lc, s, t;
+    nmod_poly_factor_struct * facs;
+    nmod_poly_struct * polys;
+    slong num;
+    slong * next;
+    int * stop;
+    pthread_mutex_t * mutex;
+}
+zassenhaus_prime_arg_t;
 
-    fmpz_init(b);
-    fmpz_init(f2);
-    fmpz_init(lc);
-    fmpz_init(s);
-    fmpz_init(t);
+static void *
+_fmpz_poly_factor_zassenhaus_worker(void * arg_ptr)
+{
+    zassenhaus_prime_arg_t arg = *((zassenhaus_prime_arg_t *) arg_ptr);
+    slong i;
 
-    for (j = 0; j <= m; j++)
-        fmpz_addmul(f2, f + j, f + j);
-    fmpz_sqrt(f2, f2);
-    fmpz_add_ui(f2, f2, 1);
+    while (1)
+    {
+        pthread_mutex_lock(arg.mutex);
+        i = *arg.next;
+        if (*arg.stop || i >= arg.num)
+        {
+            pthread_mutex_unlock(arg.mutex);
+            break;
+        }
+        (*arg.next)++;
+        pthread_mutex_unlock(arg.mutex);
 
-    fmpz_abs(lc, f + m);
+        nmod_poly_factor(arg.facs + i, arg.polys + i);
 
-    fmpz_abs(B, f + 0);
+        /* No prime can do better than an irreducible reduction */
+        if (arg.facs[i].num == 1)
+        {
+            pthread_mutex_lock(arg.mutex);
+            *arg.stop = 1;
+            pthread_mutex_unlock(arg.mutex);
+        }
+    }
 
-    /*  We have $b = \binom{m-1}{j-1}$ on loop entry and 
-        $b = \binom{m-1}{j}$ on exit. */
-    fmpz_set_ui(b, m-1);
-    for (j = 1; j < m; j++)
-    {
-        fmpz_mul(t, b, lc);
+    flint_cleanup();
+    return NULL;
+}
+
+/*
+    Factors polys[i] into facs[i] for i = 0, ..., num - 1, stopping early
+    once some polys[i] is found to be irreducible; entries of facs that
+    are not computed are left with zero factors.
+ */
+static void
+_fmpz_poly_factor_zassenhaus_factor_primes(nmod_poly_factor_struct * facs,
+               nmod_poly_struct * polys, slong num, slong num_threads)
+{
+    slong i, next = 0;
+    int stop = 0;
+
+    num_threads = FLINT_MIN(num_threads, num);
 
-        fmpz_mul_ui(b, b, m - j);
-        fmpz_divexact_ui(b, b, j);
+    if (num_threads <= 1)
+    {
+        for (i = 0; i < num; i++)
+        {
+            nmod_poly_factor(facs + i, polys + i);
 
-        fmpz_mul(s, b, f2);
-        fmpz_add(s, s, t);
-        if (fmpz_cmp(B, s) < 0)
-            fmpz_set(B, s);
+            if (facs[i].num == 1)
+                break;
+        }
     }
+    else
+    {
+        pthread_t * threads;
+        zassenhaus_prime_arg_t * args;
+        pthread_mutex_t mutex;
 
-    if (fmpz_cmp(B, lc) < 0)
-        fmpz_set(B, lc);
+        threads = flint_malloc(sizeof(pthread_t) * num_threads);
+        args = flint_malloc(sizeof(zassenhaus_prime_arg_t) * num_threads);
+        pthread_mutex_init(&mutex, NULL);
 
-    fmpz_clear(b);
-    fmpz_clear(f2);
-    fmpz_clear(lc);
-    fmpz_clear(s);
-    fmpz_clear(t);
-}
+        for (i = 0; i < num_threads; i++)
+        {
+            args[i].facs = facs;
+            args[i].polys = polys;
+            args[i].num = num;
+            args[i].next = &next;
+            args[i].stop = &stop;
+            args[i].mutex = &mutex;
+
+            pthread_create(&threads[i], NULL,
+                _fmpz_poly_factor_zassenhaus_worker, &args[i]);
+        }
 
-static void fmpz_poly_factor_mignotte(fmpz_t B, const fmpz_poly_t f)
-{
-    _fmpz_poly_factor_mignotte(B, f->coeffs, f->length - 1);
+        for (i = 0; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
+
+        pthread_mutex_destroy(&mutex);
+        flint_free(threads);
+        flint_free(args);
+    }
 }
 
 void _fmpz_poly_factor_zassenhaus(fmpz_poly_factor_t final_fac, 
@@ -117,18 +149,28 @@ void _fmpz_poly_factor_zassenhaus(fmpz_poly_factor_t final_fac,
     }
     else
     {
-        slong i;
+        slong i, best = 0;
         slong r = lenF;
+        slong num_primes, num_threads = flint_get_num_threads();
         mp_limb_t p = 2;
-        nmod_poly_t d, g, t;
+        nmod_poly_t d, g;
+        nmod_poly_struct * polys;
+        nmod_poly_factor_struct * facs;
         nmod_poly_factor_t fac;
 
-        nmod_poly_factor_init(fac);
-        nmod_poly_init_preinv(t, 1, 0);
+        /*
+            Collect candidate primes p for which f mod p has the same
+            degree and is squarefree; with several threads available,
+            more candidates can be factored at no extra cost in time
+         */
+        num_primes = FLINT_MAX(ZASSENHAUS_PRIMES, num_threads);
+        polys = flint_malloc(sizeof(nmod_poly_struct) * num_primes);
+        facs = flint_malloc(sizeof(nmod_poly_factor_struct) * num_primes);
+
         nmod_poly_init_preinv(d, 1, 0);
         nmod_poly_init_preinv(g, 1, 0);
 
-        for (i = 0; i < 3; i++)
+        for (i = 0; i < num_primes; i++)
         {
             for ( ; ; p = n_nextprime(p, 0))
             {
@@ -137,47 +179,62 @@ void _fmpz_poly_factor_zassenhaus(fmpz_poly_factor_t final_fac,
                 nmod_init(&mod, p);
                 d->mod = mod;
                 g->mod = mod;
-                t->mod = mod;
 
-                fmpz_poly_get_nmod_poly(t, f);
-                if (t->length == lenF)
+                nmod_poly_init_preinv(polys + i, mod.n, mod.ninv);
+                fmpz_poly_get_nmod_poly(polys + i, f);
+
+                if (polys[i].length == lenF)
                 {
-                    nmod_poly_derivative(d, t);
-                    nmod_poly_gcd(g, t, d);
+                    nmod_poly_derivative(d, polys + i);
+                    nmod_poly_gcd(g, polys + i, d);
 
                     if (nmod_poly_is_one(g))
-                    {
-                        nmod_poly_factor_t temp_fac;
-
-                        nmod_poly_factor_init(temp_fac);
-                        nmod_poly_factor(temp_fac, t);
-
-                        if (temp_fac->num <= r)
-                        {
-                            r = temp_fac->num;
-                            nmod_poly_factor_set(fac, temp_fac);
-                        }
-                        nmod_poly_factor_clear(temp_fac);
                         break;
-                    }
                 }
+
+                nmod_poly_clear(polys + i);
             }
+
+            nmod_poly_factor_init(facs + i);
             p = n_nextprime(p, 0);
         }
+
         nmod_poly_clear(d);
         nmod_poly_clear(g);
-        nmod_poly_clear(t);
 
-        if (r > cutoff)
+        _fmpz_poly_factor_zassenhaus_factor_primes(facs, polys,
+                                                   num_primes, num_threads);
+
+        for (i = 0; i < num_primes; i++)
         {
-            flint_printf("Exception (fmpz_poly_factor_zassenhaus). r > cutoff.\n");
-            nmod_poly_factor_clear(fac);
-            abort();
+            if (facs[i].num != 0 && facs[i].num <= r)
+            {
+                r = facs[i].num;
+                best = i;
+            }
         }
-        else if (r == 1)
+
+        nmod_poly_factor_init(fac);
+        nmod_poly_factor_set(fac, facs + best);
+
+        for (i = 0; i < num_primes; i++)
+        {
+            nmod_poly_clear(polys + i);
+            nmod_poly_factor_clear(facs + i);
+        }
+
+        flint_free(polys);
+        flint_free(facs);
+
+        if (r == 1)
         {
             fmpz_poly_factor_insert(final_fac, f, exp);
         }
+        else if (r > cutoff)
+        {
+            fmpz_poly_factor_van_hoeij(final_fac, fac, f, exp,
+                                                  (fac->p + 0)->mod.n);
+        }
         else
         {
             slong a;
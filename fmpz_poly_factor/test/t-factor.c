@@ -0,0 +1,212 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "fmpz_poly.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("factor....");
+    fflush(stdout);
+
+    /* Random products */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        fmpz_t c;
+        fmpz_poly_t f, g, h, t;
+        fmpz_poly_factor_t fac, fac2;
+        slong j, n = n_randint(state, 7);
+
+        fmpz_init(c);
+        fmpz_poly_init(f);
+        fmpz_poly_init(g);
+        fmpz_poly_init(h);
+        fmpz_poly_init(t);
+        fmpz_poly_factor_init(fac);
+
+        fmpz_randtest_not_zero(c, state, n_randint(state, 10) + 1);
+        fmpz_poly_set_fmpz(f, c);
+
+        for (j = 0; j < n; j++)
+        {
+            fmpz_poly_randtest(g, state, n_randint(state, 10) + 2, n_randint(state, 40));
+            fmpz_poly_mul(f, f, g);
+        }
+
+        fmpz_poly_factor(fac, f);
+
+        fmpz_poly_set_fmpz(h, &fac->c);
+        for (j = 0; j < fac->num; j++)
+        {
+            fmpz_poly_pow(t, fac->p + j, fac->exp[j]);
+            fmpz_poly_mul(h, h, t);
+        }
+
+        result = fmpz_poly_equal(f, h);
+        if (!result)
+        {
+            flint_printf("FAIL (product):\n");
+            flint_printf("f = "), fmpz_poly_print(f), flint_printf("\n\n");
+            flint_printf("h = "), fmpz_poly_print(h), flint_printf("\n\n");
+            flint_printf("fac = "), fmpz_poly_factor_print(fac), flint_printf("\n\n");
+            abort();
+        }
+
+        /* The factors are irreducible */
+        for (j = 0; j < fac->num; j++)
+        {
+            fmpz_poly_factor_init(fac2);
+            fmpz_poly_factor(fac2, fac->p + j);
+
+            result = (fac2->num == 1 && fac2->exp[0] == 1);
+            if (!result)
+            {
+                flint_printf("FAIL (irreducible):\n");
+                flint_printf("f = "), fmpz_poly_print(f), flint_printf("\n\n");
+                flint_printf("fac = "), fmpz_poly_factor_print(fac), flint_printf("\n\n");
+                abort();
+            }
+
+            fmpz_poly_factor_clear(fac2);
+        }
+
+        fmpz_clear(c);
+        fmpz_poly_clear(f);
+        fmpz_poly_clear(g);
+        fmpz_poly_clear(h);
+        fmpz_poly_clear(t);
+        fmpz_poly_factor_clear(fac);
+    }
+
+    /* Threaded prime selection and Hensel lifting agree with serial code */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t f, g, h, t;
+        fmpz_poly_factor_t fac, fac2;
+        slong j, n = n_randint(state, 8) + 1;
+
+        fmpz_poly_init(f);
+        fmpz_poly_init(g);
+        fmpz_poly_init(h);
+        fmpz_poly_init(t);
+        fmpz_poly_factor_init(fac);
+        fmpz_poly_factor_init(fac2);
+
+        fmpz_poly_one(f);
+
+        for (j = 0; j < n; j++)
+        {
+            fmpz_poly_randtest(g, state, n_randint(state, 20) + 2, n_randint(state, 40));
+            fmpz_poly_mul(f, f, g);
+        }
+
+        flint_set_num_threads(1);
+        fmpz_poly_factor(fac, f);
+
+        flint_set_num_threads(n_randint(state, 6) + 2);
+        fmpz_poly_factor(fac2, f);
+        flint_set_num_threads(1);
+
+        fmpz_poly_set_fmpz(h, &fac2->c);
+        for (j = 0; j < fac2->num; j++)
+        {
+            fmpz_poly_pow(t, fac2->p + j, fac2->exp[j]);
+            fmpz_poly_mul(h, h, t);
+        }
+
+        result = (fac->num == fac2->num && fmpz_equal(&fac->c, &fac2->c)
+                  && fmpz_poly_equal(f, h));
+        if (!result)
+        {
+            flint_printf("FAIL (threaded):\n");
+            flint_printf("f = "), fmpz_poly_print(f), flint_printf("\n\n");
+            flint_printf("fac = "), fmpz_poly_factor_print(fac), flint_printf("\n\n");
+            flint_printf("fac2 = "), fmpz_poly_factor_print(fac2), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_poly_clear(f);
+        fmpz_poly_clear(g);
+        fmpz_poly_clear(h);
+        fmpz_poly_clear(t);
+        fmpz_poly_factor_clear(fac);
+        fmpz_poly_factor_clear(fac2);
+    }
+
+    /* Products of shifted Swinnerton-Dyer polynomials, which have many
+       local factors but are irreducible */
+    for (i = 0; i < 50 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t f, g, s;
+        fmpz_poly_factor_t fac;
+        slong j, n = n_randint(state, 3) + 1;
+
+        fmpz_poly_init(f);
+        fmpz_poly_init(g);
+        fmpz_poly_init(s);
+        fmpz_poly_factor_init(fac);
+
+        fmpz_poly_one(f);
+
+        for (j = 0; j < n; j++)
+        {
+            fmpz_poly_swinnerton_dyer(g, n_randint(state, 4) + 2);
+            fmpz_poly_set_coeff_ui(s, 1, 1);
+            fmpz_poly_set_coeff_ui(s, 0, 3 * j);
+            fmpz_poly_compose(g, g, s);
+            fmpz_poly_mul(f, f, g);
+        }
+
+        fmpz_poly_factor(fac, f);
+
+        result = (fac->num == n);
+        for (j = 0; j < fac->num; j++)
+            result = result && (fac->exp[j] == 1);
+
+        if (!result)
+        {
+            flint_printf("FAIL (Swinnerton-Dyer):\n");
+            flint_printf("f = "), fmpz_poly_print(f), flint_printf("\n\n");
+            flint_printf("fac = "), fmpz_poly_factor_print(fac), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_poly_clear(f);
+        fmpz_poly_clear(g);
+        fmpz_poly_clear(s);
+        fmpz_poly_factor_clear(fac);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
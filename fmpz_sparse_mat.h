@@ -0,0 +1,118 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#ifndef FMPZ_SPARSE_MAT_H
+#define FMPZ_SPARSE_MAT_H
+
+#ifdef FMPZ_SPARSE_MAT_INLINES_C
+#define FMPZ_SPARSE_MAT_INLINE FLINT_DLL
+#else
+#define FMPZ_SPARSE_MAT_INLINE static __inline__
+#endif
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdlib.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mat.h"
+#include "nmod_sparse_mat.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*
+   Sparse integer matrices in compressed sparse row format, stored as
+   for nmod_sparse_mat: the nonzero entries of row i are entries[k] in
+   columns cols[k] for row_starts[i] <= k < row_starts[i + 1].
+*/
+typedef struct
+{
+    fmpz * entries;
+    slong * cols;
+    slong * row_starts;
+    slong r;
+    slong c;
+    slong nnz;
+}
+fmpz_sparse_mat_struct;
+
+typedef fmpz_sparse_mat_struct fmpz_sparse_mat_t[1];
+
+FMPZ_SPARSE_MAT_INLINE
+slong fmpz_sparse_mat_nrows(const fmpz_sparse_mat_t mat)
+{
+   return mat->r;
+}
+
+FMPZ_SPARSE_MAT_INLINE
+slong fmpz_sparse_mat_ncols(const fmpz_sparse_mat_t mat)
+{
+   return mat->c;
+}
+
+FMPZ_SPARSE_MAT_INLINE
+slong fmpz_sparse_mat_nnz(const fmpz_sparse_mat_t mat)
+{
+   return mat->nnz;
+}
+
+/* Memory management */
+
+FLINT_DLL void fmpz_sparse_mat_init(fmpz_sparse_mat_t mat,
+                                                    slong rows, slong cols);
+FLINT_DLL void fmpz_sparse_mat_clear(fmpz_sparse_mat_t mat);
+
+/* Conversions */
+
+FLINT_DLL void fmpz_sparse_mat_set_triplets(fmpz_sparse_mat_t mat,
+       const slong * rows, const slong * cols, const fmpz * vals, slong len);
+FLINT_DLL void fmpz_sparse_mat_set_fmpz_mat(fmpz_sparse_mat_t B,
+                                                        const fmpz_mat_t A);
+FLINT_DLL void fmpz_sparse_mat_get_fmpz_mat(fmpz_mat_t B,
+                                                const fmpz_sparse_mat_t A);
+FLINT_DLL void fmpz_sparse_mat_get_nmod_sparse_mat(nmod_sparse_mat_t B,
+                                                const fmpz_sparse_mat_t A);
+
+/* Matrix-vector multiplication */
+
+FLINT_DLL void fmpz_sparse_mat_mul_vec(fmpz * y,
+                               const fmpz_sparse_mat_t A, const fmpz * x);
+FLINT_DLL void _fmpz_sparse_mat_mul_vec(fmpz * y, const fmpz_sparse_mat_t A,
+                                        const fmpz * x, slong r0, slong r1);
+FLINT_DLL void fmpz_sparse_mat_mul_vec_threaded(fmpz * y,
+                               const fmpz_sparse_mat_t A, const fmpz * x);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,42 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz_sparse_mat.h"
+
+void
+fmpz_sparse_mat_get_fmpz_mat(fmpz_mat_t B, const fmpz_sparse_mat_t A)
+{
+    slong i, k;
+
+    fmpz_mat_zero(B);
+
+    for (i = 0; i < A->r; i++)
+        for (k = A->row_starts[i]; k < A->row_starts[i + 1]; k++)
+            fmpz_add(fmpz_mat_entry(B, i, A->cols[k]),
+                     fmpz_mat_entry(B, i, A->cols[k]), A->entries + k);
+}
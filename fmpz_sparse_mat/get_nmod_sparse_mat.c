@@ -0,0 +1,75 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz_sparse_mat.h"
+
+void
+fmpz_sparse_mat_get_nmod_sparse_mat(nmod_sparse_mat_t B,
+                                                const fmpz_sparse_mat_t A)
+{
+    slong i, k, nnz;
+    mp_limb_t v;
+
+    if (B->entries)
+    {
+        flint_free(B->entries);
+        flint_free(B->cols);
+        B->entries = NULL;
+        B->cols = NULL;
+    }
+
+    B->nnz = 0;
+
+    if (A->nnz != 0)
+    {
+        B->entries = flint_malloc(sizeof(mp_limb_t) * A->nnz);
+        B->cols = flint_malloc(sizeof(slong) * A->nnz);
+    }
+
+    /* entries divisible by the modulus are dropped */
+    nnz = 0;
+    for (i = 0; i < A->r; i++)
+    {
+        B->row_starts[i] = nnz;
+
+        for (k = A->row_starts[i]; k < A->row_starts[i + 1]; k++)
+        {
+            v = fmpz_fdiv_ui(A->entries + k, B->mod.n);
+
+            if (v != 0)
+            {
+                B->entries[nnz] = v;
+                B->cols[nnz] = A->cols[k];
+                nnz++;
+            }
+        }
+    }
+
+    B->row_starts[A->r] = nnz;
+    B->nnz = nnz;
+}
@@ -0,0 +1,50 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz_sparse_mat.h"
+
+void
+_fmpz_sparse_mat_mul_vec(fmpz * y, const fmpz_sparse_mat_t A,
+                                      const fmpz * x, slong r0, slong r1)
+{
+    slong i, k;
+
+    for (i = r0; i < r1; i++)
+    {
+        fmpz_zero(y + i);
+
+        for (k = A->row_starts[i]; k < A->row_starts[i + 1]; k++)
+            fmpz_addmul(y + i, A->entries + k, x + A->cols[k]);
+    }
+}
+
+void
+fmpz_sparse_mat_mul_vec(fmpz * y, const fmpz_sparse_mat_t A, const fmpz * x)
+{
+    _fmpz_sparse_mat_mul_vec(y, A, x, 0, A->r);
+}
@@ -0,0 +1,74 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz_sparse_mat.h"
+
+void
+fmpz_sparse_mat_set_fmpz_mat(fmpz_sparse_mat_t B, const fmpz_mat_t A)
+{
+    slong i, j, k, nnz;
+
+    if (B->entries)
+    {
+        _fmpz_vec_clear(B->entries, B->nnz);
+        flint_free(B->cols);
+        B->entries = NULL;
+        B->cols = NULL;
+    }
+
+    nnz = 0;
+    for (i = 0; i < A->r; i++)
+        for (j = 0; j < A->c; j++)
+            nnz += !fmpz_is_zero(fmpz_mat_entry(A, i, j));
+
+    B->nnz = nnz;
+
+    if (nnz != 0)
+    {
+        B->entries = _fmpz_vec_init(nnz);
+        B->cols = flint_malloc(sizeof(slong) * nnz);
+    }
+
+    k = 0;
+    for (i = 0; i < A->r; i++)
+    {
+        B->row_starts[i] = k;
+
+        for (j = 0; j < A->c; j++)
+        {
+            if (!fmpz_is_zero(fmpz_mat_entry(A, i, j)))
+            {
+                fmpz_set(B->entries + k, fmpz_mat_entry(A, i, j));
+                B->cols[k] = j;
+                k++;
+            }
+        }
+    }
+
+    B->row_starts[A->r] = k;
+}
@@ -0,0 +1,98 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("get_nmod_sparse_mat....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        fmpz_sparse_mat_t A;
+        nmod_sparse_mat_t Amod;
+        fmpz_mat_t B;
+        nmod_mat_t C, D;
+        mp_limb_t mod;
+        slong m, n, j;
+
+        m = n_randint(state, 50);
+        n = n_randint(state, 50);
+        mod = n_randtest_not_zero(state);
+
+        fmpz_sparse_mat_init(A, m, n);
+        nmod_sparse_mat_init(Amod, m, n, mod);
+        fmpz_mat_init(B, m, n);
+        nmod_mat_init(C, m, n, mod);
+        nmod_mat_init(D, m, n, mod);
+
+        fmpz_mat_randtest(B, state, 1 + n_randint(state, 200));
+        fmpz_sparse_mat_set_fmpz_mat(A, B);
+
+        for (j = 0; j < 2; j++)
+            fmpz_sparse_mat_get_nmod_sparse_mat(Amod, A);
+
+        fmpz_mat_get_nmod_mat(C, B);
+        nmod_sparse_mat_get_nmod_mat(D, Amod);
+
+        for (j = 0; j < Amod->nnz; j++)
+        {
+            if (Amod->entries[j] == 0 || Amod->entries[j] >= mod)
+            {
+                flint_printf("FAIL: entry not reduced\n");
+                abort();
+            }
+        }
+
+        if (!nmod_mat_equal(C, D) || Amod->nnz > A->nnz)
+        {
+            flint_printf("FAIL: results not equal\n");
+            nmod_mat_print_pretty(C);
+            nmod_mat_print_pretty(D);
+            abort();
+        }
+
+        fmpz_sparse_mat_clear(A);
+        nmod_sparse_mat_clear(Amod);
+        fmpz_mat_clear(B);
+        nmod_mat_clear(C);
+        nmod_mat_clear(D);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,99 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_vec....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        fmpz_sparse_mat_t A;
+        fmpz_mat_t B, X, Y;
+        fmpz * x, * y, * z;
+        slong m, n, j;
+
+        m = n_randint(state, 50);
+        n = n_randint(state, 50);
+
+        fmpz_sparse_mat_init(A, m, n);
+        fmpz_mat_init(B, m, n);
+        fmpz_mat_init(X, n, 1);
+        fmpz_mat_init(Y, m, 1);
+        x = _fmpz_vec_init(n);
+        y = _fmpz_vec_init(m);
+        z = _fmpz_vec_init(m);
+
+        fmpz_mat_randtest(B, state, 1 + n_randint(state, 200));
+        fmpz_mat_randtest(X, state, 1 + n_randint(state, 200));
+        for (j = 0; j < n; j++)
+            fmpz_set(x + j, fmpz_mat_entry(X, j, 0));
+
+        fmpz_sparse_mat_set_fmpz_mat(A, B);
+
+        fmpz_mat_mul(Y, B, X);
+        fmpz_sparse_mat_mul_vec(y, A, x);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+        fmpz_sparse_mat_mul_vec_threaded(z, A, x);
+        flint_set_num_threads(1);
+
+        for (j = 0; j < m; j++)
+        {
+            if (!fmpz_equal(y + j, fmpz_mat_entry(Y, j, 0))
+                || !fmpz_equal(z + j, y + j))
+            {
+                flint_printf("FAIL: results not equal\n");
+                fmpz_mat_print_pretty(B);
+                fmpz_mat_print_pretty(X);
+                abort();
+            }
+        }
+
+        fmpz_sparse_mat_clear(A);
+        fmpz_mat_clear(B);
+        fmpz_mat_clear(X);
+        fmpz_mat_clear(Y);
+        _fmpz_vec_clear(x, n);
+        _fmpz_vec_clear(y, m);
+        _fmpz_vec_clear(z, m);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
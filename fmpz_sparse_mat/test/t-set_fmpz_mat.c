@@ -0,0 +1,85 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("set_fmpz_mat....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        fmpz_sparse_mat_t A;
+        fmpz_mat_t B, C;
+        slong m, n, j, k, nnz;
+
+        m = n_randint(state, 50);
+        n = n_randint(state, 50);
+
+        fmpz_sparse_mat_init(A, m, n);
+        fmpz_mat_init(B, m, n);
+        fmpz_mat_init(C, m, n);
+
+        fmpz_mat_randtest(B, state, 1 + n_randint(state, 200));
+
+        /* set twice, to check that old entries are released */
+        fmpz_sparse_mat_set_fmpz_mat(A, C);
+        fmpz_sparse_mat_set_fmpz_mat(A, B);
+        fmpz_sparse_mat_get_fmpz_mat(C, A);
+
+        nnz = 0;
+        for (j = 0; j < m; j++)
+            for (k = 0; k < n; k++)
+                nnz += !fmpz_is_zero(fmpz_mat_entry(B, j, k));
+
+        if (!fmpz_mat_equal(B, C) || fmpz_sparse_mat_nnz(A) != nnz
+            || fmpz_sparse_mat_nrows(A) != m || fmpz_sparse_mat_ncols(A) != n)
+        {
+            flint_printf("FAIL: results not equal\n");
+            fmpz_mat_print_pretty(B);
+            fmpz_mat_print_pretty(C);
+            abort();
+        }
+
+        fmpz_sparse_mat_clear(A);
+        fmpz_mat_clear(B);
+        fmpz_mat_clear(C);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
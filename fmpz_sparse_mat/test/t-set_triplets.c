@@ -0,0 +1,96 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("set_triplets....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        fmpz_sparse_mat_t A;
+        fmpz_mat_t B, C;
+        slong m, n, j, len;
+        slong * rows, * cols;
+        fmpz * vals;
+
+        m = n_randint(state, 50) + 1;
+        n = n_randint(state, 50) + 1;
+        len = n_randint(state, 3 * m);
+
+        fmpz_sparse_mat_init(A, m, n);
+        fmpz_mat_init(B, m, n);
+        fmpz_mat_init(C, m, n);
+
+        rows = flint_malloc(sizeof(slong) * (len + 1));
+        cols = flint_malloc(sizeof(slong) * (len + 1));
+        vals = _fmpz_vec_init(len + 1);
+
+        /* repeated positions are summed */
+        for (j = 0; j < len; j++)
+        {
+            rows[j] = n_randint(state, m);
+            cols[j] = n_randint(state, n);
+            fmpz_randtest(vals + j, state, 100);
+
+            fmpz_add(fmpz_mat_entry(B, rows[j], cols[j]),
+                     fmpz_mat_entry(B, rows[j], cols[j]), vals + j);
+        }
+
+        fmpz_sparse_mat_set_triplets(A, rows, cols, vals, len);
+        fmpz_sparse_mat_get_fmpz_mat(C, A);
+
+        if (!fmpz_mat_equal(B, C) || A->nnz > len)
+        {
+            flint_printf("FAIL: results not equal\n");
+            fmpz_mat_print_pretty(B);
+            fmpz_mat_print_pretty(C);
+            abort();
+        }
+
+        flint_free(rows);
+        flint_free(cols);
+        _fmpz_vec_clear(vals, len + 1);
+        fmpz_sparse_mat_clear(A);
+        fmpz_mat_clear(B);
+        fmpz_mat_clear(C);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -30,49 +30,32 @@
 
 #include "fq.h"
 
-/* from qadic/ctx_init_conway.c */
-extern int flint_conway_polynomials [];
+/* from qadic/conway_lookup.c */
+extern const int * _qadic_conway_lookup(const fmpz_t p, slong d);
 
 int
 _fq_ctx_init_conway(fq_ctx_t ctx, const fmpz_t p, slong d, const char *var)
 {
-    unsigned int position;
+    const int * coeffs;
+    fmpz_mod_poly_t mod;
+    slong i;
 
-    if (fmpz_cmp_ui(p, 109987) > 0)
-    {
-        return 0;
-    }
+    coeffs = _qadic_conway_lookup(p, d);
 
-    for (position = 0; flint_conway_polynomials[position] != 0; position += 3+flint_conway_polynomials[position+1])
-    {
-        /* Different prime? */
-        if (fmpz_cmp_ui(p, flint_conway_polynomials[position]))
-            continue;
-
-        /* Same degree? */
-        if (d == flint_conway_polynomials[position+1])
-        {
-            fmpz_mod_poly_t mod;
-            slong i;
-
-            fmpz_mod_poly_init(mod, p);
+    if (coeffs == NULL)
+        return 0;
 
-            /* Copy the polynomial */
+    fmpz_mod_poly_init(mod, p);
 
-            for (i = 0; i < d; i++)
-            {
-                int coeff = flint_conway_polynomials[position+2+i];
-                fmpz_mod_poly_set_coeff_ui(mod, i, coeff);
-            }
-            fmpz_mod_poly_set_coeff_ui(mod, d, 1);
+    /* Copy the polynomial */
+    for (i = 0; i < d; i++)
+        fmpz_mod_poly_set_coeff_ui(mod, i, coeffs[i]);
+    fmpz_mod_poly_set_coeff_ui(mod, d, 1);
 
-            fq_ctx_init_modulus(ctx, mod, var);
+    fq_ctx_init_modulus(ctx, mod, var);
 
-            fmpz_mod_poly_clear(mod);
-            return 1;
-        }
-    }
-    return 0;
+    fmpz_mod_poly_clear(mod);
+    return 1;
 }
 
 void
@@ -73,6 +73,13 @@ FLINT_DLL void fq_nmod_ctx_init(fq_nmod_ctx_t ctx,
 FLINT_DLL int _fq_nmod_ctx_init_conway(fq_nmod_ctx_t ctx,
                              const fmpz_t p, slong d, const char *var);
 
+#define FQ_NMOD_CTX_CACHE_MAX 64
+
+FLINT_DLL int _fq_nmod_ctx_init_cached(fq_nmod_ctx_t ctx, const fmpz_t p,
+                              slong d, const char *var, int conway_only);
+
+FLINT_DLL void fq_nmod_ctx_cache_clear(void);
+
 FLINT_DLL void fq_nmod_ctx_init_conway(fq_nmod_ctx_t ctx,
                              const fmpz_t p, slong d, const char *var);
 
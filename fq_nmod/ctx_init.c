@@ -31,21 +31,5 @@
 
 void fq_nmod_ctx_init(fq_nmod_ctx_t ctx, const fmpz_t p, slong d, const char *var)
 {
-    flint_rand_t state;
-    nmod_poly_t poly;
-
-    if (_fq_nmod_ctx_init_conway(ctx, p, d, var))
-    {
-        return;
-    }
-    
-    flint_randinit(state);
-
-    nmod_poly_init2(poly, fmpz_get_ui(p), d + 1);
-    nmod_poly_randtest_sparse_irreducible(poly, state, d + 1);
-
-    fq_nmod_ctx_init_modulus(ctx, poly, var);
-
-    nmod_poly_clear(poly);
-    flint_randclear(state);    
+    _fq_nmod_ctx_init_cached(ctx, p, d, var, 0);
 }
@@ -0,0 +1,230 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <pthread.h>
+
+#include "fq_nmod.h"
+#include "nmod_poly.h"
+
+/* from qadic/conway_lookup.c */
+extern const int * _qadic_conway_lookup(const fmpz_t p, slong d);
+
+/*
+    Process-wide cache of the moduli of contexts keyed by (p, d), holding
+    at most FQ_NMOD_CTX_CACHE_MAX entries. It is freed by
+    fq_nmod_ctx_cache_clear() or flint_cleanup_master(), but not by the
+    flint_cleanup() of a thread, as other threads may still use it.
+*/
+typedef struct fq_nmod_ctx_cache_entry_struct
+{
+    slong d;
+    int conway;
+    nmod_poly_t modulus;
+    struct fq_nmod_ctx_cache_entry_struct * next;
+} fq_nmod_ctx_cache_entry_struct;
+
+static fq_nmod_ctx_cache_entry_struct * _fq_nmod_ctx_cache = NULL;
+static slong _fq_nmod_ctx_cache_num = 0;
+
+static pthread_mutex_t _fq_nmod_ctx_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Whether x generates (F_p[x]/(f))^*, where f is irreducible of degree d */
+static int
+_fq_nmod_modulus_is_primitive(const nmod_poly_t f, mp_limb_t qm1)
+{
+    n_factor_t fac;
+    nmod_poly_t x, r;
+    int i, result = 1;
+
+    n_factor_init(&fac);
+    n_factor(&fac, qm1, 1);
+
+    nmod_poly_init(x, f->mod.n);
+    nmod_poly_init(r, f->mod.n);
+    nmod_poly_set_coeff_ui(x, 1, 1);
+
+    for (i = 0; i < fac.num && result; i++)
+    {
+        nmod_poly_powmod_ui_binexp(r, x, qm1 / fac.p[i], f);
+        result = !nmod_poly_is_one(r);
+    }
+
+    nmod_poly_clear(x);
+    nmod_poly_clear(r);
+
+    return result;
+}
+
+/*
+    Conway polynomial if known, otherwise a sparse irreducible modulus,
+    chosen primitive whenever q fits in a limb. Deterministic in (p, d).
+*/
+static void
+_fq_nmod_ctx_cache_modulus(nmod_poly_t f, const fmpz_t p, slong d, int * conway)
+{
+    const int * coeffs;
+    mp_limb_t up = fmpz_get_ui(p);
+    slong i;
+
+    coeffs = _qadic_conway_lookup(p, d);
+    *conway = (coeffs != NULL);
+
+    if (coeffs != NULL)
+    {
+        for (i = 0; i < d; i++)
+            nmod_poly_set_coeff_ui(f, i, coeffs[i]);
+        nmod_poly_set_coeff_ui(f, d, 1);
+    }
+    else if (d == 1)
+    {
+        nmod_poly_set_coeff_ui(f, 0, up - n_primitive_root_prime(up));
+        nmod_poly_set_coeff_ui(f, 1, 1);
+    }
+    else
+    {
+        flint_rand_t state;
+        fmpz_t q;
+        int primitive;
+
+        fmpz_init(q);
+        fmpz_pow_ui(q, p, d);
+        primitive = (fmpz_bits(q) <= FLINT_BITS);
+
+        flint_randinit(state);
+
+        do
+        {
+            nmod_poly_randtest_sparse_irreducible(f, state, d + 1);
+            nmod_poly_make_monic(f, f);
+        } while (primitive &&
+                 !_fq_nmod_modulus_is_primitive(f, fmpz_get_ui(q) - 1));
+
+        flint_randclear(state);
+        fmpz_clear(q);
+    }
+}
+
+static fq_nmod_ctx_cache_entry_struct *
+_fq_nmod_ctx_cache_find(const fmpz_t p, slong d)
+{
+    fq_nmod_ctx_cache_entry_struct * e;
+
+    for (e = _fq_nmod_ctx_cache; e != NULL; e = e->next)
+        if (e->d == d && e->modulus->mod.n == fmpz_get_ui(p))
+            return e;
+
+    return NULL;
+}
+
+int
+_fq_nmod_ctx_init_cached(fq_nmod_ctx_t ctx, const fmpz_t p, slong d,
+                         const char *var, int conway_only)
+{
+    fq_nmod_ctx_cache_entry_struct * e, * f = NULL;
+    nmod_poly_t mod;
+    int result, inserted = 0;
+
+    nmod_poly_init(mod, fmpz_get_ui(p));
+
+    pthread_mutex_lock(&_fq_nmod_ctx_cache_lock);
+    e = _fq_nmod_ctx_cache_find(p, d);
+
+    if (e == NULL)
+    {
+        pthread_mutex_unlock(&_fq_nmod_ctx_cache_lock);
+
+        if (conway_only && _qadic_conway_lookup(p, d) == NULL)
+        {
+            nmod_poly_clear(mod);
+            return 0;
+        }
+
+        f = flint_malloc(sizeof(fq_nmod_ctx_cache_entry_struct));
+        f->d = d;
+        nmod_poly_init(f->modulus, fmpz_get_ui(p));
+        _fq_nmod_ctx_cache_modulus(f->modulus, p, d, &f->conway);
+
+        /* another thread may have inserted the same entry meanwhile */
+        pthread_mutex_lock(&_fq_nmod_ctx_cache_lock);
+        e = _fq_nmod_ctx_cache_find(p, d);
+        if (e == NULL)
+        {
+            e = f;
+
+            if (_fq_nmod_ctx_cache_num < FQ_NMOD_CTX_CACHE_MAX)
+            {
+                f->next = _fq_nmod_ctx_cache;
+                _fq_nmod_ctx_cache = f;
+                _fq_nmod_ctx_cache_num++;
+                f = NULL;
+                inserted = 1;
+            }
+        }
+    }
+
+    result = !conway_only || e->conway;
+
+    if (result)
+        nmod_poly_set(mod, e->modulus);
+
+    pthread_mutex_unlock(&_fq_nmod_ctx_cache_lock);
+
+    /* outside the lock, as flint_cleanup_master() calls back into this
+       file while holding its own lock */
+    if (inserted)
+        flint_register_master_cleanup_function(fq_nmod_ctx_cache_clear);
+
+    if (f != NULL)
+    {
+        nmod_poly_clear(f->modulus);
+        flint_free(f);
+    }
+
+    if (result)
+        fq_nmod_ctx_init_modulus(ctx, mod, var);
+
+    nmod_poly_clear(mod);
+
+    return result;
+}
+
+void
+fq_nmod_ctx_cache_clear(void)
+{
+    fq_nmod_ctx_cache_entry_struct * e, * next;
+
+    pthread_mutex_lock(&_fq_nmod_ctx_cache_lock);
+    e = _fq_nmod_ctx_cache;
+    _fq_nmod_ctx_cache = NULL;
+    _fq_nmod_ctx_cache_num = 0;
+    pthread_mutex_unlock(&_fq_nmod_ctx_cache_lock);
+
+    for ( ; e != NULL; e = next)
+    {
+        next = e->next;
+        nmod_poly_clear(e->modulus);
+        flint_free(e);
+    }
+}
@@ -30,49 +30,14 @@
 
 #include "fq_nmod.h"
 
-/* from qadic/ctx_init_conway.c */
-extern int flint_conway_polynomials [];
-
 int _fq_nmod_ctx_init_conway(fq_nmod_ctx_t ctx, const fmpz_t p, slong d, const char *var)
 {
-    unsigned int position;
-
     if (fmpz_cmp_ui(p, 109987) > 0)
     {
         return 0;
     }
 
-    for (position = 0; flint_conway_polynomials[position] != 0; position += 3+flint_conway_polynomials[position+1])
-    {
-        /* Different prime? */
-        if (fmpz_cmp_ui(p, flint_conway_polynomials[position]))
-            continue;
-
-        /* Same degree? */
-        if (d == flint_conway_polynomials[position+1])
-        {
-            nmod_poly_t mod;
-            slong i;
-
-            nmod_poly_init(mod, fmpz_get_ui(p));
-            
-            /* Copy the polynomial */
-            for (i = 0; i < d; i++)
-            {
-                int coeff = flint_conway_polynomials[position+2+i];                
-                nmod_poly_set_coeff_ui(mod, i, coeff);
-            }
-
-            nmod_poly_set_coeff_ui(mod, d, 1);
-
-            fq_nmod_ctx_init_modulus(ctx, mod, var);
-
-            nmod_poly_clear(mod);
-            return 1;
-        }
-    }
-
-    return 0;
+    return _fq_nmod_ctx_init_cached(ctx, p, d, var, 1);
 }
 
 
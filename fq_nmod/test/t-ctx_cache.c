@@ -0,0 +1,196 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fq_nmod.h"
+#include "ulong_extras.h"
+#include "long_extras.h"
+
+typedef struct
+{
+    fmpz * p;
+    slong d;
+    nmod_poly_struct * modulus;
+}
+ctx_arg_t;
+
+/* initialises a context from the cache, then exits as a thread should */
+static void *
+_ctx_worker(void * arg_ptr)
+{
+    ctx_arg_t * arg = (ctx_arg_t *) arg_ptr;
+    fq_nmod_ctx_t ctx;
+
+    fq_nmod_ctx_init(ctx, arg->p, arg->d, "a");
+    nmod_poly_set(arg->modulus, ctx->modulus);
+    fq_nmod_ctx_clear(ctx);
+
+    flint_cleanup();
+    return NULL;
+}
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("ctx_cache... ");
+    fflush(stdout);
+
+    /* Check repeated initialisation gives the same, irreducible modulus */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p, q;
+        slong d;
+        fq_nmod_ctx_t ctx1, ctx2;
+        fq_nmod_t a, b;
+
+        if (n_randint(state, 4) == 0)
+            fmpz_init_set_ui(p, n_nextprime(UWORD(109987) + n_randint(state, 1000), 1));
+        else
+            fmpz_init_set_ui(p, n_randprime(state, 2 + n_randint(state, 5), 1));
+        d = n_randint(state, 8) + 1;
+
+        fq_nmod_ctx_init(ctx1, p, d, "a");
+        fq_nmod_ctx_init(ctx2, p, d, "b");
+
+        result = (fq_nmod_ctx_degree(ctx1) == d
+                  && nmod_poly_equal(ctx1->modulus, ctx2->modulus)
+                  && nmod_poly_equal(ctx1->inv, ctx2->inv)
+                  && nmod_poly_is_irreducible(ctx1->modulus)
+                  && strcmp(ctx2->var, "b") == 0);
+        if (!result)
+        {
+            flint_printf("FAIL (repeat):\n\n");
+            fq_nmod_ctx_print(ctx1), flint_printf("\n");
+            fq_nmod_ctx_print(ctx2), flint_printf("\n");
+            abort();
+        }
+
+        /* the generator is primitive when q fits in a limb */
+        fmpz_init(q);
+        fmpz_pow_ui(q, p, d);
+        if (fmpz_bits(q) <= FLINT_BITS && d > 1)
+        {
+            n_factor_t fac;
+            slong k;
+            fmpz_t e;
+
+            fmpz_init(e);
+            fq_nmod_init(a, ctx1);
+            fq_nmod_init(b, ctx1);
+            fq_nmod_gen(a, ctx1);
+
+            n_factor_init(&fac);
+            n_factor(&fac, fmpz_get_ui(q) - 1, 1);
+
+            for (k = 0; k < fac.num && result; k++)
+            {
+                fmpz_set_ui(e, (fmpz_get_ui(q) - 1) / fac.p[k]);
+                fq_nmod_pow(b, a, e, ctx1);
+                result = !fq_nmod_is_one(b, ctx1);
+            }
+
+            if (!result)
+            {
+                flint_printf("FAIL (primitive):\n\n");
+                fq_nmod_ctx_print(ctx1), flint_printf("\n");
+                abort();
+            }
+
+            fq_nmod_clear(a, ctx1);
+            fq_nmod_clear(b, ctx1);
+            fmpz_clear(e);
+        }
+
+        fq_nmod_ctx_clear(ctx1);
+        fq_nmod_ctx_clear(ctx2);
+        fmpz_clear(p);
+        fmpz_clear(q);
+
+        if (n_randint(state, 50) == 0)
+            fq_nmod_ctx_cache_clear();
+        else if (n_randint(state, 50) == 0)
+            flint_cleanup();
+        else if (n_randint(state, 50) == 0)
+            flint_cleanup_master();
+    }
+
+    /* Check contexts created in short-lived threads agree with the main
+       thread, the threads' flint_cleanup() leaving the cache alone */
+    for (i = 0; i < 20 * flint_test_multiplier(); i++)
+    {
+        pthread_t threads[4];
+        ctx_arg_t args[4];
+        nmod_poly_struct moduli[4];
+        fmpz_t p;
+        slong d, k;
+        fq_nmod_ctx_t ctx;
+
+        fmpz_init_set_ui(p, n_randprime(state, 2 + n_randint(state, 5), 1));
+        d = n_randint(state, 8) + 1;
+
+        for (k = 0; k < 4; k++)
+        {
+            nmod_poly_init(moduli + k, fmpz_get_ui(p));
+            args[k].p = p;
+            args[k].d = d;
+            args[k].modulus = moduli + k;
+            pthread_create(threads + k, NULL, _ctx_worker, args + k);
+        }
+
+        fq_nmod_ctx_init(ctx, p, d, "a");
+
+        for (k = 0; k < 4; k++)
+            pthread_join(threads[k], NULL);
+
+        for (k = 0; k < 4; k++)
+        {
+            if (!nmod_poly_equal(moduli + k, ctx->modulus))
+            {
+                flint_printf("FAIL (threads):\n\n");
+                fq_nmod_ctx_print(ctx), flint_printf("\n");
+                nmod_poly_print(moduli + k), flint_printf("\n");
+                abort();
+            }
+
+            nmod_poly_clear(moduli + k);
+        }
+
+        fq_nmod_ctx_clear(ctx);
+        fmpz_clear(p);
+    }
+
+    /* the cache is freed by flint_cleanup_master() */
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -53,10 +53,24 @@ int FQ_NMOD_MAT_MUL_KS_CUTOFF(slong r, slong c, const fq_nmod_ctx_t ctx)
         return 0;
 }
 
+/* Cutoff between classical and slice (nmod_mat) multiplication */
+#define FQ_NMOD_MAT_MUL_SLICES_CUTOFF 16
+
 #define T fq_nmod
 #define CAP_T FQ_NMOD
 #include "fq_mat_templates.h"
 #undef CAP_T
 #undef T
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+FLINT_DLL void fq_nmod_mat_mul_slices(fq_nmod_mat_t C, const fq_nmod_mat_t A,
+                               const fq_nmod_mat_t B, const fq_nmod_ctx_t ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif
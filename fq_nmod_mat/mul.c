@@ -20,17 +20,23 @@
 /******************************************************************************
 
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2016 The FLINT team
 
 ******************************************************************************/
 
 #include "fq_nmod_mat.h"
 
-#ifdef T
-#undef T
-#endif
-
-#define T fq_nmod
-#define CAP_T FQ_NMOD
-#include "fq_mat_templates/mul.c"
-#undef CAP_T
-#undef T
+void
+fq_nmod_mat_mul(fq_nmod_mat_t C, const fq_nmod_mat_t A, const fq_nmod_mat_t B,
+                const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+    const slong dim = FLINT_MIN(FLINT_MIN(A->r, A->c), B->c);
+
+    if (dim <= FQ_NMOD_MAT_MUL_SLICES_CUTOFF)
+        fq_nmod_mat_mul_classical(C, A, B, ctx);
+    else if (ctx->mod.n >= (mp_limb_t) (2 * d - 1) || d <= 8)
+        fq_nmod_mat_mul_slices(C, A, B, ctx);
+    else
+        fq_nmod_mat_mul_KS(C, A, B, ctx);
+}
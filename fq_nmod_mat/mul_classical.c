@@ -20,17 +20,66 @@
 /******************************************************************************
 
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2016 The FLINT team
 
 ******************************************************************************/
 
 #include "fq_nmod_mat.h"
+#include "fq_nmod_vec.h"
 
-#ifdef T
-#undef T
-#endif
+void
+fq_nmod_mat_mul_classical(fq_nmod_mat_t C, const fq_nmod_mat_t A,
+                          const fq_nmod_mat_t B, const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+    slong ar, bc, br;
+    slong i, j, k;
+    mp_ptr Ap, Bp, R;
 
-#define T fq_nmod
-#define CAP_T FQ_NMOD
-#include "fq_mat_templates/mul_classical.c"
-#undef CAP_T
-#undef T
+    ar = A->r;
+    br = B->r;
+    bc = B->c;
+
+    if (br == 0)
+    {
+        fq_nmod_mat_zero(C, ctx);
+        return;
+    }
+
+    if (C == A || C == B)
+    {
+        fq_nmod_mat_t T;
+        fq_nmod_mat_init(T, ar, bc, ctx);
+        fq_nmod_mat_mul_classical(T, A, B, ctx);
+        fq_nmod_mat_swap(C, T, ctx);
+        fq_nmod_mat_clear(T, ctx);
+        return;
+    }
+
+    if (ar == 0 || bc == 0)
+        return;
+
+    /* rows of A and columns of B as packed vectors */
+    Ap = _nmod_vec_init((ar * br + bc * br + 1) * d);
+    Bp = Ap + ar * br * d;
+    R = Bp + bc * br * d;
+
+    for (i = 0; i < ar; i++)
+        _fq_nmod_vec_pack(Ap + i * br * d, A->rows[i], br, ctx);
+
+    for (k = 0; k < br; k++)
+        for (j = 0; j < bc; j++)
+            _fq_nmod_vec_pack(Bp + (j * br + k) * d, B->rows[k] + j, 1, ctx);
+
+    for (i = 0; i < ar; i++)
+    {
+        for (j = 0; j < bc; j++)
+        {
+            _fq_nmod_vec_dot_packed(R, Ap + i * br * d, d,
+                                    Bp + j * br * d, d, br, ctx);
+            _fq_nmod_vec_unpack(fq_nmod_mat_entry(C, i, j), R, 1, ctx);
+        }
+    }
+
+    _nmod_vec_clear(Ap);
+}
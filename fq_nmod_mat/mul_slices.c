@@ -0,0 +1,219 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include "fq_nmod_mat.h"
+#include "fq_nmod_vec.h"
+#include "nmod_mat.h"
+
+/*
+    Sets the rows of PC (of length npts = 2d - 1) to the coefficients of the
+    unreduced products of the entries of A and B, by evaluating the d
+    coefficient slices at npts points, multiplying with nmod_mat_mul and
+    interpolating. Requires p >= npts.
+*/
+static void
+_fq_nmod_mat_mul_slices_evaluate(nmod_mat_t PC, const nmod_mat_t PA,
+                           const nmod_mat_t PB, slong m, slong k, slong n,
+                           slong d, nmod_t mod)
+{
+    const slong npts = 2 * d - 1;
+    nmod_mat_t V, W, Vinv, EA, EB, EC, At, Bt, Ct;
+    slong i, j, t;
+
+    /* V[i][t] = t^i for 0 <= i < npts */
+    nmod_mat_init(V, npts, npts, mod.n);
+    for (t = 0; t < npts; t++)
+    {
+        nmod_mat_entry(V, 0, t) = 1;
+        for (i = 1; i < npts; i++)
+            nmod_mat_entry(V, i, t) = n_mulmod2_preinv(
+                          nmod_mat_entry(V, i - 1, t), t, mod.n, mod.ninv);
+    }
+
+    nmod_mat_init(Vinv, npts, npts, mod.n);
+    nmod_mat_inv(Vinv, V);
+
+    /* evaluate: rows of EA, EB are entries, columns are points */
+    nmod_mat_window_init(W, V, 0, 0, d, npts);
+    nmod_mat_init(EA, m * k, npts, mod.n);
+    nmod_mat_init(EB, k * n, npts, mod.n);
+    nmod_mat_mul(EA, PA, W);
+    nmod_mat_mul(EB, PB, W);
+    nmod_mat_window_clear(W);
+
+    nmod_mat_init(At, m, k, mod.n);
+    nmod_mat_init(Bt, k, n, mod.n);
+    nmod_mat_init(Ct, m, n, mod.n);
+    nmod_mat_init(EC, m * n, npts, mod.n);
+
+    for (t = 0; t < npts; t++)
+    {
+        for (i = 0; i < m; i++)
+            for (j = 0; j < k; j++)
+                nmod_mat_entry(At, i, j) = nmod_mat_entry(EA, i * k + j, t);
+
+        for (i = 0; i < k; i++)
+            for (j = 0; j < n; j++)
+                nmod_mat_entry(Bt, i, j) = nmod_mat_entry(EB, i * n + j, t);
+
+        nmod_mat_mul(Ct, At, Bt);
+
+        for (i = 0; i < m; i++)
+            for (j = 0; j < n; j++)
+                nmod_mat_entry(EC, i * n + j, t) = nmod_mat_entry(Ct, i, j);
+    }
+
+    /* interpolate */
+    nmod_mat_mul(PC, EC, Vinv);
+
+    nmod_mat_clear(V);
+    nmod_mat_clear(Vinv);
+    nmod_mat_clear(EA);
+    nmod_mat_clear(EB);
+    nmod_mat_clear(EC);
+    nmod_mat_clear(At);
+    nmod_mat_clear(Bt);
+    nmod_mat_clear(Ct);
+}
+
+/*
+    As above for small p, forming all d^2 slice products A_i B_j with a
+    single nmod_mat_mul of the stacked slices.
+*/
+static void
+_fq_nmod_mat_mul_slices_schoolbook(nmod_mat_t PC, const nmod_mat_t PA,
+                           const nmod_mat_t PB, slong m, slong k, slong n,
+                           slong d, nmod_t mod)
+{
+    nmod_mat_t AS, BS, CS;
+    slong i, j, r, s;
+
+    nmod_mat_init(AS, d * m, k, mod.n);
+    nmod_mat_init(BS, k, d * n, mod.n);
+    nmod_mat_init(CS, d * m, d * n, mod.n);
+
+    for (r = 0; r < d; r++)
+    {
+        for (i = 0; i < m; i++)
+            for (j = 0; j < k; j++)
+                nmod_mat_entry(AS, r * m + i, j) =
+                                       nmod_mat_entry(PA, i * k + j, r);
+
+        for (i = 0; i < k; i++)
+            for (j = 0; j < n; j++)
+                nmod_mat_entry(BS, i, r * n + j) =
+                                       nmod_mat_entry(PB, i * n + j, r);
+    }
+
+    nmod_mat_mul(CS, AS, BS);
+
+    nmod_mat_zero(PC);
+
+    for (r = 0; r < d; r++)
+        for (s = 0; s < d; s++)
+            for (i = 0; i < m; i++)
+                for (j = 0; j < n; j++)
+                    nmod_mat_entry(PC, i * n + j, r + s) = nmod_add(
+                        nmod_mat_entry(PC, i * n + j, r + s),
+                        nmod_mat_entry(CS, r * m + i, s * n + j), mod);
+
+    nmod_mat_clear(AS);
+    nmod_mat_clear(BS);
+    nmod_mat_clear(CS);
+}
+
+void
+fq_nmod_mat_mul_slices(fq_nmod_mat_t C, const fq_nmod_mat_t A,
+                       const fq_nmod_mat_t B, const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+    const slong npts = 2 * d - 1;
+    const nmod_t mod = ctx->mod;
+    slong m, k, n, i;
+    nmod_mat_t PA, PB, PC;
+    mp_ptr R;
+
+    m = A->r;
+    k = A->c;
+    n = B->c;
+
+    if (k == 0)
+    {
+        fq_nmod_mat_zero(C, ctx);
+        return;
+    }
+
+    if (m == 0 || n == 0)
+        return;
+
+    /* entries of A, B as rows of packed coefficients */
+    nmod_mat_init(PA, m * k, d, mod.n);
+    nmod_mat_init(PB, k * n, d, mod.n);
+    nmod_mat_init(PC, m * n, npts, mod.n);
+
+    for (i = 0; i < m; i++)
+        _fq_nmod_vec_pack(PA->entries + i * k * d, A->rows[i], k, ctx);
+    for (i = 0; i < k; i++)
+        _fq_nmod_vec_pack(PB->entries + i * n * d, B->rows[i], n, ctx);
+
+    if (d == 1)
+    {
+        nmod_mat_t Am, Bm, Cm;
+
+        nmod_mat_init(Am, m, k, mod.n);
+        nmod_mat_init(Bm, k, n, mod.n);
+        nmod_mat_init(Cm, m, n, mod.n);
+
+        for (i = 0; i < m; i++)
+            _nmod_vec_set(Am->rows[i], PA->entries + i * k, k);
+        for (i = 0; i < k; i++)
+            _nmod_vec_set(Bm->rows[i], PB->entries + i * n, n);
+
+        nmod_mat_mul(Cm, Am, Bm);
+
+        for (i = 0; i < m; i++)
+            _nmod_vec_set(PC->entries + i * n, Cm->rows[i], n);
+
+        nmod_mat_clear(Am);
+        nmod_mat_clear(Bm);
+        nmod_mat_clear(Cm);
+    }
+    else if (mod.n >= (mp_limb_t) npts)
+        _fq_nmod_mat_mul_slices_evaluate(PC, PA, PB, m, k, n, d, mod);
+    else
+        _fq_nmod_mat_mul_slices_schoolbook(PC, PA, PB, m, k, n, d, mod);
+
+    /* reduce every entry by the modulus at once */
+    R = _nmod_vec_init(m * n * d);
+    _fq_nmod_vec_reduce_packed(R, PC->entries, m * n, npts, ctx);
+
+    for (i = 0; i < m; i++)
+        _fq_nmod_vec_unpack(C->rows[i], R + i * n * d, n, ctx);
+
+    _nmod_vec_clear(R);
+    nmod_mat_clear(PA);
+    nmod_mat_clear(PB);
+    nmod_mat_clear(PC);
+}
@@ -0,0 +1,113 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fq_nmod_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_slices... ");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fq_nmod_ctx_t ctx;
+        nmod_poly_t modulus;
+        fq_nmod_mat_t A, B, C, D;
+        slong m, k, n, d;
+        mp_limb_t p;
+
+        /* include primes below 2d - 1, which cannot use evaluation */
+        if (n_randint(state, 3) == 0)
+            p = n_nth_prime(1 + n_randint(state, 4));
+        else
+            p = n_randtest_prime(state, 0);
+        d = n_randint(state, 12) + 1;
+
+        nmod_poly_init(modulus, p);
+        nmod_poly_randtest_monic_irreducible(modulus, state, d + 1);
+        fq_nmod_ctx_init_modulus(ctx, modulus, "a");
+
+        m = n_randint(state, 30);
+        k = n_randint(state, 30);
+        n = n_randint(state, 30);
+
+        fq_nmod_mat_init(A, m, k, ctx);
+        fq_nmod_mat_init(B, k, n, ctx);
+        fq_nmod_mat_init(C, m, n, ctx);
+        fq_nmod_mat_init(D, m, n, ctx);
+
+        fq_nmod_mat_randtest(A, state, ctx);
+        fq_nmod_mat_randtest(B, state, ctx);
+        fq_nmod_mat_randtest(C, state, ctx);
+
+        fq_nmod_mat_mul_slices(C, A, B, ctx);
+        fq_nmod_mat_mul_classical(D, A, B, ctx);
+
+        result = fq_nmod_mat_equal(C, D, ctx);
+        if (!result)
+        {
+            flint_printf("FAIL:\n\n");
+            fq_nmod_ctx_print(ctx);
+            flint_printf("A = "), fq_nmod_mat_print(A, ctx), flint_printf("\n");
+            flint_printf("B = "), fq_nmod_mat_print(B, ctx), flint_printf("\n");
+            flint_printf("C = "), fq_nmod_mat_print(C, ctx), flint_printf("\n");
+            flint_printf("D = "), fq_nmod_mat_print(D, ctx), flint_printf("\n");
+            abort();
+        }
+
+        /* aliasing */
+        if (k == n)
+        {
+            fq_nmod_mat_mul_slices(A, A, B, ctx);
+
+            result = fq_nmod_mat_equal(A, D, ctx);
+            if (!result)
+            {
+                flint_printf("FAIL (aliasing):\n\n");
+                fq_nmod_ctx_print(ctx);
+                abort();
+            }
+        }
+
+        fq_nmod_mat_clear(A, ctx);
+        fq_nmod_mat_clear(B, ctx);
+        fq_nmod_mat_clear(C, ctx);
+        fq_nmod_mat_clear(D, ctx);
+        fq_nmod_ctx_clear(ctx);
+        nmod_poly_clear(modulus);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -50,6 +50,8 @@
 #define FQ_NMOD_POLY_SMALL_GCD_CUTOFF 110
 #define FQ_NMOD_POLY_GCD_CUTOFF 120
 
+#define FQ_NMOD_POLY_SPARSE_TERMS 8
+
 
 #ifdef T
 #undef T
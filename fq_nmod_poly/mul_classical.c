@@ -20,17 +20,81 @@
 /******************************************************************************
 
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2016 The FLINT team
 
 ******************************************************************************/
 
 #include "fq_nmod_poly.h"
+#include "fq_nmod_vec.h"
 
-#ifdef T
-#undef T
-#endif
+void
+_fq_nmod_poly_mul_classical(fq_nmod_struct * rop,
+                            const fq_nmod_struct * op1, slong len1,
+                            const fq_nmod_struct * op2, slong len2,
+                            const fq_nmod_ctx_t ctx)
+{
+    if (len1 == 1 && len2 == 1)
+    {
+        fq_nmod_mul(rop, op1, op2, ctx);
+    }
+    else
+    {
+        const slong d = fq_nmod_ctx_degree(ctx);
+        const slong len = len1 + len2 - 1;
+        slong i, lo, hi;
+        mp_ptr P1, P2, R;
 
-#define T fq_nmod
-#define CAP_T FQ_NMOD
-#include "fq_poly_templates/mul_classical.c"
-#undef CAP_T
-#undef T
+        P1 = _nmod_vec_init((len1 + len2 + len) * d);
+        P2 = P1 + len1 * d;
+        R = P2 + len2 * d;
+
+        _fq_nmod_vec_pack(P1, op1, len1, ctx);
+        _fq_nmod_vec_pack(P2, op2, len2, ctx);
+
+        /* R[i] = sum_k op1[k] op2[i - k], reduced once per coefficient */
+        for (i = 0; i < len; i++)
+        {
+            lo = FLINT_MAX(0, i - len2 + 1);
+            hi = FLINT_MIN(i, len1 - 1);
+
+            _fq_nmod_vec_dot_packed(R + i * d, P1 + lo * d, d,
+                                    P2 + (i - lo) * d, -d, hi - lo + 1, ctx);
+        }
+
+        _fq_nmod_vec_unpack(rop, R, len, ctx);
+
+        _nmod_vec_clear(P1);
+    }
+}
+
+void
+fq_nmod_poly_mul_classical(fq_nmod_poly_t rop, const fq_nmod_poly_t op1,
+                           const fq_nmod_poly_t op2, const fq_nmod_ctx_t ctx)
+{
+    const slong len = op1->length + op2->length - 1;
+
+    if (op1->length == 0 || op2->length == 0)
+    {
+        fq_nmod_poly_zero(rop, ctx);
+        return;
+    }
+
+    if (rop == op1 || rop == op2)
+    {
+        fq_nmod_poly_t t;
+
+        fq_nmod_poly_init2(t, len, ctx);
+        _fq_nmod_poly_mul_classical(t->coeffs, op1->coeffs, op1->length,
+                                    op2->coeffs, op2->length, ctx);
+        fq_nmod_poly_swap(rop, t, ctx);
+        fq_nmod_poly_clear(t, ctx);
+    }
+    else
+    {
+        fq_nmod_poly_fit_length(rop, len, ctx);
+        _fq_nmod_poly_mul_classical(rop->coeffs, op1->coeffs, op1->length,
+                                    op2->coeffs, op2->length, ctx);
+    }
+
+    _fq_nmod_poly_set_length(rop, len, ctx);
+}
@@ -55,6 +55,42 @@ do {                                          \
     (len2) = __tn;                            \
 } while (0);
 
+/* Packed vectors ************************************************************/
+
+/*
+    A packed vector stores each element as exactly d = deg(modulus)
+    coefficients, consecutively in a single array of limbs.
+*/
+
+FLINT_DLL void _fq_nmod_vec_pack(mp_ptr P, const fq_nmod_struct * vec,
+                                 slong len, const fq_nmod_ctx_t ctx);
+
+FLINT_DLL void _fq_nmod_vec_unpack(fq_nmod_struct * vec, mp_srcptr P,
+                                   slong len, const fq_nmod_ctx_t ctx);
+
+FLINT_DLL void _fq_nmod_vec_reduce_packed(mp_ptr R, mp_ptr T, slong len,
+                                   slong lenT, const fq_nmod_ctx_t ctx);
+
+FLINT_DLL void _fq_nmod_vec_mul_packed(mp_ptr R, mp_srcptr A, mp_srcptr B,
+                                       slong len, const fq_nmod_ctx_t ctx);
+
+FLINT_DLL void _fq_nmod_vec_dot_packed(mp_ptr res, mp_srcptr A, slong astride,
+                                 mp_srcptr B, slong bstride, slong len,
+                                 const fq_nmod_ctx_t ctx);
+
+FQ_NMOD_VEC_INLINE void
+_fq_nmod_vec_add_packed(mp_ptr R, mp_srcptr A, mp_srcptr B, slong len,
+                        const fq_nmod_ctx_t ctx)
+{
+    _nmod_vec_add(R, A, B, len * fq_nmod_ctx_degree(ctx), ctx->mod);
+}
+
+FQ_NMOD_VEC_INLINE void
+_fq_nmod_vec_sub_packed(mp_ptr R, mp_srcptr A, mp_srcptr B, slong len,
+                        const fq_nmod_ctx_t ctx)
+{
+    _nmod_vec_sub(R, A, B, len * fq_nmod_ctx_degree(ctx), ctx->mod);
+}
 
 #define T fq_nmod
 #define CAP_T FQ_NMOD
@@ -20,17 +20,35 @@
 /******************************************************************************
 
     Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2016 The FLINT team
 
 ******************************************************************************/
 
 #include "fq_nmod_vec.h"
 
-#ifdef T
-#undef T
-#endif
+void
+_fq_nmod_vec_dot(fq_nmod_t res, const fq_nmod_struct * vec1,
+                 const fq_nmod_struct * vec2, slong len2,
+                 const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+    mp_ptr P;
 
-#define T fq_nmod
-#define CAP_T FQ_NMOD
-#include "fq_vec_templates/dot.c"
-#undef CAP_T
-#undef T
+    if (len2 == 0)
+    {
+        fq_nmod_zero(res, ctx);
+        return;
+    }
+
+    P = _nmod_vec_init((2 * len2 + 1) * d);
+
+    _fq_nmod_vec_pack(P, vec1, len2, ctx);
+    _fq_nmod_vec_pack(P + len2 * d, vec2, len2, ctx);
+
+    _fq_nmod_vec_dot_packed(P + 2 * len2 * d, P, d, P + len2 * d, d,
+                            len2, ctx);
+
+    _fq_nmod_vec_unpack(res, P + 2 * len2 * d, 1, ctx);
+
+    _nmod_vec_clear(P);
+}
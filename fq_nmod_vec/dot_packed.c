@@ -0,0 +1,144 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include "fq_nmod_vec.h"
+
+void
+_fq_nmod_vec_dot_packed(mp_ptr res, mp_srcptr A, slong astride,
+                        mp_srcptr B, slong bstride, slong len,
+                        const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+    const slong lenT = 2 * d - 1;
+    const nmod_t mod = ctx->mod;
+    mp_srcptr a, b;
+    mp_ptr s, T;
+    mp_limb_t t0, t1;
+    slong i, k, l;
+    int nlimbs;
+    TMP_INIT;
+
+    if (len <= 0)
+    {
+        _nmod_vec_zero(res, d);
+        return;
+    }
+
+    nlimbs = _nmod_vec_dot_bound_limbs(len * d, mod);
+
+    TMP_START;
+    s = TMP_ALLOC(4 * lenT * sizeof(mp_limb_t));
+    T = s + 3 * lenT;
+
+    /*
+        Accumulate the unreduced products of all len pairs, one column of
+        up to three limbs (s[k], s[lenT + k], s[2 lenT + k]) per coefficient,
+        then reduce each coefficient and the sum by the modulus only once.
+    */
+    flint_mpn_zero(s, 3 * lenT);
+
+    if (nlimbs <= 1)
+    {
+        for (i = 0; i < len; i++)
+        {
+            a = A + i * astride;
+            b = B + i * bstride;
+
+            for (k = 0; k < d; k++)
+                if (a[k] != 0)
+                    for (l = 0; l < d; l++)
+                        s[k + l] += a[k] * b[l];
+        }
+
+        for (k = 0; k < lenT; k++)
+            NMOD_RED(T[k], s[k], mod);
+    }
+    else if (nlimbs == 2)
+    {
+        mp_ptr s1 = s + lenT;
+
+        for (i = 0; i < len; i++)
+        {
+            a = A + i * astride;
+            b = B + i * bstride;
+
+            if (mod.n <= (UWORD(1) << (FLINT_BITS / 2)))
+            {
+                for (k = 0; k < d; k++)
+                    if (a[k] != 0)
+                        for (l = 0; l < d; l++)
+                        {
+                            t0 = a[k] * b[l];
+                            add_ssaaaa(s1[k + l], s[k + l], s1[k + l],
+                                       s[k + l], 0, t0);
+                        }
+            }
+            else
+            {
+                for (k = 0; k < d; k++)
+                    if (a[k] != 0)
+                        for (l = 0; l < d; l++)
+                        {
+                            umul_ppmm(t1, t0, a[k], b[l]);
+                            add_ssaaaa(s1[k + l], s[k + l], s1[k + l],
+                                       s[k + l], t1, t0);
+                        }
+            }
+        }
+
+        for (k = 0; k < lenT; k++)
+            NMOD2_RED2(T[k], s1[k], s[k], mod);
+    }
+    else
+    {
+        mp_ptr s1 = s + lenT, s2 = s + 2 * lenT;
+
+        for (i = 0; i < len; i++)
+        {
+            a = A + i * astride;
+            b = B + i * bstride;
+
+            for (k = 0; k < d; k++)
+                if (a[k] != 0)
+                    for (l = 0; l < d; l++)
+                    {
+                        umul_ppmm(t1, t0, a[k], b[l]);
+                        add_sssaaaaaa(s2[k + l], s1[k + l], s[k + l],
+                                      s2[k + l], s1[k + l], s[k + l],
+                                      0, t1, t0);
+                    }
+        }
+
+        for (k = 0; k < lenT; k++)
+        {
+            NMOD_RED(t0, s2[k], mod);
+            NMOD_RED3(T[k], t0, s1[k], s[k], mod);
+        }
+    }
+
+    _fq_nmod_vec_reduce_packed(res, T, 1, lenT, ctx);
+
+    TMP_END;
+}
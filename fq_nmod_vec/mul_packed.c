@@ -0,0 +1,49 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include "fq_nmod_vec.h"
+#include "nmod_poly.h"
+
+void
+_fq_nmod_vec_mul_packed(mp_ptr R, mp_srcptr A, mp_srcptr B, slong len,
+                        const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+    const slong lenT = 2 * d - 1;
+    mp_ptr T;
+    slong i;
+
+    if (len <= 0)
+        return;
+
+    T = _nmod_vec_init(len * lenT);
+
+    for (i = 0; i < len; i++)
+        _nmod_poly_mul(T + i * lenT, A + i * d, d, B + i * d, d, ctx->mod);
+
+    _fq_nmod_vec_reduce_packed(R, T, len, lenT, ctx);
+
+    _nmod_vec_clear(T);
+}
@@ -0,0 +1,84 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include "fq_nmod_vec.h"
+
+void
+_fq_nmod_vec_reduce_packed(mp_ptr R, mp_ptr T, slong len, slong lenT,
+                           const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+    slong i, k, m;
+
+    if (lenT <= d)
+    {
+        for (i = 0; i < len; i++)
+        {
+            _nmod_vec_set(R + i * d, T + i * lenT, lenT);
+            _nmod_vec_zero(R + i * d + lenT, d - lenT);
+        }
+        return;
+    }
+
+    if (ctx->sparse_modulus)
+    {
+        const slong * j = ctx->j;
+        const mp_limb_t * a = ctx->a;
+        const slong t = ctx->len - 1;
+        const nmod_t mod = ctx->mod;
+
+        /* eliminate the top coefficients of all elements together */
+        for (m = lenT - 1; m >= d; m--)
+        {
+            for (i = 0; i < len; i++)
+            {
+                mp_ptr Ti = T + i * lenT;
+                mp_limb_t c = Ti[m];
+
+                if (c == 0)
+                    continue;
+
+                c = nmod_neg(c, mod);
+
+                for (k = 0; k < t; k++)
+                    NMOD_ADDMUL(Ti[j[k] + m - d], c, a[k], mod);
+            }
+        }
+
+        for (i = 0; i < len; i++)
+            _nmod_vec_set(R + i * d, T + i * lenT, d);
+    }
+    else
+    {
+        mp_ptr Q = _nmod_vec_init(lenT - d);
+
+        for (i = 0; i < len; i++)
+            _nmod_poly_divrem_newton_n_preinv(Q, R + i * d, T + i * lenT,
+                                  lenT, ctx->modulus->coeffs, d + 1,
+                                  ctx->inv->coeffs, ctx->inv->length, ctx->mod);
+
+        _nmod_vec_clear(Q);
+    }
+}
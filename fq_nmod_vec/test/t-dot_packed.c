@@ -0,0 +1,142 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fq_nmod_vec.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("dot_packed... ");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        fq_nmod_ctx_t ctx;
+        nmod_poly_t modulus;
+        fq_nmod_struct * a, * b, * c;
+        fq_nmod_t x, y;
+        mp_ptr A, B, C;
+        slong j, len, d;
+        mp_limb_t p;
+
+        p = n_randtest_prime(state, 0);
+        d = n_randint(state, 16) + 1;
+        len = n_randint(state, 30);
+
+        nmod_poly_init(modulus, p);
+        nmod_poly_randtest_monic_irreducible(modulus, state, d + 1);
+        fq_nmod_ctx_init_modulus(ctx, modulus, "a");
+
+        a = _fq_nmod_vec_init(len, ctx);
+        b = _fq_nmod_vec_init(len, ctx);
+        c = _fq_nmod_vec_init(len, ctx);
+        fq_nmod_init(x, ctx);
+        fq_nmod_init(y, ctx);
+
+        A = _nmod_vec_init(len * d);
+        B = _nmod_vec_init(len * d);
+        C = _nmod_vec_init(len * d);
+
+        _fq_nmod_vec_randtest(a, state, len, ctx);
+        _fq_nmod_vec_randtest(b, state, len, ctx);
+
+        /* dot product against the naive sum */
+        _fq_nmod_vec_dot(x, a, b, len, ctx);
+
+        fq_nmod_zero(y, ctx);
+        for (j = 0; j < len; j++)
+        {
+            fq_nmod_t t;
+            fq_nmod_init(t, ctx);
+            fq_nmod_mul(t, a + j, b + j, ctx);
+            fq_nmod_add(y, y, t, ctx);
+            fq_nmod_clear(t, ctx);
+        }
+
+        result = fq_nmod_equal(x, y, ctx);
+        if (!result)
+        {
+            flint_printf("FAIL (dot):\n\n");
+            fq_nmod_ctx_print(ctx);
+            flint_printf("x = "), fq_nmod_print_pretty(x, ctx), flint_printf("\n");
+            flint_printf("y = "), fq_nmod_print_pretty(y, ctx), flint_printf("\n");
+            abort();
+        }
+
+        /* batched products against fq_nmod_mul */
+        _fq_nmod_vec_pack(A, a, len, ctx);
+        _fq_nmod_vec_pack(B, b, len, ctx);
+        _fq_nmod_vec_mul_packed(C, A, B, len, ctx);
+        _fq_nmod_vec_unpack(c, C, len, ctx);
+
+        for (j = 0; j < len; j++)
+        {
+            fq_nmod_mul(x, a + j, b + j, ctx);
+            result = fq_nmod_equal(x, c + j, ctx);
+            if (!result)
+            {
+                flint_printf("FAIL (mul):\n\n");
+                fq_nmod_ctx_print(ctx);
+                flint_printf("j = %wd\n", j);
+                abort();
+            }
+        }
+
+        /* packed addition */
+        _fq_nmod_vec_add_packed(C, A, B, len, ctx);
+        _fq_nmod_vec_unpack(c, C, len, ctx);
+        _fq_nmod_vec_add(a, a, b, len, ctx);
+
+        result = _fq_nmod_vec_equal(a, c, len, ctx);
+        if (!result)
+        {
+            flint_printf("FAIL (add):\n\n");
+            fq_nmod_ctx_print(ctx);
+            abort();
+        }
+
+        _nmod_vec_clear(A);
+        _nmod_vec_clear(B);
+        _nmod_vec_clear(C);
+        fq_nmod_clear(x, ctx);
+        fq_nmod_clear(y, ctx);
+        _fq_nmod_vec_clear(a, len, ctx);
+        _fq_nmod_vec_clear(b, len, ctx);
+        _fq_nmod_vec_clear(c, len, ctx);
+        fq_nmod_ctx_clear(ctx);
+        nmod_poly_clear(modulus);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,42 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include "fq_nmod_vec.h"
+
+void
+_fq_nmod_vec_unpack(fq_nmod_struct * vec, mp_srcptr P, slong len,
+                    const fq_nmod_ctx_t ctx)
+{
+    const slong d = fq_nmod_ctx_degree(ctx);
+    slong i;
+
+    for (i = 0; i < len; i++)
+    {
+        nmod_poly_fit_length(vec + i, d);
+        _nmod_vec_set(vec[i].coeffs, P + i * d, d);
+        _nmod_poly_set_length(vec + i, d);
+        _nmod_poly_normalise(vec + i);
+    }
+}
@@ -50,6 +50,8 @@
 #define FQ_POLY_SMALL_GCD_CUTOFF 80
 #define FQ_POLY_GCD_CUTOFF 90
 
+#define FQ_POLY_SPARSE_TERMS 8
+
 #ifdef T
 #undef T
 #endif
@@ -113,6 +113,18 @@ FLINT_DLL void TEMPLATE(T, poly_factor_equal_deg)(TEMPLATE(T, poly_factor_t) fac
                                    const TEMPLATE(T, poly_t) pol,
                                    slong d, const TEMPLATE(T, ctx_t) ctx);
 
+FLINT_DLL void TEMPLATE(T, poly_factor_distinct_deg_threaded)(
+                                      TEMPLATE(T, poly_factor_t) res,
+                                      const TEMPLATE(T, poly_t) poly,
+                                      slong * const *degs,
+                                      const TEMPLATE(T, ctx_t) ctx);
+
+FLINT_DLL void TEMPLATE(T, poly_factor_equal_deg_threaded)(
+                                   TEMPLATE(T, poly_factor_t) factors,
+                                   const TEMPLATE(T, poly_factor_t) pols,
+                                   const slong * degs,
+                                   const TEMPLATE(T, ctx_t) ctx);
+
 FLINT_DLL void TEMPLATE(T, poly_factor_cantor_zassenhaus)(TEMPLATE(T, poly_factor_t) res,
                                            const TEMPLATE(T, poly_t) f,
                                            const TEMPLATE(T, ctx_t) ctx);
@@ -147,12 +159,33 @@ FLINT_DLL void TEMPLATE(T, poly_factor)(TEMPLATE(T, poly_factor_t) result,
                          const TEMPLATE(T, ctx_t) ctx);
 
 
+FLINT_DLL void TEMPLATE(T, poly_roots)(TEMPLATE(T, poly_factor_t) r,
+                                const TEMPLATE(T, poly_t) f,
+                                int with_multiplicity,
+                                const TEMPLATE(T, ctx_t) ctx);
+
 FLINT_DLL void TEMPLATE(T, poly_iterated_frobenius_preinv)(TEMPLATE(T, poly_t)* rop,
                                             slong n,
                                             const TEMPLATE(T, poly_t) v,
                                             const TEMPLATE(T, poly_t) vinv,
                                             const TEMPLATE(T, ctx_t) ctx);
 
+FLINT_DLL void TEMPLATE(T, poly_iterated_frobenius_preinv_threaded)(
+                                            TEMPLATE(T, poly_t)* rop,
+                                            slong n,
+                                            const TEMPLATE(T, poly_t) v,
+                                            const TEMPLATE(T, poly_t) vinv,
+                                            const TEMPLATE(T, ctx_t) ctx);
+
+FLINT_DLL void _TEMPLATE(T, poly_compose_mod_precomp_preinv_vec_threaded)(
+                                    TEMPLATE(T, poly_struct) * res,
+                                    const TEMPLATE(T, poly_struct) * polys,
+                                    slong len, const TEMPLATE(T, mat_t) A,
+                                    const TEMPLATE(T, poly_t) v,
+                                    const TEMPLATE(T, poly_t) vinv,
+                                    slong num_threads,
+                                    const TEMPLATE(T, ctx_t) ctx);
+
 #ifdef __cplusplus
 }
 #endif
@@ -33,8 +33,19 @@
 
 #include "templates.h"
 
+#include <pthread.h>
+
 #include "perm.h"
 
+typedef struct
+{
+    TEMPLATE(T, poly_factor_struct) * factors;
+    const TEMPLATE(T, poly_struct) * f;
+    slong budget;
+    const TEMPLATE(T, ctx_struct) * ctx;
+}
+TEMPLATE(T, poly_factor_berlekamp_arg_t);
+
 static void
 TEMPLATE(T, to_mat_col) (TEMPLATE(T, mat_t) mat, slong col,
                          TEMPLATE(T, poly_t) poly,
@@ -81,6 +92,33 @@ static void
 __TEMPLATE(T, poly_factor_berlekamp) (TEMPLATE(T, poly_factor_t) factors,
                                       flint_rand_t state,
                                       const TEMPLATE(T, poly_t) f,
+                                      slong budget,
+                                      const TEMPLATE(T, ctx_t) ctx);
+
+static void *
+_TEMPLATE(T, poly_factor_berlekamp_worker) (void * arg_ptr)
+{
+    TEMPLATE(T, poly_factor_berlekamp_arg_t) * arg = arg_ptr;
+    flint_rand_t state;
+
+    flint_randinit(state);
+    __TEMPLATE(T, poly_factor_berlekamp) (arg->factors, state, arg->f,
+                                          arg->budget, arg->ctx);
+    flint_randclear(state);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/*
+    When budget > 1 the two factors found by a successful split are
+    factored concurrently, the first on a new thread with half the budget.
+*/
+static void
+__TEMPLATE(T, poly_factor_berlekamp) (TEMPLATE(T, poly_factor_t) factors,
+                                      flint_rand_t state,
+                                      const TEMPLATE(T, poly_t) f,
+                                      slong budget,
                                       const TEMPLATE(T, ctx_t) ctx)
 {
     const slong n = TEMPLATE(T, poly_degree) (f, ctx);
@@ -251,7 +289,6 @@ __TEMPLATE(T, poly_factor_berlekamp) (TEMPLATE(T, poly_factor_t) factors,
 
         TEMPLATE(T, poly_factor_init) (fac1, ctx);
         TEMPLATE(T, poly_factor_init) (fac2, ctx);
-        __TEMPLATE(T, poly_factor_berlekamp) (fac1, state, g, ctx);
         TEMPLATE(T, poly_init) (Q, ctx);
         TEMPLATE(T, poly_init) (r, ctx);
         TEMPLATE(T, poly_divrem) (Q, r, f, g, ctx);
@@ -260,7 +297,27 @@ __TEMPLATE(T, poly_factor_berlekamp) (TEMPLATE(T, poly_factor_t) factors,
         if (!TEMPLATE(T, poly_is_zero) (Q, ctx))
             TEMPLATE(T, poly_make_monic) (Q, Q, ctx);
 
-        __TEMPLATE(T, poly_factor_berlekamp) (fac2, state, Q, ctx);
+        if (budget > 1 && nullity > 2)
+        {
+            TEMPLATE(T, poly_factor_berlekamp_arg_t) arg;
+            pthread_t thread;
+
+            arg.factors = fac1;
+            arg.f       = g;
+            arg.budget  = budget / 2;
+            arg.ctx     = ctx;
+
+            pthread_create(&thread, NULL,
+                           _TEMPLATE(T, poly_factor_berlekamp_worker), &arg);
+            __TEMPLATE(T, poly_factor_berlekamp) (fac2, state, Q,
+                                                  budget - budget / 2, ctx);
+            pthread_join(thread, NULL);
+        }
+        else
+        {
+            __TEMPLATE(T, poly_factor_berlekamp) (fac1, state, g, 1, ctx);
+            __TEMPLATE(T, poly_factor_berlekamp) (fac2, state, Q, 1, ctx);
+        }
         TEMPLATE(T, poly_factor_concat) (factors, fac1, ctx);
         TEMPLATE(T, poly_factor_concat) (factors, fac2, ctx);
         TEMPLATE(T, poly_factor_clear) (fac1, ctx);
@@ -304,7 +361,7 @@ TEMPLATE(T, poly_factor_berlekamp) (TEMPLATE(T, poly_factor_t) factors,
     for (i = 0; i < sq_free->num; i++)
     {
         __TEMPLATE(T, poly_factor_berlekamp) (factors, r, sq_free->poly + i,
-                                              ctx);
+                                              flint_get_num_threads(), ctx);
     }
     flint_randclear(r);
 
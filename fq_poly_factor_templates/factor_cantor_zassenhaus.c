@@ -39,7 +39,10 @@ TEMPLATE(T, poly_factor_cantor_zassenhaus) (TEMPLATE(T, poly_factor_t) res,
                                             const TEMPLATE(T, poly_t) f,
                                             const TEMPLATE(T, ctx_t) ctx)
 {
-    TEMPLATE(T, poly_t) h, v, g, x;
+    TEMPLATE(T, poly_t) h, v, g, x, r;
+    TEMPLATE(T, poly_factor_t) parts;
+    slong *degs = NULL;
+    int threaded = (flint_get_num_threads() > 1);
     fmpz_t q;
     slong i, j, num;
 
@@ -50,12 +53,20 @@ TEMPLATE(T, poly_factor_cantor_zassenhaus) (TEMPLATE(T, poly_factor_t) res,
     TEMPLATE(T, poly_init) (g, ctx);
     TEMPLATE(T, poly_init) (v, ctx);
     TEMPLATE(T, poly_init) (x, ctx);
+    TEMPLATE(T, poly_init) (r, ctx);
 
     TEMPLATE(T, poly_gen) (h, ctx);
     TEMPLATE(T, poly_gen) (x, ctx);
 
     TEMPLATE(T, poly_make_monic) (v, f, ctx);
 
+    if (threaded)
+    {
+        /* collect the equal-degree parts and split them all at the end */
+        TEMPLATE(T, poly_factor_init) (parts, ctx);
+        degs = flint_malloc(TEMPLATE(T, poly_degree) (v, ctx) * sizeof(slong));
+    }
+
     i = 0;
     do
     {
@@ -69,15 +80,47 @@ TEMPLATE(T, poly_factor_cantor_zassenhaus) (TEMPLATE(T, poly_factor_t) res,
         if (g->length != 1)
         {
             TEMPLATE(T, poly_make_monic) (g, g, ctx);
-            num = res->num;
 
-            TEMPLATE(T, poly_factor_equal_deg) (res, g, i, ctx);
-            for (j = num; j < res->num; j++)
-                res->exp[j] = TEMPLATE(T, poly_remove) (v, res->poly + j, ctx);
+            if (threaded)
+            {
+                degs[parts->num] = i;
+                TEMPLATE(T, poly_factor_insert) (parts, g, 1, ctx);
+
+                /* strip every power of the factors of g from v */
+                do
+                {
+                    TEMPLATE(T, poly_divrem) (v, r, v, g, ctx);
+                    TEMPLATE(T, poly_gcd) (g, g, v, ctx);
+                }
+                while (g->length > 1);
+            }
+            else
+            {
+                num = res->num;
+
+                TEMPLATE(T, poly_factor_equal_deg) (res, g, i, ctx);
+                for (j = num; j < res->num; j++)
+                    res->exp[j] = TEMPLATE(T, poly_remove) (v, res->poly + j,
+                                                            ctx);
+            }
         }
     }
     while (v->length >= 2 * i + 3);
 
+    if (threaded)
+    {
+        num = res->num;
+
+        TEMPLATE(T, poly_factor_equal_deg_threaded) (res, parts, degs, ctx);
+
+        TEMPLATE(T, poly_make_monic) (g, f, ctx);
+        for (j = num; j < res->num; j++)
+            res->exp[j] = TEMPLATE(T, poly_remove) (g, res->poly + j, ctx);
+
+        TEMPLATE(T, poly_factor_clear) (parts, ctx);
+        flint_free(degs);
+    }
+
     if (v->length > 1)
         TEMPLATE(T, poly_factor_insert) (res, v, 1, ctx);
 
@@ -85,6 +128,7 @@ TEMPLATE(T, poly_factor_cantor_zassenhaus) (TEMPLATE(T, poly_factor_t) res,
     TEMPLATE(T, poly_clear) (h, ctx);
     TEMPLATE(T, poly_clear) (v, ctx);
     TEMPLATE(T, poly_clear) (x, ctx);
+    TEMPLATE(T, poly_clear) (r, ctx);
     fmpz_clear(q);
 }
 
@@ -0,0 +1,327 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#ifdef T
+
+#include "templates.h"
+
+#include <math.h>
+#include <pthread.h>
+
+typedef struct
+{
+    TEMPLATE(T, poly_struct) * I;
+    const TEMPLATE(T, poly_struct) * H;
+    const TEMPLATE(T, poly_struct) * h;
+    slong start;
+    slong stop;
+    slong l;
+    const TEMPLATE(T, poly_struct) * s;
+    const TEMPLATE(T, poly_struct) * sinv;
+    const TEMPLATE(T, ctx_struct) * ctx;
+}
+TEMPLATE(T, poly_interval_poly_arg_t);
+
+/*
+    Sets I[j] = prod (H[j] - h[i]) mod s over the baby steps 0 <= i < l
+    whose degree index d = j l + l - i still satisfies 2 d <= deg(s).
+*/
+static void
+_TEMPLATE(T, poly_interval_poly_range) (
+                             TEMPLATE(T, poly_interval_poly_arg_t) * arg)
+{
+    const TEMPLATE(T, ctx_struct) * ctx = arg->ctx;
+    TEMPLATE(T, poly_t) tmp;
+    slong i, j, d;
+
+    TEMPLATE(T, poly_init) (tmp, ctx);
+
+    for (j = arg->start; j < arg->stop; j++)
+    {
+        TEMPLATE(T, poly_one) (arg->I + j, ctx);
+
+        d = j * arg->l + 1;
+        for (i = arg->l - 1; i >= 0 && 2 * d <= arg->s->length - 1; i--, d++)
+        {
+            TEMPLATE(T, poly_rem) (tmp, arg->h + i, arg->s, ctx);
+            TEMPLATE(T, poly_sub) (tmp, arg->H + j, tmp, ctx);
+            TEMPLATE(T, poly_mulmod_preinv) (arg->I + j, tmp, arg->I + j,
+                                             arg->s, arg->sinv, ctx);
+        }
+    }
+
+    TEMPLATE(T, poly_clear) (tmp, ctx);
+}
+
+static void *
+_TEMPLATE(T, poly_interval_poly_worker) (void * arg_ptr)
+{
+    _TEMPLATE(T, poly_interval_poly_range)
+        ((TEMPLATE(T, poly_interval_poly_arg_t) *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+static void
+_TEMPLATE(T, poly_interval_poly_threaded) (TEMPLATE(T, poly_struct) * I,
+                                        const TEMPLATE(T, poly_struct) * H,
+                                        const TEMPLATE(T, poly_struct) * h,
+                                        slong start, slong stop, slong l,
+                                        const TEMPLATE(T, poly_t) s,
+                                        const TEMPLATE(T, poly_t) sinv,
+                                        slong num_threads,
+                                        const TEMPLATE(T, ctx_t) ctx)
+{
+    TEMPLATE(T, poly_interval_poly_arg_t) * args;
+    pthread_t * threads;
+    slong i, len = stop - start;
+
+    num_threads = FLINT_MAX(1, FLINT_MIN(num_threads, len));
+
+    args = flint_malloc(num_threads *
+                        sizeof(TEMPLATE(T, poly_interval_poly_arg_t)));
+    threads = flint_malloc(num_threads * sizeof(pthread_t));
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].I     = I;
+        args[i].H     = H;
+        args[i].h     = h;
+        args[i].start = start + (i * len) / num_threads;
+        args[i].stop  = start + ((i + 1) * len) / num_threads;
+        args[i].l     = l;
+        args[i].s     = s;
+        args[i].sinv  = sinv;
+        args[i].ctx   = ctx;
+    }
+
+    for (i = 1; i < num_threads; i++)
+        pthread_create(&threads[i], NULL,
+                       _TEMPLATE(T, poly_interval_poly_worker), &args[i]);
+
+    _TEMPLATE(T, poly_interval_poly_range) (&args[0]);
+
+    for (i = 1; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
+
+void
+TEMPLATE(T, poly_factor_distinct_deg_threaded) (
+                                       TEMPLATE(T, poly_factor_t) res,
+                                       const TEMPLATE(T, poly_t) poly,
+                                       slong * const *degs,
+                                       const TEMPLATE(T, ctx_t) ctx)
+{
+    TEMPLATE(T, poly_t) f, g, s, v, vinv, tmp;
+    TEMPLATE(T, poly_t) * h, *H, *I;
+    slong i, j, j0, j1, l, m, n, b, index, d;
+    slong num_threads = flint_get_num_threads();
+    int have_G = 0, reduced = 0;
+    double beta;
+    TEMPLATE(T, mat_t) HH, G, GG;
+
+    n = TEMPLATE(T, poly_degree) (poly, ctx);
+
+    if (num_threads == 1 || n <= 2)
+    {
+        TEMPLATE(T, poly_factor_distinct_deg) (res, poly, degs, ctx);
+        return;
+    }
+
+    beta = 0.5 * (1. - (log(2) / log(n)));
+    l = ceil(pow(n, beta));
+    m = ceil(0.5 * n / l);
+
+    /* giant steps are taken in blocks of b, one per thread */
+    b = FLINT_MIN(num_threads, m);
+
+    TEMPLATE(T, poly_init) (f, ctx);
+    TEMPLATE(T, poly_init) (g, ctx);
+    TEMPLATE(T, poly_init) (s, ctx);
+    TEMPLATE(T, poly_init) (v, ctx);
+    TEMPLATE(T, poly_init) (vinv, ctx);
+    TEMPLATE(T, poly_init) (tmp, ctx);
+
+    if (!
+        (h = flint_malloc((2 * m + l + 1) * sizeof(TEMPLATE(T, poly_struct)))))
+    {
+        TEMPLATE_PRINTF("Exception (%s_poly_factor_distinct_deg_threaded):\n",
+                        T);
+        flint_printf("Not enough memory.\n");
+        abort();
+    }
+    H = h + (l + 1);
+    I = H + m;
+    for (i = 0; i < l + 1; i++)
+        TEMPLATE(T, poly_init) (h[i], ctx);
+    for (i = 0; i < m; i++)
+    {
+        TEMPLATE(T, poly_init) (H[i], ctx);
+        TEMPLATE(T, poly_init) (I[i], ctx);
+    }
+
+    TEMPLATE(T, poly_make_monic) (v, poly, ctx);
+
+    TEMPLATE(T, poly_reverse) (vinv, v, v->length, ctx);
+    TEMPLATE(T, poly_inv_series_newton) (vinv, vinv, v->length, ctx);
+
+    /* compute baby steps: h[i]=x^{q^i}mod v */
+    TEMPLATE(T, poly_iterated_frobenius_preinv_threaded) (h, l + 1, v, vinv,
+                                                          ctx);
+
+    /* compute coarse distinct-degree factorisation */
+    index = 0;
+    TEMPLATE(T, poly_set) (s, v, ctx);
+    TEMPLATE(T, poly_set) (H[0], h[l], ctx);
+    TEMPLATE(T, mat_init) (HH, n_sqrt(v->length - 1) + 1, v->length - 1, ctx);
+    TEMPLATE(T, poly_precompute_matrix) (HH, H[0], s, vinv, ctx);
+
+    for (j0 = 0; j0 < m; j0 = j1)
+    {
+        j1 = FLINT_MIN(j0 + b, m);
+
+        /* compute giant steps H[j] = x^{q^(lj)} mod s for j0 <= j < j1 */
+        if (j0 == 0)
+        {
+            for (j = 1; j < j1; j++)
+                TEMPLATE(T, poly_compose_mod_brent_kung_precomp_preinv)
+                    (H[j], H[j - 1], HH, s, vinv, ctx);
+        }
+        else
+        {
+            /* H[j] = H[j - b](x^{q^(lb)}) mod s */
+            if (!have_G)
+            {
+                TEMPLATE(T, mat_init) (G, n_sqrt(s->length - 1) + 1,
+                                       s->length - 1, ctx);
+                TEMPLATE(T, poly_rem) (tmp, H[b - 1], s, ctx);
+                TEMPLATE(T, poly_precompute_matrix) (G, tmp, s, vinv, ctx);
+                have_G = 1;
+            }
+            else if (reduced)
+            {
+                _TEMPLATE(T, poly_reduce_matrix_mod_poly) (GG, G, s, ctx);
+                TEMPLATE(T, mat_swap) (G, GG, ctx);
+                TEMPLATE(T, mat_clear) (GG, ctx);
+            }
+
+            _TEMPLATE(T, poly_compose_mod_precomp_preinv_vec_threaded)
+                (H[j0], H[j0 - b], j1 - j0, G, s, vinv, num_threads, ctx);
+        }
+        reduced = 0;
+
+        /* compute interval polynomials */
+        _TEMPLATE(T, poly_interval_poly_threaded) (*I, *H, *h, j0, j1, l, s,
+                                                   vinv, num_threads, ctx);
+
+        /* compute F_j=f^{[j*l+1]} * ... * f^{[j*l+l]} */
+        /* F_j is stored on the place of I_j */
+        for (j = j0; j < j1; j++)
+        {
+            TEMPLATE(T, poly_gcd) (I[j], s, I[j], ctx);
+            if (I[j]->length > 1)
+            {
+                TEMPLATE(T, poly_remove) (s, I[j], ctx);
+                TEMPLATE(T, poly_reverse) (vinv, s, s->length, ctx);
+                TEMPLATE(T, poly_inv_series_newton) (vinv, vinv, s->length,
+                                                     ctx);
+                reduced = 1;
+            }
+
+            d = (j + 1) * l + 1;
+            if (s->length - 1 < 2 * d)
+                break;
+        }
+
+        if (j < j1)
+        {
+            /* interval polynomials past the break are not needed */
+            for (j++; j < j1; j++)
+                TEMPLATE(T, poly_zero) (I[j], ctx);
+            break;
+        }
+    }
+    if (s->length > 1)
+    {
+        TEMPLATE(T, poly_factor_insert) (res, s, 1, ctx);
+        (*degs)[index++] = s->length - 1;
+    }
+
+    /* compute fine distinct-degree factorisation */
+    for (j = 0; j < m; j++)
+    {
+        if (I[j]->length - 1 > (j + 1) * l || j == 0)
+        {
+            TEMPLATE(T, poly_set) (g, I[j], ctx);
+            for (i = l - 1; i >= 0 && (g->length > 1); i--)
+            {
+                /* compute f^{[l*(j+1)-i]} */
+                TEMPLATE(T, poly_sub) (tmp, H[j], h[i], ctx);
+                TEMPLATE(T, poly_gcd) (f, g, tmp, ctx);
+                if (f->length > 1)
+                {
+                    /* insert f^{[l*(j+1)-i]} into res */
+                    TEMPLATE(T, poly_make_monic) (f, f, ctx);
+                    TEMPLATE(T, poly_factor_insert) (res, f, 1, ctx);
+                    (*degs)[index++] = l * (j + 1) - i;
+
+                    TEMPLATE(T, poly_remove) (g, f, ctx);
+                }
+            }
+        }
+        else if (I[j]->length > 1)
+        {
+            TEMPLATE(T, poly_make_monic) (I[j], I[j], ctx);
+            TEMPLATE(T, poly_factor_insert) (res, I[j], 1, ctx);
+            (*degs)[index++] = I[j]->length - 1;
+        }
+    }
+
+    /* cleanup */
+    TEMPLATE(T, poly_clear) (f, ctx);
+    TEMPLATE(T, poly_clear) (g, ctx);
+    TEMPLATE(T, poly_clear) (s, ctx);
+    TEMPLATE(T, poly_clear) (v, ctx);
+    TEMPLATE(T, poly_clear) (vinv, ctx);
+    TEMPLATE(T, poly_clear) (tmp, ctx);
+    TEMPLATE(T, mat_clear) (HH, ctx);
+    if (have_G)
+        TEMPLATE(T, mat_clear) (G, ctx);
+
+    for (i = 0; i < l + 1; i++)
+        TEMPLATE(T, poly_clear) (h[i], ctx);
+    for (i = 0; i < m; i++)
+    {
+        TEMPLATE(T, poly_clear) (H[i], ctx);
+        TEMPLATE(T, poly_clear) (I[i], ctx);
+    }
+    flint_free(h);
+}
+
+#endif
@@ -0,0 +1,208 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#ifdef T
+
+#include "templates.h"
+
+#include <pthread.h>
+
+typedef struct
+{
+    TEMPLATE(T, poly_factor_struct) * factors;
+    const TEMPLATE(T, poly_struct) * pols;
+    const slong * degs;
+    slong start;
+    slong step;
+    slong stop;
+    slong budget;
+    const TEMPLATE(T, ctx_struct) * ctx;
+}
+TEMPLATE(T, poly_factor_equal_deg_arg_t);
+
+static void
+_TEMPLATE(T, poly_factor_equal_deg_split) (TEMPLATE(T, poly_factor_t) factors,
+                                           flint_rand_t state,
+                                           const TEMPLATE(T, poly_t) pol,
+                                           slong d, slong budget,
+                                           const TEMPLATE(T, ctx_t) ctx);
+
+static void *
+_TEMPLATE(T, poly_factor_equal_deg_worker) (void * arg_ptr)
+{
+    TEMPLATE(T, poly_factor_equal_deg_arg_t) * arg = arg_ptr;
+    flint_rand_t state;
+    slong i;
+
+    flint_randinit(state);
+
+    for (i = arg->start; i < arg->stop; i += arg->step)
+        _TEMPLATE(T, poly_factor_equal_deg_split) (arg->factors + i, state,
+                                 arg->pols + i, arg->degs[i], arg->budget,
+                                 arg->ctx);
+
+    flint_randclear(state);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/*
+    As for poly_factor_equal_deg, but when budget > 1 the two halves of
+    each successful split are factored concurrently, the first on a new
+    thread with half the budget.
+*/
+static void
+_TEMPLATE(T, poly_factor_equal_deg_split) (TEMPLATE(T, poly_factor_t) factors,
+                                           flint_rand_t state,
+                                           const TEMPLATE(T, poly_t) pol,
+                                           slong d, slong budget,
+                                           const TEMPLATE(T, ctx_t) ctx)
+{
+    TEMPLATE(T, poly_t) f, g, r;
+
+    if (budget <= 1 || pol->length <= 2 * d + 1)
+    {
+        TEMPLATE(T, poly_factor_equal_deg) (factors, pol, d, ctx);
+        return;
+    }
+
+    TEMPLATE(T, poly_init) (f, ctx);
+    TEMPLATE(T, poly_init) (g, ctx);
+    TEMPLATE(T, poly_init) (r, ctx);
+
+    while (!TEMPLATE(T, poly_factor_equal_deg_prob) (f, state, pol, d, ctx))
+    {
+    };
+
+    TEMPLATE(T, poly_divrem) (g, r, pol, f, ctx);
+
+    {
+        TEMPLATE(T, poly_factor_t) fac1, fac2;
+        TEMPLATE(T, poly_factor_equal_deg_arg_t) arg;
+        pthread_t thread;
+
+        TEMPLATE(T, poly_factor_init) (fac1, ctx);
+        TEMPLATE(T, poly_factor_init) (fac2, ctx);
+
+        arg.factors = fac1;
+        arg.pols    = f;
+        arg.degs    = &d;
+        arg.start   = 0;
+        arg.step    = 1;
+        arg.stop    = 1;
+        arg.budget  = budget / 2;
+        arg.ctx     = ctx;
+
+        pthread_create(&thread, NULL,
+                       _TEMPLATE(T, poly_factor_equal_deg_worker), &arg);
+
+        _TEMPLATE(T, poly_factor_equal_deg_split) (fac2, state, g, d,
+                                                   budget - budget / 2, ctx);
+        pthread_join(thread, NULL);
+
+        TEMPLATE(T, poly_factor_concat) (factors, fac1, ctx);
+        TEMPLATE(T, poly_factor_concat) (factors, fac2, ctx);
+        TEMPLATE(T, poly_factor_clear) (fac1, ctx);
+        TEMPLATE(T, poly_factor_clear) (fac2, ctx);
+    }
+
+    TEMPLATE(T, poly_clear) (f, ctx);
+    TEMPLATE(T, poly_clear) (g, ctx);
+    TEMPLATE(T, poly_clear) (r, ctx);
+}
+
+void
+TEMPLATE(T, poly_factor_equal_deg_threaded) (
+                                   TEMPLATE(T, poly_factor_t) factors,
+                                   const TEMPLATE(T, poly_factor_t) pols,
+                                   const slong * degs,
+                                   const TEMPLATE(T, ctx_t) ctx)
+{
+    TEMPLATE(T, poly_factor_struct) * fac;
+    TEMPLATE(T, poly_factor_equal_deg_arg_t) * args;
+    pthread_t * threads;
+    slong i, num = pols->num, num_threads = flint_get_num_threads();
+
+    if (num == 0)
+        return;
+
+    num_threads = FLINT_MAX(1, FLINT_MIN(num_threads, num));
+
+    fac = flint_malloc(num * sizeof(TEMPLATE(T, poly_factor_struct)));
+    args = flint_malloc(num_threads *
+                        sizeof(TEMPLATE(T, poly_factor_equal_deg_arg_t)));
+    threads = flint_malloc(num_threads * sizeof(pthread_t));
+
+    for (i = 0; i < num; i++)
+        TEMPLATE(T, poly_factor_init) (fac + i, ctx);
+
+    /*
+        Polynomials are dealt round robin to the threads; spare threads
+        (when there are fewer polynomials than threads) are given to the
+        recursive splitting of each polynomial.
+    */
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].factors = fac;
+        args[i].pols    = pols->poly;
+        args[i].degs    = degs;
+        args[i].start   = i;
+        args[i].step    = num_threads;
+        args[i].stop    = num;
+        args[i].budget  = flint_get_num_threads() / num_threads
+                        + (i < flint_get_num_threads() % num_threads);
+        args[i].ctx     = ctx;
+    }
+
+    for (i = 1; i < num_threads; i++)
+        pthread_create(&threads[i], NULL,
+                       _TEMPLATE(T, poly_factor_equal_deg_worker), &args[i]);
+
+    {
+        flint_rand_t state;
+
+        flint_randinit(state);
+        for (i = 0; i < num; i += num_threads)
+            _TEMPLATE(T, poly_factor_equal_deg_split) (fac + i, state,
+                          pols->poly + i, degs[i], args[0].budget, ctx);
+        flint_randclear(state);
+    }
+
+    for (i = 1; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    for (i = 0; i < num; i++)
+    {
+        TEMPLATE(T, poly_factor_concat) (factors, fac + i, ctx);
+        TEMPLATE(T, poly_factor_clear) (fac + i, ctx);
+    }
+
+    flint_free(threads);
+    flint_free(args);
+    flint_free(fac);
+}
+
+#endif
@@ -60,22 +60,53 @@ TEMPLATE(T, poly_factor_kaltofen_shoup) (TEMPLATE(T, poly_factor_t) res,
 
     /* compute distinct-degree factorisation */
     TEMPLATE(T, poly_factor_init) (dist_deg, ctx);
-    for (i = 0; i < sq_free->num; i++)
-    {
-        dist_deg_num = dist_deg->num;
 
-        TEMPLATE(T, poly_factor_distinct_deg) (dist_deg, sq_free->poly + i,
-                                               &degs, ctx);
+    if (flint_get_num_threads() > 1)
+    {
+        slong *all_degs = flint_malloc(
+                    TEMPLATE(T, poly_degree) (poly, ctx) * sizeof(slong));
 
-        /* compute equal-degree factorisation */
-        for (j = dist_deg_num, l = 0; j < dist_deg->num; j++, l++)
+        for (i = 0; i < sq_free->num; i++)
         {
-            res_num = res->num;
+            dist_deg_num = dist_deg->num;
+
+            TEMPLATE(T, poly_factor_distinct_deg_threaded) (dist_deg,
+                                           sq_free->poly + i, &degs, ctx);
+
+            for (j = dist_deg_num, l = 0; j < dist_deg->num; j++, l++)
+                all_degs[j] = degs[l];
+        }
 
-            TEMPLATE(T, poly_factor_equal_deg) (res, dist_deg->poly + j,
-                                                degs[l], ctx);
-            for (k = res_num; k < res->num; k++)
-                res->exp[k] = TEMPLATE(T, poly_remove) (v, res->poly + k, ctx);
+        /* split all the equal-degree parts concurrently */
+        res_num = res->num;
+
+        TEMPLATE(T, poly_factor_equal_deg_threaded) (res, dist_deg, all_degs,
+                                                     ctx);
+        for (k = res_num; k < res->num; k++)
+            res->exp[k] = TEMPLATE(T, poly_remove) (v, res->poly + k, ctx);
+
+        flint_free(all_degs);
+    }
+    else
+    {
+        for (i = 0; i < sq_free->num; i++)
+        {
+            dist_deg_num = dist_deg->num;
+
+            TEMPLATE(T, poly_factor_distinct_deg) (dist_deg, sq_free->poly + i,
+                                                   &degs, ctx);
+
+            /* compute equal-degree factorisation */
+            for (j = dist_deg_num, l = 0; j < dist_deg->num; j++, l++)
+            {
+                res_num = res->num;
+
+                TEMPLATE(T, poly_factor_equal_deg) (res, dist_deg->poly + j,
+                                                    degs[l], ctx);
+                for (k = res_num; k < res->num; k++)
+                    res->exp[k] = TEMPLATE(T, poly_remove) (v, res->poly + k,
+                                                            ctx);
+            }
         }
     }
 
@@ -0,0 +1,174 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#ifdef T
+
+#include "templates.h"
+
+#include <pthread.h>
+
+typedef struct
+{
+    TEMPLATE(T, poly_struct) * res;
+    const TEMPLATE(T, poly_struct) * polys;
+    slong start;
+    slong stop;
+    const TEMPLATE(T, mat_struct) * A;
+    const TEMPLATE(T, poly_struct) * v;
+    const TEMPLATE(T, poly_struct) * vinv;
+    const TEMPLATE(T, ctx_struct) * ctx;
+}
+TEMPLATE(T, poly_compose_mod_vec_arg_t);
+
+static void
+_TEMPLATE(T, poly_compose_mod_vec_range) (
+                          TEMPLATE(T, poly_compose_mod_vec_arg_t) * arg)
+{
+    TEMPLATE(T, poly_t) tmp;
+    slong i;
+
+    TEMPLATE(T, poly_init) (tmp, arg->ctx);
+
+    for (i = arg->start; i < arg->stop; i++)
+    {
+        if (arg->polys[i].length >= arg->v->length)
+        {
+            TEMPLATE(T, poly_rem) (tmp, arg->polys + i, arg->v, arg->ctx);
+            TEMPLATE(T, poly_compose_mod_brent_kung_precomp_preinv)
+                (arg->res + i, tmp, arg->A, arg->v, arg->vinv, arg->ctx);
+        }
+        else
+            TEMPLATE(T, poly_compose_mod_brent_kung_precomp_preinv)
+                (arg->res + i, arg->polys + i, arg->A, arg->v, arg->vinv,
+                 arg->ctx);
+    }
+
+    TEMPLATE(T, poly_clear) (tmp, arg->ctx);
+}
+
+static void *
+_TEMPLATE(T, poly_compose_mod_vec_worker) (void * arg_ptr)
+{
+    _TEMPLATE(T, poly_compose_mod_vec_range)
+        ((TEMPLATE(T, poly_compose_mod_vec_arg_t) *) arg_ptr);
+
+    flint_cleanup();
+    return NULL;
+}
+
+/*
+    Sets res[i] to polys[i](g) mod v for 0 <= i < len, where A is the
+    Brent-Kung matrix of g. The range is split evenly over num_threads
+    threads, the first block being handled by the calling thread.
+*/
+void
+_TEMPLATE(T, poly_compose_mod_precomp_preinv_vec_threaded) (
+                                    TEMPLATE(T, poly_struct) * res,
+                                    const TEMPLATE(T, poly_struct) * polys,
+                                    slong len, const TEMPLATE(T, mat_t) A,
+                                    const TEMPLATE(T, poly_t) v,
+                                    const TEMPLATE(T, poly_t) vinv,
+                                    slong num_threads,
+                                    const TEMPLATE(T, ctx_t) ctx)
+{
+    TEMPLATE(T, poly_compose_mod_vec_arg_t) * args;
+    pthread_t * threads;
+    slong i;
+
+    num_threads = FLINT_MAX(1, FLINT_MIN(num_threads, len));
+
+    args = flint_malloc(num_threads *
+                        sizeof(TEMPLATE(T, poly_compose_mod_vec_arg_t)));
+    threads = flint_malloc(num_threads * sizeof(pthread_t));
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].res   = res;
+        args[i].polys = polys;
+        args[i].start = (i * len) / num_threads;
+        args[i].stop  = ((i + 1) * len) / num_threads;
+        args[i].A     = A;
+        args[i].v     = v;
+        args[i].vinv  = vinv;
+        args[i].ctx   = ctx;
+    }
+
+    for (i = 1; i < num_threads; i++)
+        pthread_create(&threads[i], NULL,
+                       _TEMPLATE(T, poly_compose_mod_vec_worker), &args[i]);
+
+    _TEMPLATE(T, poly_compose_mod_vec_range) (&args[0]);
+
+    for (i = 1; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
+
+void
+TEMPLATE(T, poly_iterated_frobenius_preinv_threaded) (
+                                             TEMPLATE(T, poly_t) * rop,
+                                             slong n,
+                                             const TEMPLATE(T, poly_t) v,
+                                             const TEMPLATE(T, poly_t) vinv,
+                                             const TEMPLATE(T, ctx_t) ctx)
+{
+    slong k, num_threads = flint_get_num_threads();
+    fmpz_t q;
+    TEMPLATE(T, mat_t) HH;
+
+    if (num_threads == 1 || n <= 3 ||
+        !TEMPLATE(CAP_T, POLY_ITERATED_FROBENIUS_CUTOFF) (ctx, v->length))
+    {
+        TEMPLATE(T, poly_iterated_frobenius_preinv) (rop, n, v, vinv, ctx);
+        return;
+    }
+
+    fmpz_init(q);
+    TEMPLATE(T, ctx_order) (q, ctx);
+
+    TEMPLATE(T, poly_gen) (rop[0], ctx);
+    TEMPLATE(T, poly_powmod_fmpz_sliding_preinv) (rop[1], rop[0], q, 0, v,
+                                                  vinv, ctx);
+
+    /*
+        Doubling: once rop[0..k] are known, rop[k + i] = rop[i](rop[k])
+        for 1 <= i <= k, and these k compositions are independent.
+    */
+    TEMPLATE(T, mat_init) (HH, n_sqrt(v->length - 1) + 1, v->length - 1, ctx);
+    for (k = 1; k + 1 < n; k *= 2)
+    {
+        TEMPLATE(T, poly_precompute_matrix) (HH, rop[k], v, vinv, ctx);
+        _TEMPLATE(T, poly_compose_mod_precomp_preinv_vec_threaded)
+            (rop[k + 1], rop[1], FLINT_MIN(k, n - 1 - k), HH, v, vinv,
+             num_threads, ctx);
+    }
+    TEMPLATE(T, mat_clear) (HH, ctx);
+
+    fmpz_clear(q);
+}
+
+#endif
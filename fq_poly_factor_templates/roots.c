@@ -0,0 +1,225 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#ifdef T
+
+#include "templates.h"
+
+#include "ulong_extras.h"
+
+/* append the root a, i.e. the factor x - a, with the given multiplicity */
+static void
+__TEMPLATE(T, poly_roots_push) (TEMPLATE(T, poly_factor_t) r,
+                                const TEMPLATE(T, t) a, slong mult,
+                                const TEMPLATE(T, ctx_t) ctx)
+{
+    TEMPLATE(T, poly_struct) * f;
+
+    TEMPLATE(T, poly_factor_fit_length) (r, r->num + 1, ctx);
+
+    f = r->poly + r->num;
+    TEMPLATE(T, poly_fit_length) (f, 2, ctx);
+    TEMPLATE(T, neg) (f->coeffs + 0, a, ctx);
+    TEMPLATE(T, one) (f->coeffs + 1, ctx);
+    _TEMPLATE(T, poly_set_length) (f, 2, ctx);
+    r->exp[r->num] = mult;
+    r->num++;
+}
+
+/*
+    f is monic, squarefree and a product of linear factors. In odd
+    characteristic it is split by gcd((x + a)^((q - 1)/2) - 1, f) for
+    random shifts a, otherwise by the trace map of equal_deg_prob.
+*/
+static void
+__TEMPLATE(T, poly_roots_split) (TEMPLATE(T, poly_factor_t) r,
+                                 const TEMPLATE(T, poly_t) f, slong mult,
+                                 flint_rand_t state,
+                                 const TEMPLATE(T, ctx_t) ctx)
+{
+    TEMPLATE(T, poly_t) g, h, t, finv;
+    TEMPLATE(T, t) a;
+    fmpz_t e;
+
+    if (f->length <= 1)
+        return;
+
+    if (f->length == 2)
+    {
+        TEMPLATE(T, init) (a, ctx);
+        TEMPLATE(T, neg) (a, f->coeffs + 0, ctx);
+        __TEMPLATE(T, poly_roots_push) (r, a, mult, ctx);
+        TEMPLATE(T, clear) (a, ctx);
+        return;
+    }
+
+    TEMPLATE(T, poly_init) (g, ctx);
+    TEMPLATE(T, poly_init) (h, ctx);
+
+    if (fmpz_cmp_ui(TEMPLATE(T, ctx_prime) (ctx), 2) > 0)
+    {
+        TEMPLATE(T, init) (a, ctx);
+        TEMPLATE(T, poly_init) (finv, ctx);
+
+        fmpz_init(e);
+        TEMPLATE(T, ctx_order) (e, ctx);
+        fmpz_sub_ui(e, e, 1);
+        fmpz_fdiv_q_2exp(e, e, 1);
+
+        TEMPLATE(T, poly_reverse) (finv, f, f->length, ctx);
+        TEMPLATE(T, poly_inv_series_newton) (finv, finv, f->length, ctx);
+
+        while (1)
+        {
+            TEMPLATE(T, randtest) (a, state, ctx);
+            TEMPLATE(T, poly_gen) (h, ctx);
+            TEMPLATE(T, poly_set_coeff) (h, 0, a, ctx);
+
+            TEMPLATE(T, poly_powmod_fmpz_sliding_preinv) (h, h, e, 0, f, finv,
+                                                          ctx);
+            if (h->length == 0)
+                continue;
+
+            TEMPLATE(T, sub_one) (h->coeffs + 0, h->coeffs + 0, ctx);
+            _TEMPLATE(T, poly_normalise) (h, ctx);
+            TEMPLATE(T, poly_gcd) (g, h, f, ctx);
+
+            if (g->length > 1 && g->length < f->length)
+                break;
+        }
+
+        fmpz_clear(e);
+        TEMPLATE(T, poly_clear) (finv, ctx);
+        TEMPLATE(T, clear) (a, ctx);
+    }
+    else
+    {
+        while (!TEMPLATE(T, poly_factor_equal_deg_prob) (g, state, f, 1, ctx))
+        {
+        };
+
+        TEMPLATE(T, poly_make_monic) (g, g, ctx);
+    }
+
+    TEMPLATE(T, poly_init) (t, ctx);
+    TEMPLATE(T, poly_divrem) (h, t, f, g, ctx);
+    TEMPLATE(T, poly_clear) (t, ctx);
+
+    __TEMPLATE(T, poly_roots_split) (r, g, mult, state, ctx);
+    __TEMPLATE(T, poly_roots_split) (r, h, mult, state, ctx);
+
+    TEMPLATE(T, poly_clear) (g, ctx);
+    TEMPLATE(T, poly_clear) (h, ctx);
+}
+
+/* pushes each distinct root of the monic polynomial f once */
+static void
+__TEMPLATE(T, poly_roots_distinct) (TEMPLATE(T, poly_factor_t) r,
+                                    const TEMPLATE(T, poly_t) f, slong mult,
+                                    flint_rand_t state,
+                                    const TEMPLATE(T, ctx_t) ctx)
+{
+    TEMPLATE(T, poly_t) g, x, finv;
+    fmpz_t q;
+
+    if (f->length <= 2)
+    {
+        __TEMPLATE(T, poly_roots_split) (r, f, mult, state, ctx);
+        return;
+    }
+
+    TEMPLATE(T, poly_init) (g, ctx);
+    TEMPLATE(T, poly_init) (x, ctx);
+    TEMPLATE(T, poly_init) (finv, ctx);
+    fmpz_init(q);
+
+    TEMPLATE(T, ctx_order) (q, ctx);
+
+    TEMPLATE(T, poly_reverse) (finv, f, f->length, ctx);
+    TEMPLATE(T, poly_inv_series_newton) (finv, finv, f->length, ctx);
+
+    /* gcd(f, x^q - x) is the product of the distinct linear factors */
+    TEMPLATE(T, poly_powmod_x_fmpz_preinv) (g, q, f, finv, ctx);
+    TEMPLATE(T, poly_gen) (x, ctx);
+    TEMPLATE(T, poly_sub) (g, g, x, ctx);
+    TEMPLATE(T, poly_gcd) (x, g, f, ctx);
+
+    __TEMPLATE(T, poly_roots_split) (r, x, mult, state, ctx);
+
+    fmpz_clear(q);
+    TEMPLATE(T, poly_clear) (g, ctx);
+    TEMPLATE(T, poly_clear) (x, ctx);
+    TEMPLATE(T, poly_clear) (finv, ctx);
+}
+
+void
+TEMPLATE(T, poly_roots) (TEMPLATE(T, poly_factor_t) r,
+                         const TEMPLATE(T, poly_t) f, int with_multiplicity,
+                         const TEMPLATE(T, ctx_t) ctx)
+{
+    TEMPLATE(T, poly_t) v;
+    flint_rand_t state;
+    slong i;
+
+    r->num = 0;
+
+    if (f->length == 0)
+    {
+        TEMPLATE_PRINTF("Exception (%s_poly_roots). ", T);
+        flint_printf("Input polynomial is zero.\n");
+        abort();
+    }
+
+    if (f->length == 1)
+        return;
+
+    TEMPLATE(T, poly_init) (v, ctx);
+    TEMPLATE(T, poly_make_monic) (v, f, ctx);
+
+    flint_randinit(state);
+
+    if (with_multiplicity)
+    {
+        TEMPLATE(T, poly_factor_t) sqf;
+
+        TEMPLATE(T, poly_factor_init) (sqf, ctx);
+        TEMPLATE(T, poly_factor_squarefree) (sqf, v, ctx);
+
+        for (i = 0; i < sqf->num; i++)
+            __TEMPLATE(T, poly_roots_distinct) (r, sqf->poly + i, sqf->exp[i],
+                                                state, ctx);
+
+        TEMPLATE(T, poly_factor_clear) (sqf, ctx);
+    }
+    else
+    {
+        __TEMPLATE(T, poly_roots_distinct) (r, v, 1, state, ctx);
+    }
+
+    flint_randclear(state);
+    TEMPLATE(T, poly_clear) (v, ctx);
+}
+
+#endif
@@ -0,0 +1,132 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#ifdef T
+
+#include "templates.h"
+
+#include <stdlib.h>
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("factor_distinct_deg_threaded....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 50 * flint_test_multiplier(); iter++)
+    {
+        TEMPLATE(T, ctx_t) ctx;
+        TEMPLATE(T, poly_t) poly1, poly, q, r;
+        TEMPLATE(T, poly_factor_t) res1, res2;
+        slong i, j, length, num;
+        slong *degs1, *degs2;
+        int result;
+
+        TEMPLATE(T, ctx_randtest) (ctx, state);
+
+        TEMPLATE(T, poly_init) (poly1, ctx);
+        TEMPLATE(T, poly_init) (poly, ctx);
+        TEMPLATE(T, poly_init) (q, ctx);
+        TEMPLATE(T, poly_init) (r, ctx);
+
+        TEMPLATE(T, poly_one) (poly1, ctx);
+
+        num = n_randint(state, 8) + 1;
+
+        for (i = 0; i < num; i++)
+        {
+            do
+            {
+                length = n_randint(state, 10) + 2;
+                TEMPLATE(T, poly_randtest) (poly, state, length, ctx);
+                if (poly->length)
+                {
+                    TEMPLATE(T, poly_make_monic) (poly, poly, ctx);
+                    TEMPLATE(T, poly_divrem) (q, r, poly1, poly, ctx);
+                }
+            }
+            while ((poly->length < 2)
+                   || (!TEMPLATE(T, poly_is_irreducible) (poly, ctx))
+                   || (r->length == 0));
+
+            TEMPLATE(T, poly_mul) (poly1, poly1, poly, ctx);
+        }
+
+        degs1 = flint_malloc((poly1->length - 1) * sizeof(slong));
+        degs2 = flint_malloc((poly1->length - 1) * sizeof(slong));
+
+        TEMPLATE(T, poly_factor_init) (res1, ctx);
+        TEMPLATE(T, poly_factor_init) (res2, ctx);
+
+        TEMPLATE(T, poly_factor_distinct_deg) (res1, poly1, &degs1, ctx);
+
+        flint_set_num_threads(n_randint(state, 5) + 2);
+        TEMPLATE(T, poly_factor_distinct_deg_threaded) (res2, poly1, &degs2,
+                                                        ctx);
+        flint_set_num_threads(1);
+
+        /* both must find the same parts, possibly in a different order */
+        result = (res1->num == res2->num);
+        for (i = 0; result && i < res2->num; i++)
+        {
+            for (j = 0; j < res1->num; j++)
+                if (degs1[j] == degs2[i] &&
+                    TEMPLATE(T, poly_equal) (res1->poly + j,
+                                             res2->poly + i, ctx))
+                    break;
+            result = (j < res1->num);
+        }
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("poly:\n");
+            TEMPLATE(T, poly_print) (poly1, ctx);
+            flint_printf("\n");
+            abort();
+        }
+
+        flint_free(degs1);
+        flint_free(degs2);
+        TEMPLATE(T, poly_clear) (q, ctx);
+        TEMPLATE(T, poly_clear) (r, ctx);
+        TEMPLATE(T, poly_clear) (poly1, ctx);
+        TEMPLATE(T, poly_clear) (poly, ctx);
+        TEMPLATE(T, poly_factor_clear) (res1, ctx);
+        TEMPLATE(T, poly_factor_clear) (res2, ctx);
+
+        TEMPLATE(T, ctx_clear) (ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
+
+#endif
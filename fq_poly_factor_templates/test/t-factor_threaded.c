@@ -0,0 +1,152 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#ifdef T
+
+#include "templates.h"
+
+#include <stdlib.h>
+#include "ulong_extras.h"
+
+/* whether a and b hold the same factors with the same exponents */
+static int
+TEMPLATE(T, poly_factor_same) (const TEMPLATE(T, poly_factor_t) a,
+                               const TEMPLATE(T, poly_factor_t) b,
+                               const TEMPLATE(T, ctx_t) ctx)
+{
+    slong i, j;
+
+    if (a->num != b->num)
+        return 0;
+
+    for (i = 0; i < a->num; i++)
+    {
+        for (j = 0; j < b->num; j++)
+            if (a->exp[i] == b->exp[j] &&
+                TEMPLATE(T, poly_equal) (a->poly + i, b->poly + j, ctx))
+                break;
+        if (j == b->num)
+            return 0;
+    }
+
+    return 1;
+}
+
+int
+main(void)
+{
+    int iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("factor_threaded....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 30 * flint_test_multiplier(); iter++)
+    {
+        TEMPLATE(T, ctx_t) ctx;
+        TEMPLATE(T, poly_t) poly1, poly, q, r;
+        TEMPLATE(T, poly_factor_t) res1, res2;
+        slong i, j, length, num, e;
+        int algorithm;
+
+        TEMPLATE(T, ctx_randtest) (ctx, state);
+
+        TEMPLATE(T, poly_init) (poly1, ctx);
+        TEMPLATE(T, poly_init) (poly, ctx);
+        TEMPLATE(T, poly_init) (q, ctx);
+        TEMPLATE(T, poly_init) (r, ctx);
+
+        TEMPLATE(T, poly_one) (poly1, ctx);
+
+        /* few distinct lengths, so that equal-degree parts need splitting */
+        num = n_randint(state, 8) + 1;
+        for (i = 0; i < num; i++)
+        {
+            do
+            {
+                length = n_randint(state, 4) + 2;
+                TEMPLATE(T, poly_randtest) (poly, state, length, ctx);
+                if (poly->length)
+                {
+                    TEMPLATE(T, poly_make_monic) (poly, poly, ctx);
+                    TEMPLATE(T, poly_divrem) (q, r, poly1, poly, ctx);
+                }
+            }
+            while ((poly->length < 2)
+                   || (!TEMPLATE(T, poly_is_irreducible) (poly, ctx))
+                   || (r->length == 0));
+
+            e = n_randint(state, 3) + 1;
+            for (j = 0; j < e; j++)
+                TEMPLATE(T, poly_mul) (poly1, poly1, poly, ctx);
+        }
+
+        TEMPLATE(T, poly_factor_init) (res1, ctx);
+        TEMPLATE(T, poly_factor_init) (res2, ctx);
+
+        algorithm = n_randint(state, 3);
+
+        if (algorithm == 0)
+            TEMPLATE(T, poly_factor_kaltofen_shoup) (res1, poly1, ctx);
+        else if (algorithm == 1)
+            TEMPLATE(T, poly_factor_cantor_zassenhaus) (res1, poly1, ctx);
+        else
+            TEMPLATE(T, poly_factor_berlekamp) (res1, poly1, ctx);
+
+        flint_set_num_threads(n_randint(state, 5) + 2);
+        if (algorithm == 0)
+            TEMPLATE(T, poly_factor_kaltofen_shoup) (res2, poly1, ctx);
+        else if (algorithm == 1)
+            TEMPLATE(T, poly_factor_cantor_zassenhaus) (res2, poly1, ctx);
+        else
+            TEMPLATE(T, poly_factor_berlekamp) (res2, poly1, ctx);
+        flint_set_num_threads(1);
+
+        if (!TEMPLATE(T, poly_factor_same) (res1, res2, ctx))
+        {
+            flint_printf("FAIL (algorithm %d):\n", algorithm);
+            flint_printf("poly:\n");
+            TEMPLATE(T, poly_print) (poly1, ctx);
+            flint_printf("\n");
+            flint_printf("%wd factors vs %wd threaded\n", res1->num, res2->num);
+            abort();
+        }
+
+        TEMPLATE(T, poly_clear) (q, ctx);
+        TEMPLATE(T, poly_clear) (r, ctx);
+        TEMPLATE(T, poly_clear) (poly1, ctx);
+        TEMPLATE(T, poly_clear) (poly, ctx);
+        TEMPLATE(T, poly_factor_clear) (res1, ctx);
+        TEMPLATE(T, poly_factor_clear) (res2, ctx);
+
+        TEMPLATE(T, ctx_clear) (ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
+
+#endif
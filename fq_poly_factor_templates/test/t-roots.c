@@ -0,0 +1,129 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#ifdef T
+
+#include "templates.h"
+
+#include <stdlib.h>
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("roots....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 100 * flint_test_multiplier(); iter++)
+    {
+        TEMPLATE(T, ctx_t) ctx;
+        TEMPLATE(T, poly_t) f, g;
+        TEMPLATE(T, poly_factor_t) r, fac;
+        TEMPLATE(T, t) a;
+        slong i, j, k, num, e, lin;
+        int mult, result;
+
+        TEMPLATE(T, ctx_randtest) (ctx, state);
+
+        TEMPLATE(T, poly_init) (f, ctx);
+        TEMPLATE(T, poly_init) (g, ctx);
+        TEMPLATE(T, init) (a, ctx);
+        TEMPLATE(T, poly_factor_init) (r, ctx);
+        TEMPLATE(T, poly_factor_init) (fac, ctx);
+
+        TEMPLATE(T, randtest_not_zero) (a, state, ctx);
+        TEMPLATE(T, poly_set_coeff) (f, 0, a, ctx);
+
+        /* random linear factors with multiplicity */
+        num = n_randint(state, 10);
+        for (i = 0; i < num; i++)
+        {
+            TEMPLATE(T, randtest) (a, state, ctx);
+            TEMPLATE(T, poly_gen) (g, ctx);
+            TEMPLATE(T, poly_set_coeff) (g, 0, a, ctx);
+            e = n_randint(state, 3) + 1;
+            for (j = 0; j < e; j++)
+                TEMPLATE(T, poly_mul) (f, f, g, ctx);
+        }
+
+        /* and some noise, possibly with further roots */
+        TEMPLATE(T, poly_randtest) (g, state, n_randint(state, 8), ctx);
+        if (!TEMPLATE(T, poly_is_zero) (g, ctx))
+            TEMPLATE(T, poly_mul) (f, f, g, ctx);
+
+        mult = n_randint(state, 2);
+        TEMPLATE(T, poly_roots) (r, f, mult, ctx);
+
+        /* compare with the linear factors of the full factorisation */
+        TEMPLATE(T, poly_factor) (fac, a, f, ctx);
+
+        result = 1;
+        lin = 0;
+        for (i = 0; i < fac->num; i++)
+        {
+            if (fac->poly[i].length != 2)
+                continue;
+
+            lin++;
+            for (k = 0; k < r->num; k++)
+                if (TEMPLATE(T, poly_equal) (fac->poly + i, r->poly + k, ctx))
+                    break;
+
+            result = result && (k < r->num) &&
+                     (r->exp[k] == (mult ? fac->exp[i] : 1));
+        }
+        result = result && (lin == r->num);
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("with_multiplicity = %d\n", mult);
+            TEMPLATE(T, poly_print) (f, ctx);
+            flint_printf("\n\n");
+            TEMPLATE(T, poly_factor_print) (r, ctx);
+            flint_printf("\n\n");
+            TEMPLATE(T, poly_factor_print) (fac, ctx);
+            flint_printf("\n\n");
+            abort();
+        }
+
+        TEMPLATE(T, poly_clear) (f, ctx);
+        TEMPLATE(T, poly_clear) (g, ctx);
+        TEMPLATE(T, clear) (a, ctx);
+        TEMPLATE(T, poly_factor_clear) (r, ctx);
+        TEMPLATE(T, poly_factor_clear) (fac, ctx);
+
+        TEMPLATE(T, ctx_clear) (ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
+
+#endif
@@ -885,6 +885,16 @@ FLINT_DLL void TEMPLATE(T, poly_div_newton_n_preinv) (TEMPLATE(T, poly_t) Q,
                                        const TEMPLATE(T, poly_t) Binv,
                                        const TEMPLATE(T, ctx_t) ctx);
 
+FLINT_DLL slong _TEMPLATE(T, poly_sparse_terms) (slong * exps,
+                                 const TEMPLATE(T, struct) * f, slong lenf,
+                                 const TEMPLATE(T, ctx_t) ctx);
+
+FLINT_DLL void _TEMPLATE(T, poly_rem_sparse) (TEMPLATE(T, struct) * R,
+                               TEMPLATE(T, struct) * A, slong lenA,
+                               const TEMPLATE(T, struct) * f, slong lenf,
+                               const slong * exps, slong t,
+                               const TEMPLATE(T, ctx_t) ctx);
+
 FLINT_DLL void _TEMPLATE(T, poly_divrem_newton_n_preinv) (
     TEMPLATE(T, struct)* Q, TEMPLATE(T, struct)* R,
     const TEMPLATE(T, struct)* A, slong lenA,
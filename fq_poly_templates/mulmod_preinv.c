@@ -41,6 +41,7 @@ _TEMPLATE(T, poly_mulmod_preinv) (
     const TEMPLATE(T, ctx_t) ctx)
 {
     TEMPLATE(T, struct) * T, *Q;
+    slong exps[TEMPLATE(CAP_T, POLY_SPARSE_TERMS)], t;
     slong lenT, lenQ;
 
     lenT = len1 + len2 - 1;
@@ -49,13 +50,18 @@ _TEMPLATE(T, poly_mulmod_preinv) (
     T = _TEMPLATE(T, vec_init) (lenT + lenQ, ctx);
     Q = T + lenT;
 
+    t = _TEMPLATE(T, poly_sparse_terms) (exps, f, lenf, ctx);
+
     if (len1 >= len2)
         _TEMPLATE(T, poly_mul) (T, poly1, len1, poly2, len2, ctx);
     else
         _TEMPLATE(T, poly_mul) (T, poly2, len2, poly1, len1, ctx);
 
-    _TEMPLATE(T, poly_divrem_newton_n_preinv) (Q, res, T, lenT, f, lenf,
-                                               finv, lenfinv, ctx);
+    if (t >= 0)
+        _TEMPLATE(T, poly_rem_sparse) (res, T, lenT, f, lenf, exps, t, ctx);
+    else
+        _TEMPLATE(T, poly_divrem_newton_n_preinv) (Q, res, T, lenT, f, lenf,
+                                                   finv, lenfinv, ctx);
     _TEMPLATE(T, vec_clear) (T, lenT + lenQ, ctx);
 }
 
@@ -38,6 +38,7 @@ _TEMPLATE(T, poly_powmod_fmpz_sliding_preinv) (
     const TEMPLATE(T, ctx_t) ctx)
 {
     TEMPLATE(T, struct) * T, *Q;
+    slong exps[TEMPLATE(CAP_T, POLY_SPARSE_TERMS)], t;
     TEMPLATE(T, poly_struct) * precomp;
     TEMPLATE(T, poly_t) poly_squared;
     ulong twokm1;
@@ -57,6 +58,8 @@ _TEMPLATE(T, poly_powmod_fmpz_sliding_preinv) (
     T = _TEMPLATE(T, vec_init) (lenT + lenQ, ctx);
     Q = T + lenT;
 
+    t = _TEMPLATE(T, poly_sparse_terms) (exps, f, lenf, ctx);
+
     /* Precomputation */
     twokm1 = n_pow(2, k - 1);
     precomp = flint_malloc(twokm1 * sizeof(TEMPLATE(T, poly_struct)));
@@ -69,9 +72,15 @@ _TEMPLATE(T, poly_powmod_fmpz_sliding_preinv) (
     {
         TEMPLATE(T, poly_fit_length) (poly_squared, lenf - 1, ctx);
         _TEMPLATE(T, poly_mul) (T, poly, lenf - 1, poly, lenf - 1, ctx);
-        _TEMPLATE(T, poly_divrem_newton_n_preinv) (Q, poly_squared->coeffs, T,
-                                                   2 * lenf - 3, f, lenf, finv,
-                                                   lenfinv, ctx);
+        if (t >= 0)
+            _TEMPLATE(T, poly_rem_sparse) (poly_squared->coeffs, T,
+                                           2 * lenf - 3, f, lenf, exps, t,
+                                           ctx);
+        else
+            _TEMPLATE(T, poly_divrem_newton_n_preinv) (Q, poly_squared->coeffs,
+                                                       T, 2 * lenf - 3, f,
+                                                       lenf, finv, lenfinv,
+                                                       ctx);
     }
     for (i = 1; i < twokm1; i++)
     {
@@ -79,9 +88,16 @@ _TEMPLATE(T, poly_powmod_fmpz_sliding_preinv) (
         TEMPLATE(T, poly_fit_length) (precomp + i, lenf - 1, ctx);
         _TEMPLATE(T, poly_mul) (T, (precomp + i - 1)->coeffs, lenf - 1,
                                 poly_squared->coeffs, lenf - 1, ctx);
-        _TEMPLATE(T, poly_divrem_newton_n_preinv) (Q, (precomp + i)->coeffs, T,
-                                                   2 * lenf - 3, f, lenf, finv,
-                                                   lenfinv, ctx);
+        if (t >= 0)
+            _TEMPLATE(T, poly_rem_sparse) ((precomp + i)->coeffs, T,
+                                           2 * lenf - 3, f, lenf, exps, t,
+                                           ctx);
+        else
+            _TEMPLATE(T, poly_divrem_newton_n_preinv) (Q,
+                                                       (precomp + i)->coeffs,
+                                                       T, 2 * lenf - 3, f,
+                                                       lenf, finv, lenfinv,
+                                                       ctx);
     }
 
     _TEMPLATE(T, vec_set) (res, poly, lenf - 1, ctx);
@@ -92,9 +108,14 @@ _TEMPLATE(T, poly_powmod_fmpz_sliding_preinv) (
         if (fmpz_tstbit(e, i) == 0)
         {
             _TEMPLATE(T, poly_sqr) (T, res, lenf - 1, ctx);
-            _TEMPLATE(T, poly_divrem_newton_n_preinv) (Q, res, T, 2 * lenf - 3,
-                                                       f, lenf, finv, lenfinv,
-                                                       ctx);
+            if (t >= 0)
+                _TEMPLATE(T, poly_rem_sparse) (res, T, 2 * lenf - 3, f, lenf,
+                                               exps, t, ctx);
+            else
+                _TEMPLATE(T, poly_divrem_newton_n_preinv) (Q, res, T,
+                                                           2 * lenf - 3, f,
+                                                           lenf, finv, lenfinv,
+                                                           ctx);
             i -= 1;
         }
         else
@@ -107,10 +128,14 @@ _TEMPLATE(T, poly_powmod_fmpz_sliding_preinv) (
             for (j = 0; j < i - l + 1; j++)
             {
                 _TEMPLATE(T, poly_sqr) (T, res, lenf - 1, ctx);
-                _TEMPLATE(T, poly_divrem_newton_n_preinv) (Q, res, T,
-                                                           2 * lenf - 3, f,
-                                                           lenf, finv, lenfinv,
-                                                           ctx);
+                if (t >= 0)
+                    _TEMPLATE(T, poly_rem_sparse) (res, T, 2 * lenf - 3, f,
+                                                   lenf, exps, t, ctx);
+                else
+                    _TEMPLATE(T, poly_divrem_newton_n_preinv) (Q, res, T,
+                                                               2 * lenf - 3, f,
+                                                               lenf, finv,
+                                                               lenfinv, ctx);
             }
 
             index = fmpz_tstbit(e, i);
@@ -123,9 +148,14 @@ _TEMPLATE(T, poly_powmod_fmpz_sliding_preinv) (
 
             _TEMPLATE(T, poly_mul) (T, res, lenf - 1,
                                     (precomp + index)->coeffs, lenf - 1, ctx);
-            _TEMPLATE(T, poly_divrem_newton_n_preinv) (Q, res, T, 2 * lenf - 3,
-                                                       f, lenf, finv, lenfinv,
-                                                       ctx);
+            if (t >= 0)
+                _TEMPLATE(T, poly_rem_sparse) (res, T, 2 * lenf - 3, f, lenf,
+                                               exps, t, ctx);
+            else
+                _TEMPLATE(T, poly_divrem_newton_n_preinv) (Q, res, T,
+                                                           2 * lenf - 3, f,
+                                                           lenf, finv, lenfinv,
+                                                           ctx);
             i = l - 1;
         }
     }
@@ -38,6 +38,7 @@ _TEMPLATE(T, poly_powmod_ui_binexp_preinv) (
     const TEMPLATE(T, ctx_t) ctx)
 {
     TEMPLATE(T, struct) * T, *Q;
+    slong exps[TEMPLATE(CAP_T, POLY_SPARSE_TERMS)], t;
     slong lenT, lenQ;
     int i;
 
@@ -53,20 +54,32 @@ _TEMPLATE(T, poly_powmod_ui_binexp_preinv) (
     T = _TEMPLATE(T, vec_init) (lenT + lenQ, ctx);
     Q = T + lenT;
 
+    t = _TEMPLATE(T, poly_sparse_terms) (exps, f, lenf, ctx);
+
     _TEMPLATE(T, vec_set) (res, poly, lenf - 1, ctx);
 
     for (i = ((int)FLINT_BIT_COUNT(e) - 2); i >= 0; i--)
     {
         _TEMPLATE(T, poly_sqr) (T, res, lenf - 1, ctx);
-        _TEMPLATE(T, poly_divrem_newton_n_preinv) (Q, res, T, 2 * lenf - 3, f,
-                                                   lenf, finv, lenfinv, ctx);
+        if (t >= 0)
+            _TEMPLATE(T, poly_rem_sparse) (res, T, 2 * lenf - 3, f, lenf, exps,
+                                           t, ctx);
+        else
+            _TEMPLATE(T, poly_divrem_newton_n_preinv) (Q, res, T, 2 * lenf - 3,
+                                                       f, lenf, finv, lenfinv,
+                                                       ctx);
 
         if (e & (UWORD(1) << i))
         {
             _TEMPLATE(T, poly_mul) (T, res, lenf - 1, poly, lenf - 1, ctx);
-            _TEMPLATE(T, poly_divrem_newton_n_preinv) (Q, res, T, 2 * lenf - 3,
-                                                       f, lenf, finv, lenfinv,
-                                                       ctx);
+            if (t >= 0)
+                _TEMPLATE(T, poly_rem_sparse) (res, T, 2 * lenf - 3, f, lenf,
+                                               exps, t, ctx);
+            else
+                _TEMPLATE(T, poly_divrem_newton_n_preinv) (Q, res, T,
+                                                           2 * lenf - 3, f,
+                                                           lenf, finv, lenfinv,
+                                                           ctx);
         }
     }
 
@@ -39,6 +39,7 @@ _TEMPLATE(T, poly_powmod_x_fmpz_preinv) (
     const TEMPLATE(T, ctx_t) ctx)
 {
     TEMPLATE(T, struct) * T, *Q;
+    slong exps[TEMPLATE(CAP_T, POLY_SPARSE_TERMS)], t;
     slong lenT, lenQ;
     slong i, window, l, c;
 
@@ -48,6 +49,8 @@ _TEMPLATE(T, poly_powmod_x_fmpz_preinv) (
     T = _TEMPLATE(T, vec_init) (lenT + lenQ, ctx);
     Q = T + lenT;
 
+    t = _TEMPLATE(T, poly_sparse_terms) (exps, f, lenf, ctx);
+
     TEMPLATE(T, one) (res, ctx);
     _TEMPLATE(T, vec_zero) (res + 1, lenf - 2, ctx);
 
@@ -68,9 +71,14 @@ _TEMPLATE(T, poly_powmod_x_fmpz_preinv) (
     if (c == 0)
     {
         _TEMPLATE(T, poly_shift_left) (T, res, lenf - 1, window, ctx);
-        _TEMPLATE(T, poly_divrem_newton_n_preinv) (Q, res, T,
-                                                   lenf - 1 + window, f, lenf,
-                                                   finv, lenfinv, ctx);
+        if (t >= 0)
+            _TEMPLATE(T, poly_rem_sparse) (res, T, lenf - 1 + window, f, lenf,
+                                           exps, t, ctx);
+        else
+            _TEMPLATE(T, poly_divrem_newton_n_preinv) (Q, res, T,
+                                                       lenf - 1 + window, f,
+                                                       lenf, finv, lenfinv,
+                                                       ctx);
         c = l + 1;
         window = 0;
     }
@@ -78,8 +86,13 @@ _TEMPLATE(T, poly_powmod_x_fmpz_preinv) (
     for (; i >= 0; i--)
     {
         _TEMPLATE(T, poly_sqr) (T, res, lenf - 1, ctx);
-        _TEMPLATE(T, poly_divrem_newton_n_preinv) (Q, res, T, 2 * lenf - 3, f,
-                                                   lenf, finv, lenfinv, ctx);
+        if (t >= 0)
+            _TEMPLATE(T, poly_rem_sparse) (res, T, 2 * lenf - 3, f, lenf, exps,
+                                           t, ctx);
+        else
+            _TEMPLATE(T, poly_divrem_newton_n_preinv) (Q, res, T, 2 * lenf - 3,
+                                                       f, lenf, finv, lenfinv,
+                                                       ctx);
 
         c--;
         if (fmpz_tstbit(e, i))
@@ -97,10 +110,14 @@ _TEMPLATE(T, poly_powmod_x_fmpz_preinv) (
         {
             _TEMPLATE(T, poly_shift_left) (T, res, lenf - 1, window, ctx);
 
-            _TEMPLATE(T, poly_divrem_newton_n_preinv) (Q, res, T,
-                                                       lenf - 1 + window, f,
-                                                       lenf, finv, lenfinv,
-                                                       ctx);
+            if (t >= 0)
+                _TEMPLATE(T, poly_rem_sparse) (res, T, lenf - 1 + window, f,
+                                               lenf, exps, t, ctx);
+            else
+                _TEMPLATE(T, poly_divrem_newton_n_preinv) (Q, res, T,
+                                                           lenf - 1 + window,
+                                                           f, lenf, finv,
+                                                           lenfinv, ctx);
             c = l + 1;
             window = 0;
         }
@@ -0,0 +1,63 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#ifdef T
+
+#include "templates.h"
+
+void
+_TEMPLATE(T, poly_rem_sparse) (TEMPLATE(T, struct) * R,
+                               TEMPLATE(T, struct) * A, slong lenA,
+                               const TEMPLATE(T, struct) * f, slong lenf,
+                               const slong * exps, slong t,
+                               const TEMPLATE(T, ctx_t) ctx)
+{
+    const slong n = lenf - 1;
+    TEMPLATE(T, t) c;
+    slong i, j;
+
+    TEMPLATE(T, init) (c, ctx);
+
+    /* x^n = -sum_j f[e_j] x^{e_j}, eliminating from the top */
+    for (i = lenA - 1; i >= n; i--)
+    {
+        if (!TEMPLATE(T, is_zero) (A + i, ctx))
+        {
+            for (j = 0; j < t; j++)
+            {
+                TEMPLATE(T, mul) (c, A + i, f + exps[j], ctx);
+                TEMPLATE(T, sub) (A + i - n + exps[j],
+                                  A + i - n + exps[j], c, ctx);
+            }
+        }
+    }
+
+    TEMPLATE(T, clear) (c, ctx);
+
+    if (R != A)
+        _TEMPLATE(T, vec_set) (R, A, n, ctx);
+}
+
+#endif
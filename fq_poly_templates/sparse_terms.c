@@ -0,0 +1,53 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#ifdef T
+
+#include "templates.h"
+
+slong
+_TEMPLATE(T, poly_sparse_terms) (slong * exps,
+                                 const TEMPLATE(T, struct) * f, slong lenf,
+                                 const TEMPLATE(T, ctx_t) ctx)
+{
+    slong i, t = 0;
+
+    if (lenf < 2 || !TEMPLATE(T, is_one) (f + lenf - 1, ctx))
+        return -1;
+
+    for (i = 0; i < lenf - 1; i++)
+    {
+        if (!TEMPLATE(T, is_zero) (f + i, ctx))
+        {
+            if (t == TEMPLATE(CAP_T, POLY_SPARSE_TERMS))
+                return -1;
+            exps[t++] = i;
+        }
+    }
+
+    return t;
+}
+
+#endif
@@ -34,6 +34,8 @@
 /* #define FQ_TEMPLATES_INLINE static __inline__ */
 #endif
 
+#include <stdint.h>
+
 #include "fq_nmod.h"
 
 /* Data types and context ****************************************************/
@@ -48,6 +50,30 @@ typedef struct
 
 typedef fq_zech_struct fq_zech_t[1];
 
+#define FQ_ZECH_TABLES_MAGIC UWORD(0x5A454348)
+
+/*
+    Zech logarithm, prime field and evaluation tables for one (p, modulus),
+    shared between all contexts with that modulus via a process-wide cache.
+    Entries are stored with the narrowest width (2, 4 or 8 bytes) that can
+    hold q - 1.
+*/
+typedef struct fq_zech_tables_struct
+{
+    mp_limb_t p;
+    mp_limb_t q;
+    nmod_poly_struct modulus;
+    slong ref_count;
+    int width;
+    int mapped;                 /* data is a mapped table file */
+    void * data;
+    size_t size;
+    void * zech_log_table;
+    void * prime_field_table;
+    void * eval_table;
+    struct fq_zech_tables_struct * next;
+} fq_zech_tables_struct;
+
 typedef struct
 {
     mp_limb_t qm1;              /* q - 1 */
@@ -56,9 +82,11 @@ typedef struct
     mp_limb_t p;
     double ppre;
     mp_limb_t prime_root;       /* primitive root for prime subfield */
-    mp_limb_t *zech_log_table;
-    mp_limb_t *prime_field_table;
-    mp_limb_t *eval_table;
+    int table_width;            /* bytes per table entry */
+    void *zech_log_table;
+    void *prime_field_table;
+    void *eval_table;
+    fq_zech_tables_struct *tables;
 
     fq_nmod_ctx_struct *fq_nmod_ctx;
     int owns_fq_nmod_ctx;
@@ -85,6 +113,82 @@ FLINT_DLL void fq_zech_ctx_randtest_reducible(fq_zech_ctx_t ctx, flint_rand_t st
 
 FLINT_DLL void fq_zech_ctx_clear(fq_zech_ctx_t ctx);
 
+FLINT_DLL int fq_zech_ctx_init_fq_nmod_ctx_mmap(fq_zech_ctx_t ctx,
+                         fq_nmod_ctx_t ctxn, const char * filename);
+
+FLINT_DLL int fq_zech_ctx_write_tables(const fq_zech_ctx_t ctx,
+                                                       const char * filename);
+
+FLINT_DLL void _fq_zech_ctx_init_params(fq_zech_ctx_t ctx,
+                                                     fq_nmod_ctx_t ctxn);
+
+/* Tables ********************************************************************/
+
+FLINT_DLL int _fq_zech_tables_width(mp_limb_t q);
+
+FLINT_DLL fq_zech_tables_struct * _fq_zech_tables_compute(
+                                              const fq_nmod_ctx_t ctxn);
+
+FLINT_DLL void _fq_zech_tables_free(fq_zech_tables_struct * tables);
+
+FLINT_DLL fq_zech_tables_struct * _fq_zech_tables_lookup(mp_limb_t p,
+                                              const nmod_poly_t modulus);
+
+FLINT_DLL fq_zech_tables_struct * _fq_zech_tables_insert(
+                                          fq_zech_tables_struct * tables);
+
+FLINT_DLL void _fq_zech_tables_release(fq_zech_tables_struct * tables);
+
+FQ_ZECH_INLINE mp_limb_t
+_fq_zech_table_get(const void * table, mp_limb_t i, int width)
+{
+    if (width == 2)
+        return ((const uint16_t *) table)[i];
+    else if (width == 4)
+        return ((const uint32_t *) table)[i];
+    else
+        return ((const mp_limb_t *) table)[i];
+}
+
+FQ_ZECH_INLINE void
+_fq_zech_table_set(void * table, mp_limb_t i, mp_limb_t x, int width)
+{
+    if (width == 2)
+        ((uint16_t *) table)[i] = x;
+    else if (width == 4)
+        ((uint32_t *) table)[i] = x;
+    else
+        ((mp_limb_t *) table)[i] = x;
+}
+
+FQ_ZECH_INLINE void
+_fq_zech_ctx_set_tables(fq_zech_ctx_t ctx, fq_zech_tables_struct * tables)
+{
+    ctx->tables = tables;
+    ctx->table_width = tables->width;
+    ctx->zech_log_table = tables->zech_log_table;
+    ctx->prime_field_table = tables->prime_field_table;
+    ctx->eval_table = tables->eval_table;
+}
+
+FQ_ZECH_INLINE mp_limb_t
+fq_zech_ctx_zech_log(const fq_zech_ctx_t ctx, mp_limb_t i)
+{
+    return _fq_zech_table_get(ctx->zech_log_table, i, ctx->table_width);
+}
+
+FQ_ZECH_INLINE mp_limb_t
+fq_zech_ctx_prime_field_log(const fq_zech_ctx_t ctx, mp_limb_t i)
+{
+    return _fq_zech_table_get(ctx->prime_field_table, i, ctx->table_width);
+}
+
+FQ_ZECH_INLINE mp_limb_t
+fq_zech_ctx_eval(const fq_zech_ctx_t ctx, mp_limb_t i)
+{
+    return _fq_zech_table_get(ctx->eval_table, i, ctx->table_width);
+}
+
 FQ_ZECH_INLINE slong
 fq_zech_ctx_degree(const fq_zech_ctx_t ctx)
 {
@@ -42,7 +42,7 @@ fq_zech_add(fq_zech_t rop, const fq_zech_t op1, const fq_zech_t op2,
     {
         index = n_submod(op1->value, op2->value, ctx->qm1);
 
-        c = ctx->zech_log_table[index];
+        c = fq_zech_ctx_zech_log(ctx, index);
         if (c != ctx->qm1)
         {
             c = n_addmod(c, op2->value, ctx->qm1);
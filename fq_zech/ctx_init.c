@@ -91,15 +91,10 @@ fq_zech_ctx_init_modulus(fq_zech_ctx_t ctx,
 
 
 void
-fq_zech_ctx_init_fq_nmod_ctx(fq_zech_ctx_t ctx,
-                             fq_nmod_ctx_t fq_nmod_ctx)
+_fq_zech_ctx_init_params(fq_zech_ctx_t ctx, fq_nmod_ctx_t fq_nmod_ctx)
 {
-    ulong i, n;
-    fq_nmod_t r, gen;
-    slong up, q;
-    fmpz_t result, order;
-    mp_limb_t j, nz, result_ui;
-    mp_limb_t *n_reverse_table;
+    mp_limb_t up, q;
+    fmpz_t order;
 
     ctx->fq_nmod_ctx = fq_nmod_ctx;
     ctx->owns_fq_nmod_ctx = 0;
@@ -133,55 +128,24 @@ fq_zech_ctx_init_fq_nmod_ctx(fq_zech_ctx_t ctx,
 
     ctx->prime_root = n_primitive_root_prime(ctx->p);
 
-    ctx->zech_log_table = (mp_limb_t *) flint_malloc(q * sizeof(mp_limb_t));
-    ctx->prime_field_table = (mp_limb_t *) flint_malloc(up * sizeof(mp_limb_t));
-    n_reverse_table = (mp_limb_t *) flint_malloc(q * sizeof(mp_limb_t));
-    ctx->eval_table = (mp_limb_t *) flint_malloc(q * sizeof(mp_limb_t));
-
-    ctx->zech_log_table[ctx->qm1] = 0;
-    ctx->prime_field_table[0] = ctx->qm1;
-    n_reverse_table[0] = ctx->qm1;
-    ctx->eval_table[ctx->qm1] = 0;
+    fmpz_clear(order);
+}
 
-    fq_nmod_init(r, ctx->fq_nmod_ctx);
-    fq_nmod_init(gen, ctx->fq_nmod_ctx);
-    fq_nmod_one(r, ctx->fq_nmod_ctx);
-    fq_nmod_gen(gen, ctx->fq_nmod_ctx);
+void
+fq_zech_ctx_init_fq_nmod_ctx(fq_zech_ctx_t ctx,
+                             fq_nmod_ctx_t fq_nmod_ctx)
+{
+    fq_zech_tables_struct * tables;
 
-    fmpz_init(result);
+    _fq_zech_ctx_init_params(ctx, fq_nmod_ctx);
 
-    for (i = 0; i < ctx->qm1; i++)
-    {
-        nmod_poly_evaluate_fmpz(result, r, fq_nmod_ctx_prime(fq_nmod_ctx));
-        result_ui = fmpz_get_ui(result);
-        n_reverse_table[result_ui] = i;
-        ctx->eval_table[i] = result_ui;
-        if (r->length == 1)
-        {
-            ctx->prime_field_table[result_ui] = i;
-        }
-        fq_nmod_mul(r, r, gen, fq_nmod_ctx);
-    }
+    tables = _fq_zech_tables_lookup(ctx->p, fq_nmod_ctx->modulus);
 
-    i = 1;
-    for (i = 0; i < q; i++)
+    if (tables == NULL)
     {
-        j = n_reverse_table[i];
-        n = i;
-        if (n % up == up - 1)
-        {
-            nz = n - up + 1;
-        }
-        else
-        {
-            nz = n + 1;
-        }
-        ctx->zech_log_table[j] = n_reverse_table[nz];
+        tables = _fq_zech_tables_compute(fq_nmod_ctx);
+        tables = _fq_zech_tables_insert(tables);
     }
 
-    fq_nmod_clear(r, fq_nmod_ctx);
-    fq_nmod_clear(gen, fq_nmod_ctx);
-    flint_free(n_reverse_table);
-    fmpz_clear(result);
-    fmpz_clear(order);
+    _fq_zech_ctx_set_tables(ctx, tables);
 }
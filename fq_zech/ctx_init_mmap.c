@@ -0,0 +1,169 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+
+#include "flint.h"
+#include "fq_zech.h"
+
+#if (!defined (__WIN32) || defined(__CYGWIN__)) && !defined(_MSC_VER)
+#define FQ_ZECH_USE_MMAP 1
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#else
+#define FQ_ZECH_USE_MMAP 0
+#endif
+
+/*
+    Maps a table file written by fq_zech_ctx_write_tables, or reads it into
+    memory where mmap is unavailable. Returns NULL if the file cannot be
+    opened or does not describe the field F_p[x]/(modulus).
+*/
+static fq_zech_tables_struct *
+_fq_zech_tables_map(const char * filename, mp_limb_t p, mp_limb_t q,
+                    const nmod_poly_t modulus)
+{
+    fq_zech_tables_struct * tables;
+    const mp_limb_t * header;
+    void * data;
+    size_t size, hsize, w;
+    slong i, len;
+    int ok;
+
+#if FQ_ZECH_USE_MMAP
+    struct stat st;
+    int fd;
+
+    fd = open(filename, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+
+    if (fstat(fd, &st) != 0 || st.st_size == 0)
+    {
+        close(fd);
+        return NULL;
+    }
+
+    size = st.st_size;
+    data = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (data == MAP_FAILED)
+        return NULL;
+#else
+    FILE * file;
+    long fsize;
+
+    file = fopen(filename, "rb");
+    if (file == NULL)
+        return NULL;
+
+    if (fseek(file, 0, SEEK_END) != 0 || (fsize = ftell(file)) <= 0)
+    {
+        fclose(file);
+        return NULL;
+    }
+
+    size = fsize;
+    data = flint_malloc(size);
+    rewind(file);
+    ok = fread(data, 1, size, file) == size;
+    fclose(file);
+
+    if (!ok)
+    {
+        flint_free(data);
+        return NULL;
+    }
+#endif
+
+    header = (const mp_limb_t *) data;
+    w = _fq_zech_tables_width(q);
+    len = modulus->length;
+    hsize = (6 + len) * sizeof(mp_limb_t);
+
+    ok = size >= 6 * sizeof(mp_limb_t)
+      && header[0] == FQ_ZECH_TABLES_MAGIC && header[1] == FLINT_BITS
+      && header[2] == w && header[3] == p && header[4] == q
+      && header[5] == (mp_limb_t) len
+      && size == hsize + (2 * q + p) * w;
+
+    for (i = 0; ok && i < len; i++)
+        ok = (header[6 + i] == modulus->coeffs[i]);
+
+    if (!ok)
+    {
+#if FQ_ZECH_USE_MMAP
+        munmap(data, size);
+#else
+        flint_free(data);
+#endif
+        return NULL;
+    }
+
+    tables = flint_malloc(sizeof(fq_zech_tables_struct));
+    tables->p = p;
+    tables->q = q;
+    nmod_poly_init(&tables->modulus, p);
+    nmod_poly_set(&tables->modulus, modulus);
+    tables->ref_count = 1;
+    tables->width = w;
+    tables->mapped = FQ_ZECH_USE_MMAP;
+    tables->data = data;
+    tables->size = size;
+    tables->zech_log_table = (char *) data + hsize;
+    tables->prime_field_table = (char *) tables->zech_log_table + q * w;
+    tables->eval_table = (char *) tables->prime_field_table + p * w;
+    tables->next = NULL;
+
+    return tables;
+}
+
+int
+fq_zech_ctx_init_fq_nmod_ctx_mmap(fq_zech_ctx_t ctx,
+                         fq_nmod_ctx_t fq_nmod_ctx, const char * filename)
+{
+    fq_zech_tables_struct * tables;
+
+    _fq_zech_ctx_init_params(ctx, fq_nmod_ctx);
+
+    tables = _fq_zech_tables_lookup(ctx->p, fq_nmod_ctx->modulus);
+
+    if (tables == NULL)
+    {
+        tables = _fq_zech_tables_map(filename, ctx->p, ctx->qm1 + 1,
+                                     fq_nmod_ctx->modulus);
+        if (tables == NULL)
+            return 0;
+
+        tables = _fq_zech_tables_insert(tables);
+    }
+
+    _fq_zech_ctx_set_tables(ctx, tables);
+
+    return 1;
+}
@@ -0,0 +1,62 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+
+#include "flint.h"
+#include "fq_zech.h"
+
+int
+fq_zech_ctx_write_tables(const fq_zech_ctx_t ctx, const char * filename)
+{
+    const fq_zech_tables_struct * tables = ctx->tables;
+    const nmod_poly_struct * modulus = &tables->modulus;
+    mp_limb_t header[6];
+    size_t w = tables->width;
+    FILE * file;
+    int ok;
+
+    file = fopen(filename, "wb");
+    if (file == NULL)
+        return 0;
+
+    header[0] = FQ_ZECH_TABLES_MAGIC;
+    header[1] = FLINT_BITS;
+    header[2] = w;
+    header[3] = tables->p;
+    header[4] = tables->q;
+    header[5] = modulus->length;
+
+    ok = fwrite(header, sizeof(mp_limb_t), 6, file) == 6;
+    ok = ok && fwrite(modulus->coeffs, sizeof(mp_limb_t), modulus->length,
+                          file) == (size_t) modulus->length;
+    ok = ok && fwrite(tables->zech_log_table, w, tables->q, file) == tables->q;
+    ok = ok && fwrite(tables->prime_field_table, w, tables->p, file) == tables->p;
+    ok = ok && fwrite(tables->eval_table, w, tables->q, file) == tables->q;
+
+    ok = (fclose(file) == 0) && ok;
+
+    return ok;
+}
@@ -33,7 +33,7 @@ fq_zech_get_fq_nmod(fq_nmod_t rop, const fq_zech_t op, const fq_zech_ctx_t ctx)
     
     nmod_poly_fit_length(rop, fq_zech_ctx_degree(ctx));
 
-    q = ctx->eval_table[op->value];
+    q = fq_zech_ctx_eval(ctx, op->value);
     i = 0;
     while (q >= ctx->p)
     {
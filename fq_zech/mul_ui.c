@@ -44,5 +44,5 @@ fq_zech_mul_ui(fq_zech_t rop, const fq_zech_t op, mp_limb_t x,
     if (b == 0)
         fq_zech_zero(rop, ctx);
     else
-        rop->value = n_addmod(op->value, ctx->prime_field_table[b], ctx->qm1);
+        rop->value = n_addmod(op->value, fq_zech_ctx_prime_field_log(ctx, b), ctx->qm1);
 }
@@ -43,7 +43,7 @@ fq_zech_sub(fq_zech_t rop, const fq_zech_t op1, const fq_zech_t op2,
         index = n_submod(op2->value, op1->value, ctx->qm1);
         index = n_submod(index, ctx->qm1o2, ctx->qm1);
 
-        c = ctx->zech_log_table[index];
+        c = fq_zech_ctx_zech_log(ctx, index);
         if (c != ctx->qm1)
         {
             c = n_addmod(c, op1->value, ctx->qm1);
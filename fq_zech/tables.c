@@ -0,0 +1,149 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 Mike Hansen
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "flint.h"
+#include "fq_zech.h"
+
+#if (!defined (__WIN32) || defined(__CYGWIN__)) && !defined(_MSC_VER)
+#include <sys/mman.h>
+#endif
+
+int
+_fq_zech_tables_width(mp_limb_t q)
+{
+    if (q - 1 <= UWORD(0xFFFF))
+        return 2;
+#if FLINT64
+    else if (q - 1 <= UWORD(0xFFFFFFFF))
+        return 4;
+    else
+        return sizeof(mp_limb_t);
+#else
+    else
+        return 4;
+#endif
+}
+
+fq_zech_tables_struct *
+_fq_zech_tables_compute(const fq_nmod_ctx_t fq_nmod_ctx)
+{
+    fq_zech_tables_struct * tables;
+    mp_limb_t i, j, n, nz, q, qm1, up, result_ui;
+    fq_nmod_t r, gen;
+    fmpz_t result, order;
+    void * n_reverse_table;
+    int w;
+
+    fmpz_init(order);
+    fq_nmod_ctx_order(order, fq_nmod_ctx);
+    q = fmpz_get_ui(order);
+    qm1 = q - 1;
+    up = fmpz_get_ui(fq_nmod_ctx_prime(fq_nmod_ctx));
+    w = _fq_zech_tables_width(q);
+
+    tables = flint_malloc(sizeof(fq_zech_tables_struct));
+    tables->p = up;
+    tables->q = q;
+    nmod_poly_init(&tables->modulus, up);
+    nmod_poly_set(&tables->modulus, fq_nmod_ctx->modulus);
+    tables->ref_count = 1;
+    tables->width = w;
+    tables->mapped = 0;
+    tables->size = (2 * q + up) * w;
+    tables->data = flint_malloc(tables->size);
+    tables->zech_log_table = tables->data;
+    tables->prime_field_table = (char *) tables->data + q * w;
+    tables->eval_table = (char *) tables->prime_field_table + up * w;
+    tables->next = NULL;
+
+    n_reverse_table = flint_malloc(q * w);
+
+    _fq_zech_table_set(tables->zech_log_table, qm1, 0, w);
+    _fq_zech_table_set(tables->prime_field_table, 0, qm1, w);
+    _fq_zech_table_set(n_reverse_table, 0, qm1, w);
+    _fq_zech_table_set(tables->eval_table, qm1, 0, w);
+
+    fq_nmod_init(r, fq_nmod_ctx);
+    fq_nmod_init(gen, fq_nmod_ctx);
+    fq_nmod_one(r, fq_nmod_ctx);
+    fq_nmod_gen(gen, fq_nmod_ctx);
+
+    fmpz_init(result);
+
+    for (i = 0; i < qm1; i++)
+    {
+        nmod_poly_evaluate_fmpz(result, r, fq_nmod_ctx_prime(fq_nmod_ctx));
+        result_ui = fmpz_get_ui(result);
+        _fq_zech_table_set(n_reverse_table, result_ui, i, w);
+        _fq_zech_table_set(tables->eval_table, i, result_ui, w);
+        if (r->length == 1)
+        {
+            _fq_zech_table_set(tables->prime_field_table, result_ui, i, w);
+        }
+        fq_nmod_mul(r, r, gen, fq_nmod_ctx);
+    }
+
+    for (i = 0; i < q; i++)
+    {
+        j = _fq_zech_table_get(n_reverse_table, i, w);
+        n = i;
+        if (n % up == up - 1)
+        {
+            nz = n - up + 1;
+        }
+        else
+        {
+            nz = n + 1;
+        }
+        _fq_zech_table_set(tables->zech_log_table, j,
+                           _fq_zech_table_get(n_reverse_table, nz, w), w);
+    }
+
+    fq_nmod_clear(r, fq_nmod_ctx);
+    fq_nmod_clear(gen, fq_nmod_ctx);
+    flint_free(n_reverse_table);
+    fmpz_clear(result);
+    fmpz_clear(order);
+
+    return tables;
+}
+
+void
+_fq_zech_tables_free(fq_zech_tables_struct * tables)
+{
+#if (!defined (__WIN32) || defined(__CYGWIN__)) && !defined(_MSC_VER)
+    if (tables->mapped)
+        munmap(tables->data, tables->size);
+    else
+#endif
+        flint_free(tables->data);
+
+    nmod_poly_clear(&tables->modulus);
+    flint_free(tables);
+}
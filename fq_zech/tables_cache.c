@@ -0,0 +1,125 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <pthread.h>
+
+#include "flint.h"
+#include "fq_zech.h"
+
+/*
+    Process-wide list of Zech tables, keyed by (p, modulus). Contexts hold
+    a reference; a table is freed when its last context is cleared.
+*/
+static fq_zech_tables_struct * _fq_zech_tables_cache = NULL;
+
+static pthread_mutex_t _fq_zech_tables_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static fq_zech_tables_struct *
+_fq_zech_tables_find(mp_limb_t p, const nmod_poly_t modulus)
+{
+    fq_zech_tables_struct * t;
+
+    for (t = _fq_zech_tables_cache; t != NULL; t = t->next)
+    {
+        if (t->p == p && nmod_poly_equal(&t->modulus, modulus))
+            return t;
+    }
+
+    return NULL;
+}
+
+fq_zech_tables_struct *
+_fq_zech_tables_lookup(mp_limb_t p, const nmod_poly_t modulus)
+{
+    fq_zech_tables_struct * t;
+
+    pthread_mutex_lock(&_fq_zech_tables_lock);
+
+    t = _fq_zech_tables_find(p, modulus);
+    if (t != NULL)
+        t->ref_count++;
+
+    pthread_mutex_unlock(&_fq_zech_tables_lock);
+
+    return t;
+}
+
+fq_zech_tables_struct *
+_fq_zech_tables_insert(fq_zech_tables_struct * tables)
+{
+    fq_zech_tables_struct * t;
+
+    pthread_mutex_lock(&_fq_zech_tables_lock);
+
+    /* another thread may have built the same tables in the meantime */
+    t = _fq_zech_tables_find(tables->p, &tables->modulus);
+    if (t != NULL)
+    {
+        t->ref_count++;
+    }
+    else
+    {
+        tables->next = _fq_zech_tables_cache;
+        _fq_zech_tables_cache = tables;
+    }
+
+    pthread_mutex_unlock(&_fq_zech_tables_lock);
+
+    if (t != NULL)
+    {
+        _fq_zech_tables_free(tables);
+        return t;
+    }
+
+    return tables;
+}
+
+void
+_fq_zech_tables_release(fq_zech_tables_struct * tables)
+{
+    fq_zech_tables_struct ** t;
+    int last;
+
+    pthread_mutex_lock(&_fq_zech_tables_lock);
+
+    last = (--tables->ref_count == 0);
+
+    if (last)
+    {
+        for (t = &_fq_zech_tables_cache; *t != NULL; t = &(*t)->next)
+        {
+            if (*t == tables)
+            {
+                *t = tables->next;
+                break;
+            }
+        }
+    }
+
+    pthread_mutex_unlock(&_fq_zech_tables_lock);
+
+    if (last)
+        _fq_zech_tables_free(tables);
+}
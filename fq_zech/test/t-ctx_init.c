@@ -78,7 +78,7 @@ main(void)
                 }
 
                 /* lhs = a^Z(j) */
-                fmpz_set_ui(e, ctx->zech_log_table[j]);
+                fmpz_set_ui(e, fq_zech_ctx_zech_log(ctx, j));
                 fq_nmod_gen(lhs, fq_nmod_ctx);
                 fq_nmod_pow(lhs, lhs, e, fq_nmod_ctx);
 
@@ -92,7 +92,7 @@ main(void)
                 {
                     flint_printf("FAIL:\n\n");
                     flint_printf("K = GF(%wd^%wd)\n", primes[i], d);
-                    flint_printf("Z(%d) = %wd\n", j, ctx->zech_log_table[j]);
+                    flint_printf("Z(%d) = %wd\n", j, fq_zech_ctx_zech_log(ctx, j));
                     flint_printf("LHS: ");
                     fq_nmod_print_pretty(lhs, fq_nmod_ctx);
                     flint_printf("\n");
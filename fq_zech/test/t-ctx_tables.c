@@ -0,0 +1,168 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fq_zech.h"
+#include "ulong_extras.h"
+#include "long_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    const char * filename = "fq_zech_tables_test.tmp";
+    FLINT_TEST_INIT(state);
+
+    flint_printf("ctx_tables... ");
+    fflush(stdout);
+
+    /* Check contexts with the same modulus share one set of tables */
+    for (i = 0; i < 20 * flint_test_multiplier(); i++)
+    {
+        fq_zech_ctx_t ctx1, ctx2;
+        fq_zech_t a, b, c1, c2;
+
+        fq_zech_ctx_randtest(ctx1, state);
+        fq_zech_ctx_init_modulus(ctx2, ctx1->fq_nmod_ctx->modulus, "b");
+
+        result = (ctx1->tables == ctx2->tables
+               && ctx1->tables->ref_count >= 2
+               && ctx1->table_width == _fq_zech_tables_width(ctx1->qm1 + 1)
+               && (ctx1->qm1 > UWORD(0xFFFF) || ctx1->table_width == 2));
+        if (!result)
+        {
+            flint_printf("FAIL (sharing):\n\n");
+            fq_zech_ctx_print(ctx1);
+            abort();
+        }
+
+        fq_zech_randtest(a, state, ctx1);
+        fq_zech_randtest(b, state, ctx1);
+        fq_zech_add(c1, a, b, ctx1);
+        fq_zech_add(c2, a, b, ctx2);
+
+        fq_zech_ctx_clear(ctx2);
+
+        result = (fq_zech_equal(c1, c2, ctx1) && ctx1->tables->ref_count >= 1);
+        if (!result)
+        {
+            flint_printf("FAIL (clear):\n\n");
+            fq_zech_ctx_print(ctx1);
+            abort();
+        }
+
+        fq_zech_ctx_clear(ctx1);
+    }
+
+    /* Check tables written to a file and mapped back agree */
+    for (i = 0; i < 5 * flint_test_multiplier(); i++)
+    {
+        fq_zech_ctx_t ctx1, ctx2;
+        fq_nmod_ctx_t fq_nmod_ctx;
+        mp_limb_t j, q;
+
+        fq_zech_ctx_randtest(ctx1, state);
+        q = ctx1->qm1 + 1;
+
+        if (!fq_zech_ctx_write_tables(ctx1, filename))
+        {
+            flint_printf("FAIL (write):\n\n");
+            abort();
+        }
+
+        fq_nmod_ctx_init_modulus(fq_nmod_ctx, ctx1->fq_nmod_ctx->modulus, "a");
+        fq_zech_ctx_clear(ctx1);
+
+        if (!fq_zech_ctx_init_fq_nmod_ctx_mmap(ctx2, fq_nmod_ctx, filename))
+        {
+            flint_printf("FAIL (map):\n\n");
+            abort();
+        }
+
+        fq_zech_ctx_init_fq_nmod_ctx(ctx1, fq_nmod_ctx);
+
+        if (ctx1->tables != ctx2->tables)
+        {
+            flint_printf("FAIL (mapped tables not shared):\n\n");
+            abort();
+        }
+
+        fq_zech_ctx_clear(ctx1);
+        fq_zech_ctx_clear(ctx2);
+
+        /* compare against freshly computed tables */
+        fq_zech_ctx_init_fq_nmod_ctx(ctx1, fq_nmod_ctx);
+        fq_zech_ctx_write_tables(ctx1, filename);
+        fq_zech_ctx_clear(ctx1);
+
+        fq_zech_ctx_init_fq_nmod_ctx_mmap(ctx2, fq_nmod_ctx, filename);
+        fq_zech_ctx_init_fq_nmod_ctx(ctx1, fq_nmod_ctx);
+
+        for (j = 0; j < q; j++)
+        {
+            if (fq_zech_ctx_zech_log(ctx1, j) != fq_zech_ctx_zech_log(ctx2, j)
+                || fq_zech_ctx_eval(ctx1, j) != fq_zech_ctx_eval(ctx2, j))
+            {
+                flint_printf("FAIL (table mismatch):\n\n");
+                flint_printf("j = %wu\n", j);
+                abort();
+            }
+        }
+
+        fq_zech_ctx_clear(ctx1);
+        fq_zech_ctx_clear(ctx2);
+
+        /* a file for a different modulus must be rejected */
+        {
+            fq_zech_ctx_t ctx3;
+            fq_nmod_ctx_t fq_nmod_ctx3;
+
+            fq_zech_ctx_randtest(ctx3, state);
+            fq_nmod_ctx_init_modulus(fq_nmod_ctx3,
+                                     ctx3->fq_nmod_ctx->modulus, "a");
+            fq_zech_ctx_clear(ctx3);
+
+            if (!nmod_poly_equal(fq_nmod_ctx3->modulus, fq_nmod_ctx->modulus)
+                && fq_zech_ctx_init_fq_nmod_ctx_mmap(ctx3, fq_nmod_ctx3,
+                                                     filename))
+            {
+                flint_printf("FAIL (wrong modulus accepted):\n\n");
+                abort();
+            }
+
+            fq_nmod_ctx_clear(fq_nmod_ctx3);
+        }
+
+        fq_nmod_ctx_clear(fq_nmod_ctx);
+    }
+
+    remove(filename);
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -48,6 +48,8 @@
 #define FQ_ZECH_POLY_GCD_CUTOFF 96
 #define FQ_ZECH_POLY_SMALL_GCD_CUTOFF 96
 
+#define FQ_ZECH_POLY_SPARSE_TERMS 8
+
 #ifdef T
 #undef T
 #endif
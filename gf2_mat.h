@@ -0,0 +1,197 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#ifndef GF2_MAT_H
+#define GF2_MAT_H
+
+#ifdef GF2_MAT_INLINES_C
+#define GF2_MAT_INLINE FLINT_DLL
+#else
+#define GF2_MAT_INLINE static __inline__
+#endif
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdlib.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "nmod_mat.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*
+   Matrices over GF(2), with each row packed FLINT_BITS entries to a limb.
+   Entry (i, j) is bit j % FLINT_BITS of limb j / FLINT_BITS of row i.
+   Bits beyond the last column are always zero.
+*/
+typedef struct
+{
+    mp_limb_t * entries;
+    slong r;
+    slong c;
+    slong stride;
+    mp_limb_t ** rows;
+}
+gf2_mat_struct;
+
+/* gf2_mat_t allows reference-like semantics for gf2_mat_struct */
+typedef gf2_mat_struct gf2_mat_t[1];
+
+#define GF2_MAT_STRIDE(c) (((c) + FLINT_BITS - 1) / FLINT_BITS)
+
+GF2_MAT_INLINE
+int gf2_mat_get_entry(const gf2_mat_t mat, slong i, slong j)
+{
+    return (mat->rows[i][j / FLINT_BITS] >> (j % FLINT_BITS)) & UWORD(1);
+}
+
+GF2_MAT_INLINE
+void gf2_mat_set_entry(gf2_mat_t mat, slong i, slong j, int x)
+{
+    mp_limb_t bit = UWORD(1) << (j % FLINT_BITS);
+
+    if (x & 1)
+        mat->rows[i][j / FLINT_BITS] |= bit;
+    else
+        mat->rows[i][j / FLINT_BITS] &= ~bit;
+}
+
+GF2_MAT_INLINE
+slong gf2_mat_nrows(const gf2_mat_t mat)
+{
+   return mat->r;
+}
+
+GF2_MAT_INLINE
+slong gf2_mat_ncols(const gf2_mat_t mat)
+{
+   return mat->c;
+}
+
+GF2_MAT_INLINE
+int gf2_mat_is_empty(const gf2_mat_t mat)
+{
+    return (mat->r == 0) || (mat->c == 0);
+}
+
+GF2_MAT_INLINE
+int gf2_mat_is_square(const gf2_mat_t mat)
+{
+    return (mat->r == mat->c);
+}
+
+GF2_MAT_INLINE
+void gf2_mat_swap_rows(gf2_mat_t mat, slong r, slong s)
+{
+    if (r != s)
+    {
+        mp_limb_t * u;
+
+        u = mat->rows[s];
+        mat->rows[s] = mat->rows[r];
+        mat->rows[r] = u;
+    }
+}
+
+/* Adds (xors) the n limbs of s to r */
+GF2_MAT_INLINE
+void _gf2_mat_row_add(mp_ptr r, mp_srcptr s, slong n)
+{
+    slong i;
+
+    for (i = 0; i < n; i++)
+        r[i] ^= s[i];
+}
+
+/* Memory management */
+
+FLINT_DLL void gf2_mat_init(gf2_mat_t mat, slong rows, slong cols);
+FLINT_DLL void gf2_mat_init_set(gf2_mat_t mat, const gf2_mat_t src);
+FLINT_DLL void gf2_mat_clear(gf2_mat_t mat);
+FLINT_DLL void gf2_mat_swap(gf2_mat_t mat1, gf2_mat_t mat2);
+
+FLINT_DLL void gf2_mat_set(gf2_mat_t B, const gf2_mat_t A);
+FLINT_DLL void gf2_mat_zero(gf2_mat_t mat);
+FLINT_DLL void gf2_mat_one(gf2_mat_t mat);
+
+/* Conversions */
+
+FLINT_DLL void gf2_mat_set_nmod_mat(gf2_mat_t B, const nmod_mat_t A);
+FLINT_DLL void gf2_mat_get_nmod_mat(nmod_mat_t B, const gf2_mat_t A);
+
+/* Random matrix generation */
+
+FLINT_DLL void gf2_mat_randtest(gf2_mat_t mat, flint_rand_t state);
+
+/* Comparison */
+
+FLINT_DLL int gf2_mat_equal(const gf2_mat_t mat1, const gf2_mat_t mat2);
+FLINT_DLL int gf2_mat_is_zero(const gf2_mat_t mat);
+
+/* Input and output */
+
+FLINT_DLL void gf2_mat_print_pretty(const gf2_mat_t mat);
+
+/* Transpose */
+
+FLINT_DLL void gf2_mat_transpose(gf2_mat_t B, const gf2_mat_t A);
+
+/* Addition */
+
+FLINT_DLL void gf2_mat_add(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B);
+
+/* Matrix multiplication */
+
+FLINT_DLL void gf2_mat_mul(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B);
+FLINT_DLL void gf2_mat_mul_classical(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B);
+FLINT_DLL void gf2_mat_mul_m4ri(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B);
+
+FLINT_DLL void _gf2_mat_m4ri_table(mp_ptr T, mp_ptr * r, slong k, slong stride);
+
+/* Reduced row echelon form, rank and nullspace */
+
+FLINT_DLL slong gf2_mat_rref(gf2_mat_t A);
+FLINT_DLL slong gf2_mat_rank(const gf2_mat_t A);
+FLINT_DLL slong gf2_mat_nullspace(gf2_mat_t X, const gf2_mat_t A);
+
+/* Tuning parameters *********************************************************/
+
+/* Dimension below which classical multiplication is used */
+#define GF2_MAT_MUL_M4RI_CUTOFF 32
+
+/* Maximum number of rows combined in a Four Russians table;
+   must divide FLINT_BITS */
+#define GF2_MAT_M4RI_K 8
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,54 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+
+void
+gf2_mat_mul(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B)
+{
+    slong m, k, n;
+
+    m = A->r;
+    k = A->c;
+    n = B->c;
+
+    if (C == A || C == B)
+    {
+        gf2_mat_t T;
+        gf2_mat_init(T, m, n);
+        gf2_mat_mul(T, A, B);
+        gf2_mat_swap(C, T);
+        gf2_mat_clear(T);
+        return;
+    }
+
+    if (m < GF2_MAT_MUL_M4RI_CUTOFF || k < GF2_MAT_MUL_M4RI_CUTOFF)
+        gf2_mat_mul_classical(C, A, B);
+    else
+        gf2_mat_mul_m4ri(C, A, B);
+}
@@ -0,0 +1,94 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+
+void
+_gf2_mat_m4ri_table(mp_ptr T, mp_ptr * r, slong k, slong stride)
+{
+    slong j;
+    ulong t;
+
+    flint_mpn_zero(T, stride);
+
+    for (j = 1; j < (WORD(1) << k); j++)
+    {
+        count_trailing_zeros(t, (mp_limb_t) j);
+        flint_mpn_copyi(T + j * stride, T + (j & (j - 1)) * stride, stride);
+        _gf2_mat_row_add(T + j * stride, r[t], stride);
+    }
+}
+
+void
+gf2_mat_mul_m4ri(gf2_mat_t C, const gf2_mat_t A, const gf2_mat_t B)
+{
+    slong i, b, k, m, n, stride;
+    mp_limb_t bits, mask;
+    mp_ptr T;
+
+    m = A->r;
+    n = A->c;
+    stride = B->stride;
+
+    if (C == A || C == B)
+    {
+        gf2_mat_t W;
+        gf2_mat_init(W, m, B->c);
+        gf2_mat_mul_m4ri(W, A, B);
+        gf2_mat_swap(C, W);
+        gf2_mat_clear(W);
+        return;
+    }
+
+    gf2_mat_zero(C);
+
+    if (m == 0 || n == 0 || B->c == 0)
+        return;
+
+    T = flint_malloc(sizeof(mp_limb_t) * (WORD(1) << GF2_MAT_M4RI_K) * stride);
+
+    /* GF2_MAT_M4RI_K divides FLINT_BITS, so a block of columns of A
+       never straddles two limbs */
+    for (b = 0; b < n; b += GF2_MAT_M4RI_K)
+    {
+        k = FLINT_MIN(GF2_MAT_M4RI_K, n - b);
+        mask = (UWORD(1) << k) - 1;
+
+        _gf2_mat_m4ri_table(T, B->rows + b, k, stride);
+
+        for (i = 0; i < m; i++)
+        {
+            bits = (A->rows[i][b / FLINT_BITS] >> (b % FLINT_BITS)) & mask;
+
+            if (bits != 0)
+                _gf2_mat_row_add(C->rows[i], T + bits * stride, stride);
+        }
+    }
+
+    flint_free(T);
+}
@@ -0,0 +1,83 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+
+slong
+gf2_mat_nullspace(gf2_mat_t X, const gf2_mat_t A)
+{
+    slong i, j, k, l, n, rank, nullity;
+    slong * p;
+    slong * pivots;
+    slong * nonpivots;
+    ulong b;
+    gf2_mat_t tmp;
+
+    n = A->c;
+
+    p = flint_malloc(sizeof(slong) * FLINT_MAX(n, 1));
+
+    gf2_mat_init_set(tmp, A);
+    rank = gf2_mat_rref(tmp);
+    nullity = n - rank;
+
+    gf2_mat_zero(X);
+
+    pivots = p;            /* length = rank */
+    nonpivots = p + rank;  /* length = nullity */
+
+    /* the pivot of each nonzero row is its lowest set bit */
+    for (i = 0; i < rank; i++)
+    {
+        for (l = 0; tmp->rows[i][l] == 0; l++) ;
+        count_trailing_zeros(b, tmp->rows[i][l]);
+        pivots[i] = l * FLINT_BITS + b;
+    }
+
+    for (i = j = k = 0; j < n; j++)
+    {
+        if (i < rank && pivots[i] == j)
+            i++;
+        else
+            nonpivots[k++] = j;
+    }
+
+    for (i = 0; i < nullity; i++)
+    {
+        for (j = 0; j < rank; j++)
+            if (gf2_mat_get_entry(tmp, j, nonpivots[i]))
+                gf2_mat_set_entry(X, pivots[j], i, 1);
+
+        gf2_mat_set_entry(X, nonpivots[i], i, 1);
+    }
+
+    flint_free(p);
+    gf2_mat_clear(tmp);
+
+    return nullity;
+}
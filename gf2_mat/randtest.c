@@ -0,0 +1,54 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "gf2_mat.h"
+
+void
+gf2_mat_randtest(gf2_mat_t mat, flint_rand_t state)
+{
+    slong i, j;
+    mp_limb_t mask;
+
+    if (mat->c == 0)
+        return;
+
+    /* mask off the unused bits of the last limb of each row */
+    if (mat->c % FLINT_BITS == 0)
+        mask = ~UWORD(0);
+    else
+        mask = (UWORD(1) << (mat->c % FLINT_BITS)) - 1;
+
+    for (i = 0; i < mat->r; i++)
+    {
+        for (j = 0; j < mat->stride; j++)
+            mat->rows[i][j] = n_randtest(state);
+
+        mat->rows[i][mat->stride - 1] &= mask;
+    }
+}
@@ -0,0 +1,136 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+
+slong
+gf2_mat_rref(gf2_mat_t A)
+{
+    slong i, j, k, t, m, n, kk, col, rank, stride, s, w;
+    slong piv[GF2_MAT_M4RI_K];
+    mp_ptr prow[GF2_MAT_M4RI_K];
+    mp_limb_t idx;
+    mp_ptr T;
+
+    m = A->r;
+    n = A->c;
+    stride = A->stride;
+
+    if (m == 0 || n == 0)
+        return 0;
+
+    /* a table of 2^k rows should not cost more than the m row
+       additions it saves */
+    k = FLINT_BIT_COUNT(m) - 2;
+    k = FLINT_MAX(k, 1);
+    k = FLINT_MIN(k, GF2_MAT_M4RI_K);
+
+    T = flint_malloc(sizeof(mp_limb_t) * (WORD(1) << k) * stride);
+
+    rank = col = 0;
+
+    while (col < n && rank < m)
+    {
+        /* Find up to k pivots by Gauss-Jordan elimination restricted to
+           the candidate rows, keeping the pivot rows found so far reduced
+           with respect to each other */
+        kk = 0;
+
+        while (kk < k && col < n && rank + kk < m)
+        {
+            for (i = rank + kk; i < m; i++)
+            {
+                for (j = 0; j < kk; j++)
+                {
+                    if (gf2_mat_get_entry(A, i, piv[j]))
+                    {
+                        s = piv[j] / FLINT_BITS;
+                        _gf2_mat_row_add(A->rows[i] + s,
+                                         A->rows[rank + j] + s, stride - s);
+                    }
+                }
+
+                if (gf2_mat_get_entry(A, i, col))
+                    break;
+            }
+
+            if (i < m)
+            {
+                gf2_mat_swap_rows(A, rank + kk, i);
+
+                s = col / FLINT_BITS;
+                for (j = 0; j < kk; j++)
+                {
+                    if (gf2_mat_get_entry(A, rank + j, col))
+                        _gf2_mat_row_add(A->rows[rank + j] + s,
+                                         A->rows[rank + kk] + s, stride - s);
+                }
+
+                piv[kk] = col;
+                kk++;
+            }
+
+            col++;
+        }
+
+        if (kk == 0)
+            break;
+
+        /* Clear the pivot columns in all other rows using a table of
+           all sums of the pivot rows, which vanish left of limb s */
+        s = piv[0] / FLINT_BITS;
+        w = stride - s;
+
+        for (t = 0; t < kk; t++)
+            prow[t] = A->rows[rank + t] + s;
+
+        _gf2_mat_m4ri_table(T, prow, kk, w);
+
+        for (i = 0; i < m; i++)
+        {
+            if (i == rank)
+            {
+                i += kk - 1;
+                continue;
+            }
+
+            idx = 0;
+            for (t = 0; t < kk; t++)
+                idx |= ((mp_limb_t) gf2_mat_get_entry(A, i, piv[t])) << t;
+
+            if (idx != 0)
+                _gf2_mat_row_add(A->rows[i] + s, T + idx * w, w);
+        }
+
+        rank += kk;
+    }
+
+    flint_free(T);
+
+    return rank;
+}
@@ -0,0 +1,104 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("add....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        gf2_mat_t A, B, C;
+        nmod_mat_t A2, B2, C2, D2;
+        slong m, n;
+
+        m = n_randint(state, 150);
+        n = n_randint(state, 150);
+
+        gf2_mat_init(A, m, n);
+        gf2_mat_init(B, m, n);
+        gf2_mat_init(C, m, n);
+        nmod_mat_init(A2, m, n, 2);
+        nmod_mat_init(B2, m, n, 2);
+        nmod_mat_init(C2, m, n, 2);
+        nmod_mat_init(D2, m, n, 2);
+
+        gf2_mat_randtest(A, state);
+        gf2_mat_randtest(B, state);
+
+        gf2_mat_add(C, A, B);
+
+        gf2_mat_get_nmod_mat(A2, A);
+        gf2_mat_get_nmod_mat(B2, B);
+        gf2_mat_get_nmod_mat(C2, C);
+        nmod_mat_add(D2, A2, B2);
+
+        if (!nmod_mat_equal(C2, D2))
+        {
+            flint_printf("FAIL: results not equal\n");
+            abort();
+        }
+
+        gf2_mat_add(C, C, B);
+
+        if (!gf2_mat_equal(C, A))
+        {
+            flint_printf("FAIL: (A + B) + B != A\n");
+            abort();
+        }
+
+        gf2_mat_add(C, C, C);
+
+        if (!gf2_mat_is_zero(C))
+        {
+            flint_printf("FAIL: A + A != 0\n");
+            abort();
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(B);
+        gf2_mat_clear(C);
+        nmod_mat_clear(A2);
+        nmod_mat_clear(B2);
+        nmod_mat_clear(C2);
+        nmod_mat_clear(D2);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
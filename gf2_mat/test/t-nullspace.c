@@ -0,0 +1,104 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("nullspace....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        gf2_mat_t A, B, ker;
+        nmod_mat_t C;
+        slong m, n, r, nullity, nulrank;
+
+        m = n_randint(state, 150);
+        n = n_randint(state, 150);
+        r = n_randint(state, FLINT_MIN(m, n) + 1);
+
+        gf2_mat_init(A, m, n);
+        gf2_mat_init(ker, n, n);
+        gf2_mat_init(B, m, n);
+        nmod_mat_init(C, m, n, 2);
+
+        nmod_mat_randrank(C, state, r);
+        if (n_randint(state, 2))
+            nmod_mat_randops(C, n_randint(state, 2 * m * n + 1), state);
+        gf2_mat_set_nmod_mat(A, C);
+
+        nullity = gf2_mat_nullspace(ker, A);
+        nulrank = gf2_mat_rank(ker);
+
+        if (nullity != nulrank)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("rank(ker) != nullity!\n");
+            gf2_mat_print_pretty(A);
+            flint_printf("\n");
+            abort();
+        }
+
+        if (nullity + r != n)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("nullity + rank != n\n");
+            gf2_mat_print_pretty(A);
+            flint_printf("\n");
+            abort();
+        }
+
+        gf2_mat_mul(B, A, ker);
+
+        if (!gf2_mat_is_zero(B))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("A * ker != 0\n");
+            gf2_mat_print_pretty(A);
+            flint_printf("\n");
+            abort();
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(ker);
+        gf2_mat_clear(B);
+        nmod_mat_clear(C);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,106 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("set_nmod_mat....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        gf2_mat_t A, B;
+        nmod_mat_t C, D;
+        slong m, n, r, c;
+
+        m = n_randint(state, 150);
+        n = n_randint(state, 150);
+
+        gf2_mat_init(A, m, n);
+        gf2_mat_init(B, m, n);
+        nmod_mat_init(C, m, n, 2);
+        nmod_mat_init(D, m, n, 2);
+
+        nmod_mat_randtest(C, state);
+        gf2_mat_randtest(B, state);
+
+        gf2_mat_set_nmod_mat(A, C);
+        gf2_mat_get_nmod_mat(D, A);
+
+        if (!nmod_mat_equal(C, D))
+        {
+            flint_printf("FAIL: nmod_mat -> gf2_mat -> nmod_mat\n");
+            nmod_mat_print_pretty(C);
+            nmod_mat_print_pretty(D);
+            abort();
+        }
+
+        gf2_mat_get_nmod_mat(D, B);
+        gf2_mat_set_nmod_mat(A, D);
+
+        if (!gf2_mat_equal(A, B))
+        {
+            flint_printf("FAIL: gf2_mat -> nmod_mat -> gf2_mat\n");
+            gf2_mat_print_pretty(A);
+            gf2_mat_print_pretty(B);
+            abort();
+        }
+
+        if (m != 0 && n != 0)
+        {
+            r = n_randint(state, m);
+            c = n_randint(state, n);
+
+            gf2_mat_set_entry(A, r, c, !gf2_mat_get_entry(A, r, c));
+
+            if (gf2_mat_equal(A, B) ||
+                gf2_mat_get_entry(A, r, c) == nmod_mat_entry(D, r, c))
+            {
+                flint_printf("FAIL: set_entry\n");
+                abort();
+            }
+        }
+
+        gf2_mat_clear(A);
+        gf2_mat_clear(B);
+        nmod_mat_clear(C);
+        nmod_mat_clear(D);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
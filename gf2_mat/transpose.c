@@ -0,0 +1,63 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "gf2_mat.h"
+
+void
+gf2_mat_transpose(gf2_mat_t B, const gf2_mat_t A)
+{
+    slong i, j;
+
+    if (B->r != A->c || B->c != A->r)
+    {
+        flint_printf("Exception (gf2_mat_transpose). Incompatible dimensions.\n");
+        abort();
+    }
+
+    if (A == B) /* In-place, guaranteed to be square */
+    {
+        gf2_mat_t T;
+        gf2_mat_init(T, A->c, A->r);
+        gf2_mat_transpose(T, A);
+        gf2_mat_swap(B, T);
+        gf2_mat_clear(T);
+        return;
+    }
+
+    gf2_mat_zero(B);
+
+    for (i = 0; i < A->r; i++)
+    {
+        for (j = 0; j < A->c; j++)
+        {
+            if (gf2_mat_get_entry(A, i, j))
+                B->rows[j][i / FLINT_BITS] |= UWORD(1) << (i % FLINT_BITS);
+        }
+    }
+}
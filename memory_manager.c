@@ -31,9 +31,9 @@
 #include "gc.h"
 #endif
 
-#if FLINT_REENTRANT && !HAVE_TLS
 #include <pthread.h>
 
+#if FLINT_REENTRANT && !HAVE_TLS
 static pthread_once_t register_initialised = PTHREAD_ONCE_INIT;
 pthread_mutex_t register_lock;
 #endif
@@ -156,4 +156,58 @@ void flint_cleanup()
 
 }
 
+/*
+    Cleanup functions for process-wide data, shared by all threads, which
+    are only called by flint_cleanup_master(). Registering a function
+    already in the list does nothing.
+*/
+static size_t flint_num_master_cleanup_functions = 0;
+
+static flint_cleanup_function_t * flint_master_cleanup_functions = NULL;
+
+static pthread_mutex_t master_register_lock = PTHREAD_MUTEX_INITIALIZER;
+
+void flint_register_master_cleanup_function(
+                                  flint_cleanup_function_t cleanup_function)
+{
+    size_t i;
+
+    pthread_mutex_lock(&master_register_lock);
+
+    for (i = 0; i < flint_num_master_cleanup_functions; i++)
+        if (flint_master_cleanup_functions[i] == cleanup_function)
+            break;
+
+    if (i == flint_num_master_cleanup_functions)
+    {
+        flint_master_cleanup_functions = flint_realloc(
+            flint_master_cleanup_functions,
+            (flint_num_master_cleanup_functions + 1)
+                                       * sizeof(flint_cleanup_function_t));
+
+        flint_master_cleanup_functions[i] = cleanup_function;
+        flint_num_master_cleanup_functions++;
+    }
+
+    pthread_mutex_unlock(&master_register_lock);
+}
+
+void flint_cleanup_master()
+{
+    size_t i;
+
+    flint_cleanup();
+
+    pthread_mutex_lock(&master_register_lock);
+
+    for (i = 0; i < flint_num_master_cleanup_functions; i++)
+        flint_master_cleanup_functions[i]();
+
+    flint_free(flint_master_cleanup_functions);
+    flint_master_cleanup_functions = NULL;
+    flint_num_master_cleanup_functions = 0;
+
+    pthread_mutex_unlock(&master_register_lock);
+}
+
 
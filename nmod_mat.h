@@ -223,10 +223,6 @@ FLINT_DLL int nmod_mat_solve_vec(mp_ptr x, const nmod_mat_t A, mp_srcptr b);
 
 FLINT_DLL slong nmod_mat_rref(nmod_mat_t A);
 FLINT_DLL slong _nmod_mat_rref(nmod_mat_t A, slong * pivots_nonpivots, slong * P);
-FLINT_DLL slong nmod_mat_rref_classical(nmod_mat_t A);
-FLINT_DLL slong _nmod_mat_rref_classical(nmod_mat_t A, slong * pivots_nonpivots);
-FLINT_DLL slong nmod_mat_rref_storjohann(nmod_mat_t A);
-FLINT_DLL slong _nmod_mat_rref_storjohann(nmod_mat_t A, slong * pivots_nonpivots);
 
 /* Nullspace */
 
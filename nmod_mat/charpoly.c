@@ -0,0 +1,56 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "nmod_poly.h"
+
+void
+nmod_mat_charpoly(nmod_poly_t cp, const nmod_mat_t A)
+{
+    if (A->r != A->c)
+    {
+        flint_printf("Exception (nmod_mat_charpoly). Non-square matrix.\n");
+        abort();
+    }
+
+    if (A->r >= NMOD_MAT_CHARPOLY_KRYLOV_CUTOFF)
+    {
+        flint_rand_t state;
+        int success;
+
+        flint_randinit(state);
+        success = nmod_mat_charpoly_krylov(cp, A, state);
+        flint_randclear(state);
+
+        if (success)
+            return;
+    }
+
+    nmod_mat_charpoly_hessenberg(cp, A);
+}
@@ -0,0 +1,141 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_poly.h"
+
+void
+_nmod_mat_charpoly_hessenberg(mp_ptr cp, nmod_mat_t H)
+{
+    slong i, j, k, m, n;
+    mp_limb_t t, u, c;
+    mp_ptr P;
+    nmod_t mod = H->mod;
+
+    n = H->r;
+
+    /* Reduce H to upper Hessenberg form by similarity transformations */
+    for (m = 1; m < n - 1; m++)
+    {
+        for (i = m; i < n && nmod_mat_entry(H, i, m - 1) == 0; i++) ;
+
+        if (i == n)
+            continue;
+
+        if (i != m)
+        {
+            mp_ptr row = H->rows[i];
+            H->rows[i] = H->rows[m];
+            H->rows[m] = row;
+
+            for (k = 0; k < n; k++)
+            {
+                t = nmod_mat_entry(H, k, i);
+                nmod_mat_entry(H, k, i) = nmod_mat_entry(H, k, m);
+                nmod_mat_entry(H, k, m) = t;
+            }
+        }
+
+        t = n_invmod(nmod_mat_entry(H, m, m - 1), mod.n);
+
+        for (i = m + 1; i < n; i++)
+        {
+            u = nmod_mul(nmod_mat_entry(H, i, m - 1), t, mod);
+
+            if (u == 0)
+                continue;
+
+            /* row i -= u * row m, then column m += u * column i */
+            _nmod_vec_scalar_addmul_nmod(H->rows[i] + m - 1,
+                H->rows[m] + m - 1, n - m + 1, nmod_neg(u, mod), mod);
+
+            for (k = 0; k < n; k++)
+                nmod_mat_entry(H, k, m) = nmod_add(nmod_mat_entry(H, k, m),
+                    nmod_mul(u, nmod_mat_entry(H, k, i), mod), mod);
+        }
+    }
+
+    /* The characteristic polynomials P_m of the leading m x m submatrices
+       satisfy P_{m+1} = (x - h_{m,m}) P_m
+                         - sum_{i<m} h_{i,m} h_{i+1,i} ... h_{m,m-1} P_i */
+    P = _nmod_vec_init((n + 1) * (n + 1));
+    _nmod_vec_zero(P, (n + 1) * (n + 1));
+    P[0] = 1;
+
+    for (m = 0; m < n; m++)
+    {
+        mp_ptr Q = P + (m + 1) * (n + 1);
+        mp_ptr R = P + m * (n + 1);
+
+        /* Q = x R - h_{m,m} R */
+        for (k = 0; k <= m; k++)
+            Q[k + 1] = R[k];
+        _nmod_vec_scalar_addmul_nmod(Q, R, m + 1,
+                          nmod_neg(nmod_mat_entry(H, m, m), mod), mod);
+
+        c = 1;
+        for (i = m - 1; i >= 0; i--)
+        {
+            c = nmod_mul(c, nmod_mat_entry(H, i + 1, i), mod);
+
+            if (c == 0)
+                break;
+
+            t = nmod_mul(c, nmod_mat_entry(H, i, m), mod);
+            _nmod_vec_scalar_addmul_nmod(Q, P + i * (n + 1), i + 1,
+                                                        nmod_neg(t, mod), mod);
+        }
+    }
+
+    for (j = 0; j <= n; j++)
+        cp[j] = P[n * (n + 1) + j];
+
+    _nmod_vec_clear(P);
+}
+
+void
+nmod_mat_charpoly_hessenberg(nmod_poly_t cp, const nmod_mat_t A)
+{
+    nmod_mat_t H;
+
+    if (A->r != A->c)
+    {
+        flint_printf("Exception (nmod_mat_charpoly_hessenberg). "
+                     "Non-square matrix.\n");
+        abort();
+    }
+
+    nmod_mat_init_set(H, A);
+    nmod_poly_fit_length(cp, A->r + 1);
+    _nmod_mat_charpoly_hessenberg(cp->coeffs, H);
+    _nmod_poly_set_length(cp, A->r + 1);
+    nmod_mat_clear(H);
+}
@@ -0,0 +1,107 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_poly.h"
+
+int
+nmod_mat_charpoly_krylov(nmod_poly_t cp, const nmod_mat_t A, flint_rand_t state)
+{
+    slong i, j, k, n = A->r;
+    nmod_mat_t K, P, T, W1, W2;
+    mp_ptr b, c;
+    int result;
+
+    if (A->r != A->c)
+    {
+        flint_printf("Exception (nmod_mat_charpoly_krylov). "
+                     "Non-square matrix.\n");
+        abort();
+    }
+
+    if (n == 0)
+    {
+        nmod_poly_one(cp);
+        return 1;
+    }
+
+    /* Row i of K is v A^i; rows k, ..., 2k - 1 are obtained from rows
+       0, ..., k - 1 by one multiplication with P = A^k (Keller-Gehrig) */
+    nmod_mat_init(K, n + 1, n, A->mod.n);
+    nmod_mat_init_set(P, A);
+    nmod_mat_init(T, n, n, A->mod.n);
+
+    for (j = 0; j < n; j++)
+        nmod_mat_entry(K, 0, j) = n_randint(state, A->mod.n);
+
+    for (k = 1; k <= n; k *= 2)
+    {
+        slong len = FLINT_MIN(k, n + 1 - k);
+
+        nmod_mat_window_init(W1, K, 0, 0, len, n);
+        nmod_mat_window_init(W2, K, k, 0, k + len, n);
+        nmod_mat_mul(W2, W1, P);
+        nmod_mat_window_clear(W1);
+        nmod_mat_window_clear(W2);
+
+        if (2 * k <= n)
+        {
+            nmod_mat_mul(T, P, P);
+            nmod_mat_swap(T, P);
+        }
+    }
+
+    /* Solve c_0 v + c_1 v A + ... + c_{n-1} v A^{n-1} = v A^n */
+    for (i = 0; i < n; i++)
+        for (j = 0; j < n; j++)
+            nmod_mat_entry(T, j, i) = nmod_mat_entry(K, i, j);
+
+    b = _nmod_vec_init(n);
+    c = _nmod_vec_init(n);
+    _nmod_vec_set(b, K->rows[n], n);
+
+    result = nmod_mat_solve_vec(c, T, b);
+
+    if (result)
+    {
+        nmod_poly_fit_length(cp, n + 1);
+        _nmod_vec_neg(cp->coeffs, c, n, A->mod);
+        cp->coeffs[n] = 1;
+        _nmod_poly_set_length(cp, n + 1);
+    }
+
+    _nmod_vec_clear(b);
+    _nmod_vec_clear(c);
+    nmod_mat_clear(T);
+    nmod_mat_clear(P);
+    nmod_mat_clear(K);
+
+    return result;
+}
@@ -0,0 +1,199 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_poly.h"
+
+/*
+    Reduces r against the rows B[0], ..., B[rank - 1] with pivot columns
+    piv[0], ..., piv[rank - 1], which are normalised to 1 at their pivot and
+    zero at the pivots of all previous rows. If Q is not NULL, the same
+    operations are applied to q with the rows of Q, each of length len.
+    Returns the column of the first nonzero entry of the result, or -1.
+ */
+static slong
+_reduce(mp_ptr r, mp_ptr q, mp_ptr * B, mp_ptr * Q, const slong * piv,
+        slong rank, slong n, slong len, nmod_t mod)
+{
+    slong j;
+    mp_limb_t c;
+
+    for (j = 0; j < rank; j++)
+    {
+        c = r[piv[j]];
+
+        if (c != 0)
+        {
+            c = nmod_neg(c, mod);
+            _nmod_vec_scalar_addmul_nmod(r, B[j], n, c, mod);
+            if (Q != NULL)
+                _nmod_vec_scalar_addmul_nmod(q, Q[j], len, c, mod);
+        }
+    }
+
+    for (j = 0; j < n; j++)
+        if (r[j] != 0)
+            return j;
+
+    return -1;
+}
+
+void
+nmod_mat_minpoly(nmod_poly_t p, const nmod_mat_t A)
+{
+    slong i, j, d, n = A->r, grank, lrank, pos;
+    slong * gpiv, * lpiv;
+    mp_ptr * G, * L, * Q;
+    mp_ptr w, r, q;
+    mp_limb_t c;
+    nmod_t mod = A->mod;
+    nmod_poly_t g, h;
+    int nlimbs;
+
+    if (A->r != A->c)
+    {
+        flint_printf("Exception (nmod_mat_minpoly). Non-square matrix.\n");
+        abort();
+    }
+
+    nmod_poly_one(p);
+
+    if (n == 0)
+        return;
+
+    nlimbs = _nmod_vec_dot_bound_limbs(n, mod);
+
+    G = flint_malloc(sizeof(mp_ptr) * n);
+    L = flint_malloc(sizeof(mp_ptr) * n);
+    Q = flint_malloc(sizeof(mp_ptr) * n);
+    gpiv = flint_malloc(sizeof(slong) * n);
+    lpiv = flint_malloc(sizeof(slong) * n);
+
+    for (i = 0; i < n; i++)
+    {
+        G[i] = _nmod_vec_init(n);
+        L[i] = _nmod_vec_init(n);
+        Q[i] = _nmod_vec_init(n + 1);
+    }
+
+    w = _nmod_vec_init(n);
+    r = _nmod_vec_init(n);
+    q = _nmod_vec_init(n + 1);
+
+    nmod_poly_init_preinv(g, mod.n, mod.ninv);
+    nmod_poly_init_preinv(h, mod.n, mod.ninv);
+
+    /*
+        The span of G is the sum of the Krylov spaces of the vectors
+        processed so far, which is invariant under A. Unit vectors that
+        lie in it have minimal polynomials dividing p and can be skipped;
+        once it is the whole space, p is the minimal polynomial of A.
+     */
+    grank = 0;
+
+    for (i = 0; i < n && grank < n && p->length <= n; i++)
+    {
+        _nmod_vec_zero(r, n);
+        r[i] = 1;
+
+        if (_reduce(r, NULL, G, NULL, gpiv, grank, n, 0, mod) < 0)
+            continue;
+
+        _nmod_vec_zero(w, n);
+        w[i] = 1;
+        lrank = 0;
+
+        for (d = 0; ; d++)
+        {
+            /* Find the first linear relation among w, A w, ..., A^d w */
+            _nmod_vec_set(r, w, n);
+            _nmod_vec_zero(q, n + 1);
+            q[d] = 1;
+
+            pos = _reduce(r, q, L, Q, lpiv, lrank, n, n + 1, mod);
+
+            if (pos < 0)
+                break;
+
+            c = n_invmod(r[pos], mod.n);
+            _nmod_vec_scalar_mul_nmod(L[lrank], r, n, c, mod);
+            _nmod_vec_scalar_mul_nmod(Q[lrank], q, n + 1, c, mod);
+            lpiv[lrank++] = pos;
+
+            /* Extend the global invariant subspace */
+            _nmod_vec_set(r, w, n);
+            pos = _reduce(r, NULL, G, NULL, gpiv, grank, n, 0, mod);
+
+            if (pos >= 0)
+            {
+                c = n_invmod(r[pos], mod.n);
+                _nmod_vec_scalar_mul_nmod(G[grank], r, n, c, mod);
+                gpiv[grank++] = pos;
+            }
+
+            /* w = A w */
+            for (j = 0; j < n; j++)
+                r[j] = _nmod_vec_dot(A->rows[j], w, n, mod, nlimbs);
+            _nmod_vec_set(w, r, n);
+        }
+
+        /* p = lcm(p, g) */
+        nmod_poly_fit_length(g, d + 1);
+        _nmod_vec_set(g->coeffs, q, d + 1);
+        _nmod_poly_set_length(g, d + 1);
+
+        nmod_poly_gcd(h, p, g);
+        nmod_poly_div(g, g, h);
+        nmod_poly_mul(p, p, g);
+    }
+
+    nmod_poly_make_monic(p, p);
+
+    nmod_poly_clear(g);
+    nmod_poly_clear(h);
+
+    _nmod_vec_clear(w);
+    _nmod_vec_clear(r);
+    _nmod_vec_clear(q);
+
+    for (i = 0; i < n; i++)
+    {
+        _nmod_vec_clear(G[i]);
+        _nmod_vec_clear(L[i]);
+        _nmod_vec_clear(Q[i]);
+    }
+
+    flint_free(G);
+    flint_free(L);
+    flint_free(Q);
+    flint_free(gpiv);
+    flint_free(lpiv);
+}
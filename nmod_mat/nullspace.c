@@ -27,12 +27,14 @@
 #include <gmp.h>
 #include "flint.h"
 #include "nmod_mat.h"
+#include "perm.h"
 
 slong
 nmod_mat_nullspace(nmod_mat_t X, const nmod_mat_t A)
 {
-    slong i, j, k, m, n, rank, nullity;
+    slong i, j, m, n, rank, nullity;
     slong * p;
+    slong * P;
     slong * pivots;
     slong * nonpivots;
     nmod_mat_t tmp;
@@ -40,10 +42,11 @@ nmod_mat_nullspace(nmod_mat_t X, const nmod_mat_t A)
     m = A->r;
     n = A->c;
 
-    p = flint_malloc(sizeof(slong) * FLINT_MAX(m, n));
+    p = flint_malloc(sizeof(slong) * n);
+    P = _perm_init(m);
 
     nmod_mat_init_set(tmp, A);
-    rank = nmod_mat_rref(tmp);
+    rank = _nmod_mat_rref(tmp, p, P);
     nullity = n - rank;
 
     nmod_mat_zero(X);
@@ -55,27 +58,10 @@ nmod_mat_nullspace(nmod_mat_t X, const nmod_mat_t A)
     }
     else if (nullity)
     {
+        /* the rref already tells us where the pivots are */
         pivots = p;            /* length = rank */
         nonpivots = p + rank;  /* length = nullity */
 
-        for (i = j = k = 0; i < rank; i++)
-        {
-            while (nmod_mat_entry(tmp, i, j) == UWORD(0))
-            {
-                nonpivots[k] = j;
-                k++;
-                j++;
-            }
-            pivots[i] = j;
-            j++;
-        }
-        while (k < nullity)
-        {
-            nonpivots[k] = j;
-            k++;
-            j++;
-        }
-
         for (i = 0; i < nullity; i++)
         {
             for (j = 0; j < rank; j++)
@@ -89,6 +75,7 @@ nmod_mat_nullspace(nmod_mat_t X, const nmod_mat_t A)
     }
 
     flint_free(p);
+    _perm_clear(P);
     nmod_mat_clear(tmp);
 
     return nullity;
@@ -0,0 +1,123 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("charpoly....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_mat_t A, B, C;
+        nmod_poly_t f, g;
+        mp_limb_t mod, d;
+        slong n;
+
+        n = n_randint(state, 30);
+        mod = n_randtest_prime(state, 0);
+
+        nmod_mat_init(A, n, n, mod);
+        nmod_mat_init(B, n, n, mod);
+        nmod_mat_init(C, n, n, mod);
+        nmod_poly_init(f, mod);
+        nmod_poly_init(g, mod);
+
+        nmod_mat_randtest(A, state);
+        if (n_randint(state, 2))
+            nmod_mat_randrank(A, state, n_randint(state, n + 1));
+
+        nmod_mat_charpoly_hessenberg(f, A);
+
+        /* Cayley-Hamilton */
+        nmod_poly_evaluate_mat(B, f, A);
+
+        if (nmod_poly_degree(f) != n || !nmod_mat_is_zero(B))
+        {
+            flint_printf("FAIL (Cayley-Hamilton):\n");
+            nmod_mat_print_pretty(A);
+            nmod_poly_print(f), flint_printf("\n");
+            abort();
+        }
+
+        /* f(0) = (-1)^n det(A) */
+        d = nmod_mat_det(A);
+        if (n % 2 == 1)
+            d = nmod_neg(d, A->mod);
+
+        if (nmod_poly_get_coeff_ui(f, 0) != d)
+        {
+            flint_printf("FAIL (determinant):\n");
+            nmod_mat_print_pretty(A);
+            nmod_poly_print(f), flint_printf("\n");
+            abort();
+        }
+
+        /* Transpose */
+        nmod_mat_transpose(C, A);
+        nmod_mat_charpoly(g, C);
+
+        if (!nmod_poly_equal(f, g))
+        {
+            flint_printf("FAIL (transpose):\n");
+            nmod_mat_print_pretty(A);
+            nmod_poly_print(f), flint_printf("\n");
+            nmod_poly_print(g), flint_printf("\n");
+            abort();
+        }
+
+        /* Krylov */
+        if (nmod_mat_charpoly_krylov(g, A, state) && !nmod_poly_equal(f, g))
+        {
+            flint_printf("FAIL (krylov):\n");
+            nmod_mat_print_pretty(A);
+            nmod_poly_print(f), flint_printf("\n");
+            nmod_poly_print(g), flint_printf("\n");
+            abort();
+        }
+
+        nmod_mat_clear(A);
+        nmod_mat_clear(B);
+        nmod_mat_clear(C);
+        nmod_poly_clear(f);
+        nmod_poly_clear(g);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,140 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "nmod_poly.h"
+#include "nmod_poly_factor.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("minpoly....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_mat_t A, B;
+        nmod_poly_t f, g, q, r;
+        nmod_poly_factor_t fac;
+        mp_limb_t mod;
+        slong j, k, n, m;
+
+        m = n_randint(state, 6);
+        k = 1 + n_randint(state, 4);
+        n = m * k;
+        mod = n_randtest_prime(state, 0);
+
+        nmod_mat_init(A, n, n, mod);
+        nmod_mat_init(B, n, n, mod);
+        nmod_poly_init(f, mod);
+        nmod_poly_init(g, mod);
+        nmod_poly_init(q, mod);
+        nmod_poly_init(r, mod);
+
+        /* k copies of an m x m block on the diagonal, so that the
+           minimal polynomial is usually a proper factor of the charpoly */
+        if (m != 0)
+        {
+            nmod_mat_t C;
+
+            nmod_mat_init(C, m, m, mod);
+            nmod_mat_randtest(C, state);
+            if (n_randint(state, 2))
+                nmod_mat_randrank(C, state, n_randint(state, m + 1));
+
+            for (j = 0; j < k; j++)
+            {
+                slong a, b;
+
+                for (a = 0; a < m; a++)
+                    for (b = 0; b < m; b++)
+                        nmod_mat_entry(A, j * m + a, j * m + b) =
+                            nmod_mat_entry(C, a, b);
+            }
+
+            nmod_mat_clear(C);
+        }
+
+        if (n_randint(state, 2))
+            nmod_mat_randtest(A, state);
+
+        nmod_mat_minpoly(f, A);
+        nmod_mat_charpoly(g, A);
+
+        /* f(A) = 0 and f divides the characteristic polynomial */
+        nmod_poly_evaluate_mat(B, f, A);
+        nmod_poly_divrem(q, r, g, f);
+
+        if (!nmod_mat_is_zero(B) || !nmod_poly_is_zero(r)
+            || (n > 0 && f->coeffs[f->length - 1] != 1))
+        {
+            flint_printf("FAIL (annihilator):\n");
+            nmod_mat_print_pretty(A);
+            nmod_poly_print(f), flint_printf("\n");
+            nmod_poly_print(g), flint_printf("\n");
+            abort();
+        }
+
+        /* No proper factor annihilates A */
+        nmod_poly_factor_init(fac);
+        nmod_poly_factor(fac, f);
+
+        for (j = 0; j < fac->num; j++)
+        {
+            nmod_poly_div(q, f, fac->p + j);
+            nmod_poly_evaluate_mat(B, q, A);
+
+            if (nmod_mat_is_zero(B))
+            {
+                flint_printf("FAIL (minimality):\n");
+                nmod_mat_print_pretty(A);
+                nmod_poly_print(f), flint_printf("\n");
+                abort();
+            }
+        }
+
+        nmod_poly_factor_clear(fac);
+
+        nmod_mat_clear(A);
+        nmod_mat_clear(B);
+        nmod_poly_clear(f);
+        nmod_poly_clear(g);
+        nmod_poly_clear(q);
+        nmod_poly_clear(r);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
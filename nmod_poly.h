@@ -60,6 +60,14 @@
 #define NMOD_POLY_GCD_CUTOFF  340       /* GCD:  Euclidean -> HGCD          */
 #define NMOD_POLY_SMALL_GCD_CUTOFF 200  /* GCD (small n): Euclidean -> HGCD */
 
+#define NMOD_POLY_MULTI_POINT_PREINV_CUTOFF 64  /* Node length for
+                                                   precomputed inverses */
+
+#define NMOD_POLY_MUL_THREADED_CUTOFF 2000  /* Split products between threads */
+#define NMOD_POLY_TREE_THREADED_CUTOFF 4096 /* Threaded subproduct trees */
+
+#define NMOD_POLY_SPARSE_TERMS 8  /* Max. nonleading terms of sparse moduli */
+
 NMOD_POLY_INLINE
 slong NMOD_DIVREM_BC_ITCH(slong lenA, slong lenB, nmod_t mod)
 {
@@ -125,6 +133,17 @@ typedef struct
 
 typedef nmod_poly_res_struct nmod_poly_res_t[1];
 
+typedef struct
+{
+    mp_ptr * tree;
+    mp_ptr * tree_inv;
+    mp_ptr weights;
+    slong len;
+    nmod_t mod;
+} nmod_poly_multi_point_struct;
+
+typedef nmod_poly_multi_point_struct nmod_poly_multi_point_t[1];
+
 typedef struct
 {
     nmod_mat_struct A;
@@ -552,6 +571,9 @@ FLINT_DLL void _nmod_poly_mul(mp_ptr res, mp_srcptr poly1, slong len1,
 FLINT_DLL void nmod_poly_mul(nmod_poly_t res, 
                              const nmod_poly_t poly1, const nmod_poly_t poly2);
 
+FLINT_DLL void _nmod_poly_mul_threaded(mp_ptr res, mp_srcptr poly1,
+   slong len1, mp_srcptr poly2, slong len2, nmod_t mod, slong num_threads);
+
 FLINT_DLL void _nmod_poly_mullow(mp_ptr res, mp_srcptr poly1, slong len1, 
                            mp_srcptr poly2, slong len2, slong trunc, nmod_t mod);
 
@@ -758,6 +780,11 @@ FLINT_DLL void _nmod_poly_div_newton_n_preinv (mp_ptr Q, mp_srcptr A, slong lenA
 FLINT_DLL void nmod_poly_div_newton_n_preinv (nmod_poly_t Q, const nmod_poly_t A,
                                  const nmod_poly_t B, const nmod_poly_t Binv);
 
+FLINT_DLL slong _nmod_poly_sparse_terms(slong * exps, mp_srcptr f, slong lenf);
+
+FLINT_DLL void _nmod_poly_rem_sparse(mp_ptr R, mp_ptr A, slong lenA,
+          mp_srcptr f, slong lenf, const slong * exps, slong t, nmod_t mod);
+
 FLINT_DLL void _nmod_poly_divrem_newton_n_preinv (mp_ptr Q, mp_ptr R, mp_srcptr A,
  slong lenA, mp_srcptr B, slong lenB, mp_srcptr Binv, slong lenBinv, nmod_t mod);
 
@@ -835,6 +862,21 @@ void nmod_poly_evaluate_mat(nmod_mat_t dest,
     }
 }
 
+/* Characteristic and minimal polynomials of matrices  **********************/
+
+#define NMOD_MAT_CHARPOLY_KRYLOV_CUTOFF 1024
+
+FLINT_DLL void _nmod_mat_charpoly_hessenberg(mp_ptr cp, nmod_mat_t H);
+
+FLINT_DLL void nmod_mat_charpoly_hessenberg(nmod_poly_t cp, const nmod_mat_t A);
+
+FLINT_DLL int nmod_mat_charpoly_krylov(nmod_poly_t cp,
+    const nmod_mat_t A, flint_rand_t state);
+
+FLINT_DLL void nmod_mat_charpoly(nmod_poly_t cp, const nmod_mat_t A);
+
+FLINT_DLL void nmod_mat_minpoly(nmod_poly_t p, const nmod_mat_t A);
+
 /* Subproduct tree  **********************************************************/
 
 FLINT_DLL mp_ptr * _nmod_poly_tree_alloc(slong len);
@@ -876,6 +918,38 @@ FLINT_DLL void _nmod_poly_interpolate_nmod_vec_fast_precomp(mp_ptr poly, mp_srcp
 FLINT_DLL void _nmod_poly_interpolation_weights(mp_ptr w, const mp_ptr * tree,
     slong len, nmod_t mod);
 
+/* Precomputed point sets  ***************************************************/
+
+FLINT_DLL void _nmod_poly_multi_point_init(nmod_poly_multi_point_t P,
+    mp_srcptr xs, slong len, nmod_t mod);
+
+FLINT_DLL void nmod_poly_multi_point_init(nmod_poly_multi_point_t P,
+    mp_srcptr xs, slong len, mp_limb_t n);
+
+FLINT_DLL void nmod_poly_multi_point_clear(nmod_poly_multi_point_t P);
+
+NMOD_POLY_INLINE
+int nmod_poly_multi_point_can_interpolate(const nmod_poly_multi_point_t P)
+{
+    return P->len == 0 || P->weights != NULL;
+}
+
+FLINT_DLL void _nmod_poly_multi_point_evaluate(mp_ptr ys, mp_srcptr poly,
+    slong plen, const nmod_poly_multi_point_t P);
+
+FLINT_DLL void nmod_poly_multi_point_evaluate(mp_ptr ys,
+    const nmod_poly_t poly, const nmod_poly_multi_point_t P);
+
+FLINT_DLL void nmod_poly_multi_point_evaluate_vec(mp_ptr * ys,
+    const nmod_poly_struct * polys, slong num,
+    const nmod_poly_multi_point_t P);
+
+FLINT_DLL void _nmod_poly_multi_point_interpolate(mp_ptr poly, mp_srcptr ys,
+    const nmod_poly_multi_point_t P);
+
+FLINT_DLL void nmod_poly_multi_point_interpolate(nmod_poly_t poly,
+    mp_srcptr ys, const nmod_poly_multi_point_t P);
+
 /* Composition  **************************************************************/
 
 FLINT_DLL void _nmod_poly_compose_horner(mp_ptr res, mp_srcptr poly1, 
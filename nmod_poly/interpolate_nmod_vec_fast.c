@@ -23,6 +23,7 @@
 
 ******************************************************************************/
 
+#include <pthread.h>
 #include <gmp.h>
 #include "flint.h"
 #include "ulong_extras.h"
@@ -60,50 +61,110 @@ _nmod_poly_interpolation_weights(mp_ptr w, const mp_ptr * tree, slong len, nmod_
     _nmod_vec_clear(tmp);
 }
 
+typedef struct
+{
+    mp_ptr poly;
+    mp_srcptr tree;
+    slong pow;
+    slong len;
+    slong start;
+    slong stop;
+    slong num_threads;
+    nmod_t mod;
+}
+interpolate_arg_t;
+
+/* Combines the pairs of partial interpolants in the blocks [start, stop) */
+static void
+_nmod_poly_interpolate_range(interpolate_arg_t * arg)
+{
+    const slong pow = arg->pow;
+    const nmod_t mod = arg->mod;
+    slong b, left;
+    mp_srcptr pa;
+    mp_ptr pb, t, u;
+
+    t = _nmod_vec_init(2 * pow);
+    u = _nmod_vec_init(2 * pow);
+
+    for (b = arg->start; b < arg->stop; b++)
+    {
+        pa = arg->tree + b * (2 * pow + 2);
+        pb = arg->poly + b * 2 * pow;
+        left = FLINT_MIN(2 * pow, arg->len - b * 2 * pow);
+
+        if (left > pow)
+        {
+            _nmod_poly_mul_threaded(t, pa, pow + 1, pb + pow, left - pow,
+                                                   mod, arg->num_threads);
+            _nmod_poly_mul_threaded(u, pb, pow, pa + pow + 1, left - pow + 1,
+                                                   mod, arg->num_threads);
+            _nmod_vec_add(pb, t, u, left, mod);
+        }
+    }
+
+    _nmod_vec_clear(t);
+    _nmod_vec_clear(u);
+}
+
+static void *
+_nmod_poly_interpolate_worker(void * arg_ptr)
+{
+    _nmod_poly_interpolate_range((interpolate_arg_t *) arg_ptr);
+    flint_cleanup();
+    return NULL;
+}
+
 void
 _nmod_poly_interpolate_nmod_vec_fast_precomp(mp_ptr poly, mp_srcptr ys,
     const mp_ptr * tree, mp_srcptr weights, slong len, nmod_t mod)
 {
-    mp_ptr t, u, pa, pb;
-    slong i, pow, left;
+    interpolate_arg_t * args;
+    pthread_t * threads;
+    slong i, j, pow, nb, num, num_threads;
 
     if (len == 0)
         return;
 
-    t = _nmod_vec_init(len);
-    u = _nmod_vec_init(len);
-
     for (i = 0; i < len; i++)
         poly[i] = nmod_mul(weights[i], ys[i], mod);
 
+    num_threads = (len < NMOD_POLY_TREE_THREADED_CUTOFF) ?
+                                               1 : flint_get_num_threads();
+
+    args = flint_malloc(sizeof(interpolate_arg_t) * num_threads);
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+
     for (i = 0; i < FLINT_CLOG2(len); i++)
     {
         pow = (WORD(1) << i);
-        pa = tree[i];
-        pb = poly;
-        left = len;
+        nb = (len + 2 * pow - 1) / (2 * pow);
+        num = FLINT_MIN(nb, num_threads);
 
-        while (left >= 2 * pow)
+        for (j = 0; j < num; j++)
         {
-            _nmod_poly_mul(t, pa, pow + 1, pb + pow, pow, mod);
-            _nmod_poly_mul(u, pa + pow + 1, pow + 1, pb, pow, mod);
-            _nmod_vec_add(pb, t, u, 2 * pow, mod);
-
-            left -= 2 * pow;
-            pa += 2 * pow + 2;
-            pb += 2 * pow;
+            args[j].poly = poly;
+            args[j].tree = tree[i];
+            args[j].pow = pow;
+            args[j].len = len;
+            args[j].start = (j * nb) / num;
+            args[j].stop = ((j + 1) * nb) / num;
+            args[j].num_threads = num_threads / num;
+            args[j].mod = mod;
         }
 
-        if (left > pow)
-        {
-            _nmod_poly_mul(t, pa, pow + 1, pb + pow, left - pow, mod);
-            _nmod_poly_mul(u, pb, pow, pa + pow + 1, left - pow + 1, mod);
-            _nmod_vec_add(pb, t, u, left, mod);
-        }
+        for (j = 1; j < num; j++)
+            pthread_create(threads + j, NULL,
+                           _nmod_poly_interpolate_worker, args + j);
+
+        _nmod_poly_interpolate_range(args);
+
+        for (j = 1; j < num; j++)
+            pthread_join(threads[j], NULL);
     }
 
-    _nmod_vec_clear(t);
-    _nmod_vec_clear(u);
+    flint_free(args);
+    flint_free(threads);
 }
 
 
@@ -0,0 +1,138 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <pthread.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+typedef struct
+{
+    mp_ptr res;
+    mp_srcptr poly1;
+    slong len1;
+    mp_srcptr poly2;
+    slong len2;
+    nmod_t mod;
+}
+mul_threaded_arg_t;
+
+static void
+_nmod_poly_mul_block(mul_threaded_arg_t * arg)
+{
+    if (arg->len1 >= arg->len2)
+        _nmod_poly_mul(arg->res, arg->poly1, arg->len1,
+                                 arg->poly2, arg->len2, arg->mod);
+    else
+        _nmod_poly_mul(arg->res, arg->poly2, arg->len2,
+                                 arg->poly1, arg->len1, arg->mod);
+}
+
+static void *
+_nmod_poly_mul_threaded_worker(void * arg_ptr)
+{
+    _nmod_poly_mul_block((mul_threaded_arg_t *) arg_ptr);
+    flint_cleanup();
+    return NULL;
+}
+
+/*
+    Cuts poly1 into k1 and poly2 into k2 blocks with k1 k2 <= num_threads,
+    multiplies the k1 k2 pairs of blocks in parallel and adds up the
+    shifted products.
+*/
+void
+_nmod_poly_mul_threaded(mp_ptr res, mp_srcptr poly1, slong len1,
+                 mp_srcptr poly2, slong len2, nmod_t mod, slong num_threads)
+{
+    mul_threaded_arg_t * args;
+    pthread_t * threads;
+    slong * off;
+    slong i, j, k1, k2, m1, m2, num;
+
+    if (num_threads < 2
+        || FLINT_MIN(len1, len2) < NMOD_POLY_MUL_THREADED_CUTOFF)
+    {
+        if (len1 >= len2)
+            _nmod_poly_mul(res, poly1, len1, poly2, len2, mod);
+        else
+            _nmod_poly_mul(res, poly2, len2, poly1, len1, mod);
+        return;
+    }
+
+    k2 = n_sqrt(num_threads);
+    k1 = num_threads / k2;
+    k1 = FLINT_MIN(k1, len1);
+    k2 = FLINT_MIN(k2, len2);
+    m1 = (len1 + k1 - 1) / k1;
+    m2 = (len2 + k2 - 1) / k2;
+    k1 = (len1 + m1 - 1) / m1;
+    k2 = (len2 + m2 - 1) / m2;
+    num = k1 * k2;
+
+    args = flint_malloc(sizeof(mul_threaded_arg_t) * num);
+    threads = flint_malloc(sizeof(pthread_t) * num);
+    off = flint_malloc(sizeof(slong) * num);
+
+    for (i = 0; i < k1; i++)
+    {
+        for (j = 0; j < k2; j++)
+        {
+            mul_threaded_arg_t * arg = args + i * k2 + j;
+
+            arg->poly1 = poly1 + i * m1;
+            arg->len1 = FLINT_MIN(m1, len1 - i * m1);
+            arg->poly2 = poly2 + j * m2;
+            arg->len2 = FLINT_MIN(m2, len2 - j * m2);
+            arg->mod = mod;
+            arg->res = _nmod_vec_init(arg->len1 + arg->len2 - 1);
+            off[i * k2 + j] = i * m1 + j * m2;
+        }
+    }
+
+    for (i = 1; i < num; i++)
+        pthread_create(threads + i, NULL,
+                       _nmod_poly_mul_threaded_worker, args + i);
+
+    _nmod_poly_mul_block(args);
+
+    for (i = 1; i < num; i++)
+        pthread_join(threads[i], NULL);
+
+    _nmod_vec_zero(res, len1 + len2 - 1);
+
+    for (i = 0; i < num; i++)
+    {
+        _nmod_vec_add(res + off[i], res + off[i], args[i].res,
+                      args[i].len1 + args[i].len2 - 1, mod);
+        _nmod_vec_clear(args[i].res);
+    }
+
+    flint_free(args);
+    flint_free(threads);
+    flint_free(off);
+}
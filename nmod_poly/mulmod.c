@@ -34,6 +34,7 @@ void _nmod_poly_mulmod(mp_ptr res, mp_srcptr poly1, slong len1,
                             slong lenf, nmod_t mod)
 {
     mp_ptr T, Q;
+    slong exps[NMOD_POLY_SPARSE_TERMS], t;
     slong lenT, lenQ;
 
     lenT = len1 + len2 - 1;
@@ -42,12 +43,17 @@ void _nmod_poly_mulmod(mp_ptr res, mp_srcptr poly1, slong len1,
     T = _nmod_vec_init(lenT + lenQ);
     Q = T + lenT;
 
+    t = _nmod_poly_sparse_terms(exps, f, lenf);
+
     if (len1 >= len2)
         _nmod_poly_mul(T, poly1, len1, poly2, len2, mod);
     else
         _nmod_poly_mul(T, poly2, len2, poly1, len1, mod);
 
-    _nmod_poly_divrem(Q, res, T, lenT, f, lenf, mod);
+    if (t >= 0)
+        _nmod_poly_rem_sparse(res, T, lenT, f, lenf, exps, t, mod);
+    else
+        _nmod_poly_divrem(Q, res, T, lenT, f, lenf, mod);
     _nmod_vec_clear(T);
 }
 
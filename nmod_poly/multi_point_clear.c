@@ -0,0 +1,48 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void
+nmod_poly_multi_point_clear(nmod_poly_multi_point_t P)
+{
+    slong i;
+
+    if (P->len != 0)
+    {
+        for (i = 0; i <= FLINT_CLOG2(P->len); i++)
+            if (P->tree_inv[i] != NULL)
+                _nmod_vec_clear(P->tree_inv[i]);
+
+        flint_free(P->tree_inv);
+        _nmod_poly_tree_free(P->tree, P->len);
+
+        if (P->weights != NULL)
+            _nmod_vec_clear(P->weights);
+    }
+}
@@ -0,0 +1,232 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <pthread.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+/*
+    Sets r to a modulo the monic node b. If binv is not NULL it holds the
+    inverse of the reversal of b to length blen - 1, which is used
+    whenever the division is in range for Newton division.
+*/
+static __inline__ void
+_nmod_poly_multi_point_rem(mp_ptr r, mp_ptr q, mp_srcptr a, slong alen,
+    mp_srcptr b, slong blen, mp_srcptr binv, nmod_t mod)
+{
+    if (alen == 2 && blen == 2)
+        r[0] = nmod_sub(a[0], nmod_mul(a[1], b[0], mod), mod);
+    else if (binv != NULL && alen > blen + 1 && alen <= 2 * blen - 2)
+        _nmod_poly_divrem_newton_n_preinv(q, r, a, alen,
+                                              b, blen, binv, blen - 1, mod);
+    else
+        _nmod_poly_rem(r, a, alen, b, blen, mod);
+}
+
+typedef struct
+{
+    mp_ptr out;
+    mp_srcptr in;
+    slong inlen;
+    const nmod_poly_multi_point_struct * P;
+    slong level;
+    slong start;
+    slong stop;
+}
+multi_point_arg_t;
+
+/*
+    If inlen > 0, reduces (in, inlen) modulo the nodes [start, stop)
+    of the given level. Otherwise reduces the remainders modulo the
+    nodes of level + 1, stored in in, modulo the children [start, stop)
+    on the given level.
+*/
+static void
+_nmod_poly_multi_point_range(multi_point_arg_t * arg)
+{
+    const slong len = arg->P->len;
+    const nmod_t mod = arg->P->mod;
+    const slong pow = WORD(1) << arg->level;
+    mp_srcptr tree = arg->P->tree[arg->level];
+    mp_srcptr inv = arg->P->tree_inv[arg->level];
+    mp_srcptr pa, pb, pi;
+    mp_ptr pc, q;
+    slong c, b, left;
+
+    q = _nmod_vec_init(pow + 1);
+
+    for (c = arg->start; c < arg->stop; c++)
+    {
+        if (arg->inlen > 0)
+        {
+            left = FLINT_MIN(pow, len - c * pow);
+            pi = (left == pow && inv != NULL) ? inv + c * pow : NULL;
+            _nmod_poly_multi_point_rem(arg->out + c * pow, q, arg->in,
+                     arg->inlen, tree + c * (pow + 1), left + 1, pi, mod);
+            continue;
+        }
+
+        b = c / 2;
+        pb = arg->in + b * 2 * pow;
+        pc = arg->out + b * 2 * pow;
+        pi = (inv == NULL) ? NULL : inv + b * 2 * pow;
+        pa = tree + b * (2 * pow + 2);
+        left = FLINT_MIN(2 * pow, len - b * 2 * pow);
+
+        if (c % 2 == 0)
+        {
+            if (left > pow)
+                _nmod_poly_multi_point_rem(pc, q, pb, left,
+                                           pa, pow + 1, pi, mod);
+            else
+                _nmod_vec_set(pc, pb, left);
+        }
+        else if (left == 2 * pow)
+        {
+            _nmod_poly_multi_point_rem(pc + pow, q, pb, left, pa + pow + 1,
+                              pow + 1, pi == NULL ? NULL : pi + pow, mod);
+        }
+        else if (left > pow)
+        {
+            _nmod_poly_rem(pc + pow, pb, left, pa + pow + 1,
+                                                    left - pow + 1, mod);
+        }
+    }
+
+    _nmod_vec_clear(q);
+}
+
+static void *
+_nmod_poly_multi_point_worker(void * arg_ptr)
+{
+    _nmod_poly_multi_point_range((multi_point_arg_t *) arg_ptr);
+    flint_cleanup();
+    return NULL;
+}
+
+/* Shares the num tasks of one level out between at most num_threads */
+static void
+_nmod_poly_multi_point_level(mp_ptr out, mp_srcptr in, slong inlen,
+    const nmod_poly_multi_point_struct * P, slong level, slong num,
+    slong num_threads)
+{
+    multi_point_arg_t * args;
+    pthread_t * threads;
+    slong j;
+
+    num_threads = FLINT_MIN(num_threads, num);
+
+    args = flint_malloc(sizeof(multi_point_arg_t) * num_threads);
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+
+    for (j = 0; j < num_threads; j++)
+    {
+        args[j].out = out;
+        args[j].in = in;
+        args[j].inlen = inlen;
+        args[j].P = P;
+        args[j].level = level;
+        args[j].start = (j * num) / num_threads;
+        args[j].stop = ((j + 1) * num) / num_threads;
+    }
+
+    for (j = 1; j < num_threads; j++)
+        pthread_create(threads + j, NULL,
+                       _nmod_poly_multi_point_worker, args + j);
+
+    _nmod_poly_multi_point_range(args);
+
+    for (j = 1; j < num_threads; j++)
+        pthread_join(threads[j], NULL);
+
+    flint_free(args);
+    flint_free(threads);
+}
+
+void
+_nmod_poly_multi_point_evaluate(mp_ptr vs, mp_srcptr poly, slong plen,
+    const nmod_poly_multi_point_t P)
+{
+    const slong len = P->len;
+    const nmod_t mod = P->mod;
+    slong height, i, pow, num_threads;
+    mp_ptr t, u, swap;
+
+    /* avoid worrying about some degenerate cases */
+    if (len < 2 || plen < 2)
+    {
+        if (len == 1)
+            vs[0] = _nmod_poly_evaluate_nmod(poly, plen,
+                nmod_neg(P->tree[0][0], mod), mod);
+        else if (len != 0 && plen == 0)
+            _nmod_vec_zero(vs, len);
+        else if (len != 0 && plen == 1)
+            for (i = 0; i < len; i++)
+                vs[i] = poly[0];
+        return;
+    }
+
+    num_threads = (len < NMOD_POLY_TREE_THREADED_CUTOFF) ?
+                                               1 : flint_get_num_threads();
+
+    t = _nmod_vec_init(len);
+    u = _nmod_vec_init(len);
+
+    /* Initial reduction. We allow the polynomial to be larger
+       or smaller than the number of points. */
+    height = FLINT_BIT_COUNT(plen - 1) - 1;
+    while (height >= FLINT_CLOG2(len))
+        height--;
+    pow = WORD(1) << height;
+
+    _nmod_poly_multi_point_level(t, poly, plen, P, height,
+                                       (len + pow - 1) / pow, num_threads);
+
+    for (i = height - 1; i >= 0; i--)
+    {
+        pow = WORD(1) << i;
+
+        _nmod_poly_multi_point_level(u, t, 0, P, i,
+                       2 * ((len + 2 * pow - 1) / (2 * pow)), num_threads);
+
+        swap = t;
+        t = u;
+        u = swap;
+    }
+
+    _nmod_vec_set(vs, t, len);
+    _nmod_vec_clear(t);
+    _nmod_vec_clear(u);
+}
+
+void
+nmod_poly_multi_point_evaluate(mp_ptr ys, const nmod_poly_t poly,
+    const nmod_poly_multi_point_t P)
+{
+    _nmod_poly_multi_point_evaluate(ys, poly->coeffs, poly->length, P);
+}
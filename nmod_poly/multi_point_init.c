@@ -0,0 +1,116 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void
+_nmod_poly_multi_point_init(nmod_poly_multi_point_t P,
+    mp_srcptr xs, slong len, nmod_t mod)
+{
+    slong i, j, height, pow;
+    mp_ptr tmp, w;
+
+    P->len = len;
+    P->mod = mod;
+    P->tree = NULL;
+    P->tree_inv = NULL;
+    P->weights = NULL;
+
+    if (len == 0)
+        return;
+
+    P->tree = _nmod_poly_tree_alloc(len);
+    _nmod_poly_tree_build(P->tree, xs, len, mod);
+
+    /* Inverses of the reversed full nodes, on the levels where
+       remainders are computed by Newton division */
+    height = FLINT_CLOG2(len);
+    P->tree_inv = flint_malloc(sizeof(mp_ptr) * (height + 1));
+    tmp = _nmod_vec_init(len + 1);
+
+    for (i = 0; i <= height; i++)
+    {
+        pow = WORD(1) << i;
+
+        if (i == height || pow + 1 < NMOD_POLY_MULTI_POINT_PREINV_CUTOFF)
+        {
+            P->tree_inv[i] = NULL;
+            continue;
+        }
+
+        P->tree_inv[i] = _nmod_vec_init(len);
+
+        for (j = 0; j + pow <= len; j += pow)
+        {
+            _nmod_poly_reverse(tmp, P->tree[i] + j + j / pow, pow + 1, pow + 1);
+            _nmod_poly_inv_series(P->tree_inv[i] + j, tmp, pow, mod);
+        }
+    }
+
+    /* Interpolation weights 1 / F'(x_i), where F is the root of the tree;
+       exist only if all differences of the points are invertible */
+    w = _nmod_vec_init(len);
+
+    if (len == 1)
+    {
+        w[0] = 1;
+    }
+    else
+    {
+        pow = WORD(1) << (height - 1);
+
+        _nmod_poly_mul(tmp, P->tree[height - 1], pow + 1,
+                            P->tree[height - 1] + (pow + 1), len - pow + 1, mod);
+        _nmod_poly_derivative(tmp, tmp, len + 1, mod);
+        _nmod_poly_multi_point_evaluate(w, tmp, len, P);
+
+        for (i = 0; i < len; i++)
+        {
+            if (w[i] == 0 || n_gcdinv(w + i, w[i], mod.n) != 1)
+            {
+                _nmod_vec_clear(w);
+                w = NULL;
+                break;
+            }
+        }
+    }
+
+    P->weights = w;
+    _nmod_vec_clear(tmp);
+}
+
+void
+nmod_poly_multi_point_init(nmod_poly_multi_point_t P,
+    mp_srcptr xs, slong len, mp_limb_t n)
+{
+    nmod_t mod;
+
+    nmod_init(&mod, n);
+    _nmod_poly_multi_point_init(P, xs, len, mod);
+}
@@ -0,0 +1,61 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void
+_nmod_poly_multi_point_interpolate(mp_ptr poly, mp_srcptr ys,
+    const nmod_poly_multi_point_t P)
+{
+    _nmod_poly_interpolate_nmod_vec_fast_precomp(poly, ys, P->tree,
+                                                 P->weights, P->len, P->mod);
+}
+
+void
+nmod_poly_multi_point_interpolate(nmod_poly_t poly, mp_srcptr ys,
+    const nmod_poly_multi_point_t P)
+{
+    if (P->len == 0)
+    {
+        nmod_poly_zero(poly);
+        return;
+    }
+
+    if (P->weights == NULL)
+    {
+        flint_printf("Exception (nmod_poly_multi_point_interpolate). "
+                     "Differences of points are not invertible.\n");
+        abort();
+    }
+
+    nmod_poly_fit_length(poly, P->len);
+    _nmod_poly_multi_point_interpolate(poly->coeffs, ys, P);
+    poly->length = P->len;
+    _nmod_poly_normalise(poly);
+}
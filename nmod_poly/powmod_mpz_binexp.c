@@ -61,6 +61,7 @@ _nmod_poly_powmod_mpz_binexp(mp_ptr res, mp_srcptr poly,
                                 slong lenf, nmod_t mod)
 {
     mp_ptr T, Q;
+    slong exps[NMOD_POLY_SPARSE_TERMS], t;
     slong lenT, lenQ;
     slong i;
 
@@ -76,17 +77,26 @@ _nmod_poly_powmod_mpz_binexp(mp_ptr res, mp_srcptr poly,
     T = _nmod_vec_init(lenT + lenQ);
     Q = T + lenT;
 
+    t = _nmod_poly_sparse_terms(exps, f, lenf);
+
     _nmod_vec_set(res, poly, lenf - 1);
 
     for (i = mpz_sizeinbase(e, 2) - 2; i >= 0; i--)
     {
         _nmod_poly_mul(T, res, lenf - 1, res, lenf - 1, mod);
-        _nmod_poly_divrem(Q, res, T, 2 * lenf - 3, f, lenf, mod);
+        if (t >= 0)
+            _nmod_poly_rem_sparse(res, T, 2 * lenf - 3, f, lenf, exps, t, mod);
+        else
+            _nmod_poly_divrem(Q, res, T, 2 * lenf - 3, f, lenf, mod);
 
         if (mpz_tstbit(e, i))
         {
             _nmod_poly_mul(T, res, lenf - 1, poly, lenf - 1, mod);
-            _nmod_poly_divrem(Q, res, T, 2 * lenf - 3, f, lenf, mod);
+            if (t >= 0)
+                _nmod_poly_rem_sparse(res, T, 2 * lenf - 3, f, lenf,
+                                      exps, t, mod);
+            else
+                _nmod_poly_divrem(Q, res, T, 2 * lenf - 3, f, lenf, mod);
         }
     }
 
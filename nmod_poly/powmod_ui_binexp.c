@@ -37,6 +37,7 @@ _nmod_poly_powmod_ui_binexp(mp_ptr res, mp_srcptr poly,
                                 ulong e, mp_srcptr f, slong lenf, nmod_t mod)
 {
     mp_ptr T, Q;
+    slong exps[NMOD_POLY_SPARSE_TERMS], t;
     slong lenT, lenQ;
     int i;
 
@@ -52,17 +53,26 @@ _nmod_poly_powmod_ui_binexp(mp_ptr res, mp_srcptr poly,
     T = _nmod_vec_init(lenT + lenQ);
     Q = T + lenT;
 
+    t = _nmod_poly_sparse_terms(exps, f, lenf);
+
     _nmod_vec_set(res, poly, lenf - 1);
 
     for (i = ((int) FLINT_BIT_COUNT(e) - 2); i >= 0; i--)
     {
         _nmod_poly_mul(T, res, lenf - 1, res, lenf - 1, mod);
-        _nmod_poly_divrem(Q, res, T, 2 * lenf - 3, f, lenf, mod);
+        if (t >= 0)
+            _nmod_poly_rem_sparse(res, T, 2 * lenf - 3, f, lenf, exps, t, mod);
+        else
+            _nmod_poly_divrem(Q, res, T, 2 * lenf - 3, f, lenf, mod);
 
         if (e & (UWORD(1) << i))
         {
             _nmod_poly_mul(T, res, lenf - 1, poly, lenf - 1, mod);
-            _nmod_poly_divrem(Q, res, T, 2 * lenf - 3, f, lenf, mod);
+            if (t >= 0)
+                _nmod_poly_rem_sparse(res, T, 2 * lenf - 3, f, lenf,
+                                      exps, t, mod);
+            else
+                _nmod_poly_divrem(Q, res, T, 2 * lenf - 3, f, lenf, mod);
         }
     }
 
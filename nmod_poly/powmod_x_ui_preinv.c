@@ -48,6 +48,7 @@ _nmod_poly_powmod_x_ui_preinv (mp_ptr res, ulong e, mp_srcptr f, slong lenf,
                                mp_srcptr finv, slong lenfinv, nmod_t mod)
 {
     mp_ptr T, Q;
+    slong exps[NMOD_POLY_SPARSE_TERMS], t;
     slong lenT, lenQ, window;
     int i, l, c;
 
@@ -57,6 +58,8 @@ _nmod_poly_powmod_x_ui_preinv (mp_ptr res, ulong e, mp_srcptr f, slong lenf,
     T = _nmod_vec_init(lenT + lenQ);
     Q = T + lenT;
 
+    t = _nmod_poly_sparse_terms(exps, f, lenf);
+
     flint_mpn_zero (res, lenf - 1);
     res[0] = WORD(1);
 
@@ -76,8 +79,12 @@ _nmod_poly_powmod_x_ui_preinv (mp_ptr res, ulong e, mp_srcptr f, slong lenf,
     if (c == 0)
     {
         _nmod_poly_shift_left(T, res, lenf - 1, window);
-        _nmod_poly_divrem_newton_n_preinv(Q, res, T, lenf - 1 + window, f,
-                                          lenf, finv, lenfinv, mod);
+        if (t >= 0)
+            _nmod_poly_rem_sparse(res, T, lenf - 1 + window, f, lenf,
+                                  exps, t, mod);
+        else
+            _nmod_poly_divrem_newton_n_preinv(Q, res, T, lenf - 1 + window, f,
+                                              lenf, finv, lenfinv, mod);
         c = l + 1;
         window= WORD(0);
     }
@@ -85,8 +92,11 @@ _nmod_poly_powmod_x_ui_preinv (mp_ptr res, ulong e, mp_srcptr f, slong lenf,
     for (; i >= 0; i--)
     {
         _nmod_poly_mul(T, res, lenf - 1, res, lenf - 1, mod);
-        _nmod_poly_divrem_newton_n_preinv(Q, res, T, 2 * lenf - 3, f,
-                                          lenf, finv, lenfinv, mod);
+        if (t >= 0)
+            _nmod_poly_rem_sparse(res, T, 2 * lenf - 3, f, lenf, exps, t, mod);
+        else
+            _nmod_poly_divrem_newton_n_preinv(Q, res, T, 2 * lenf - 3, f,
+                                              lenf, finv, lenfinv, mod);
 
         c--;
         if (e & (UWORD(1) << i))
@@ -101,8 +111,12 @@ _nmod_poly_powmod_x_ui_preinv (mp_ptr res, ulong e, mp_srcptr f, slong lenf,
         if (c == 0)
         {
             _nmod_poly_shift_left(T, res, lenf - 1, window);
-            _nmod_poly_divrem_newton_n_preinv(Q, res, T, lenf - 1 + window, f,
-                                              lenf, finv, lenfinv, mod);
+            if (t >= 0)
+                _nmod_poly_rem_sparse(res, T, lenf - 1 + window, f, lenf,
+                                      exps, t, mod);
+            else
+                _nmod_poly_divrem_newton_n_preinv(Q, res, T, lenf - 1 + window, f,
+                                                  lenf, finv, lenfinv, mod);
 
             c= l + 1;
             window= WORD(0);
@@ -23,12 +23,38 @@
 
 ******************************************************************************/
 
+#include <pthread.h>
 #include "nmod_poly.h"
 #include "ulong_extras.h"
 
-void
-_nmod_poly_product_roots_nmod_vec(mp_ptr poly, mp_srcptr xs, slong n, nmod_t mod)
+typedef struct
 {
+    mp_ptr poly;
+    mp_srcptr xs;
+    slong n;
+    nmod_t mod;
+    slong num_threads;
+}
+product_roots_arg_t;
+
+static void _nmod_poly_product_roots(product_roots_arg_t * arg);
+
+static void *
+_nmod_poly_product_roots_worker(void * arg_ptr)
+{
+    _nmod_poly_product_roots((product_roots_arg_t *) arg_ptr);
+    flint_cleanup();
+    return NULL;
+}
+
+static void
+_nmod_poly_product_roots(product_roots_arg_t * arg)
+{
+    mp_ptr poly = arg->poly;
+    mp_srcptr xs = arg->xs;
+    const slong n = arg->n;
+    const nmod_t mod = arg->mod;
+
     if (n == 0)
     {
         poly[0] = UWORD(1);
@@ -58,18 +84,60 @@ _nmod_poly_product_roots_nmod_vec(mp_ptr poly, mp_srcptr xs, slong n, nmod_t mod
     else
     {
         const slong m = (n + 1) / 2;
+        product_roots_arg_t left = *arg, right = *arg;
         mp_ptr tmp;
 
         tmp = _nmod_vec_init(n + 2);
 
-        _nmod_poly_product_roots_nmod_vec(tmp, xs, m, mod);
-        _nmod_poly_product_roots_nmod_vec(tmp + m + 1, xs + m, n - m, mod);
-        _nmod_poly_mul(poly, tmp, m + 1, tmp + m + 1, n - m + 1, mod);
+        left.poly = tmp;
+        left.n = m;
+        right.poly = tmp + m + 1;
+        right.xs = xs + m;
+        right.n = n - m;
+
+        /* the two halves are independent, so while several threads are
+           available the right half is done by a new thread */
+        if (arg->num_threads > 1 && n >= NMOD_POLY_TREE_THREADED_CUTOFF)
+        {
+            pthread_t thread;
+
+            right.num_threads = arg->num_threads / 2;
+            left.num_threads = arg->num_threads - right.num_threads;
+
+            pthread_create(&thread, NULL,
+                           _nmod_poly_product_roots_worker, &right);
+            _nmod_poly_product_roots(&left);
+            pthread_join(thread, NULL);
+        }
+        else
+        {
+            left.num_threads = right.num_threads = 1;
+
+            _nmod_poly_product_roots(&left);
+            _nmod_poly_product_roots(&right);
+        }
+
+        _nmod_poly_mul_threaded(poly, tmp, m + 1, tmp + m + 1, n - m + 1,
+                                                   mod, arg->num_threads);
 
         _nmod_vec_clear(tmp);
     }
 }
 
+void
+_nmod_poly_product_roots_nmod_vec(mp_ptr poly, mp_srcptr xs, slong n, nmod_t mod)
+{
+    product_roots_arg_t arg;
+
+    arg.poly = poly;
+    arg.xs = xs;
+    arg.n = n;
+    arg.mod = mod;
+    arg.num_threads = flint_get_num_threads();
+
+    _nmod_poly_product_roots(&arg);
+}
+
 void
 nmod_poly_product_roots_nmod_vec(nmod_poly_t poly, mp_srcptr xs, slong n)
 {
@@ -0,0 +1,54 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void
+_nmod_poly_rem_sparse(mp_ptr R, mp_ptr A, slong lenA, mp_srcptr f,
+                      slong lenf, const slong * exps, slong t, nmod_t mod)
+{
+    const slong n = lenf - 1;
+    slong i, j;
+    mp_limb_t c;
+
+    /* x^n = -sum_j f[e_j] x^{e_j}, eliminating from the top */
+    for (i = lenA - 1; i >= n; i--)
+    {
+        c = A[i];
+
+        if (c != UWORD(0))
+        {
+            for (j = 0; j < t; j++)
+                A[i - n + exps[j]] = nmod_sub(A[i - n + exps[j]],
+                                       nmod_mul(c, f[exps[j]], mod), mod);
+        }
+    }
+
+    if (R != A)
+        _nmod_vec_set(R, A, n);
+}
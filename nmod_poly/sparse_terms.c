@@ -0,0 +1,50 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+slong
+_nmod_poly_sparse_terms(slong * exps, mp_srcptr f, slong lenf)
+{
+    slong i, t = 0;
+
+    if (lenf < 2 || f[lenf - 1] != UWORD(1))
+        return -1;
+
+    for (i = 0; i < lenf - 1; i++)
+    {
+        if (f[i] != UWORD(0))
+        {
+            if (t == NMOD_POLY_SPARSE_TERMS)
+                return -1;
+            exps[t++] = i;
+        }
+    }
+
+    return t;
+}
@@ -0,0 +1,93 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_threaded....");
+    fflush(stdout);
+
+    for (i = 0; i < 20 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_t a, b, c, d;
+        slong len1, len2, num_threads;
+        mp_limb_t n = n_randtest_not_zero(state);
+
+        if (n == 1)
+            n = 2;
+
+        len1 = 1 + n_randint(state, 3 * NMOD_POLY_MUL_THREADED_CUTOFF);
+        len2 = 1 + n_randint(state, 3 * NMOD_POLY_MUL_THREADED_CUTOFF);
+        num_threads = 1 + n_randint(state, 8);
+
+        nmod_poly_init(a, n);
+        nmod_poly_init(b, n);
+        nmod_poly_init(c, n);
+        nmod_poly_init(d, n);
+
+        nmod_poly_randtest_not_zero(b, state, len1);
+        nmod_poly_randtest_not_zero(c, state, len2);
+        len1 = b->length;
+        len2 = c->length;
+
+        nmod_poly_mul(a, b, c);
+
+        nmod_poly_fit_length(d, len1 + len2 - 1);
+        _nmod_poly_mul_threaded(d->coeffs, b->coeffs, len1,
+                                c->coeffs, len2, d->mod, num_threads);
+        d->length = len1 + len2 - 1;
+        _nmod_poly_normalise(d);
+
+        result = nmod_poly_equal(a, d);
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("len1 = %wd, len2 = %wd, num_threads = %wd\n",
+                         len1, len2, num_threads);
+            abort();
+        }
+
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+        nmod_poly_clear(c);
+        nmod_poly_clear(d);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
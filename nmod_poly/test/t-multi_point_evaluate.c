@@ -0,0 +1,106 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result = 1;
+    FLINT_TEST_INIT(state);
+    
+    flint_printf("multi_point_evaluate....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_multi_point_t M;
+        nmod_poly_struct * P;
+        mp_ptr x, y, * z;
+        mp_limb_t mod;
+        slong j, k, num, npoints;
+
+        mod = n_randtest_prime(state, 0);
+        npoints = n_randint(state, n_randint(state, 4) == 0 ? 600 : 40);
+        num = n_randint(state, 4);
+
+        x = _nmod_vec_init(npoints);
+        y = _nmod_vec_init(npoints);
+        z = flint_malloc(sizeof(mp_ptr) * num);
+        P = flint_malloc(sizeof(nmod_poly_struct) * num);
+
+        for (j = 0; j < npoints; j++)
+            x[j] = n_randtest(state) % mod;
+
+        for (k = 0; k < num; k++)
+        {
+            z[k] = _nmod_vec_init(npoints);
+            nmod_poly_init(P + k, mod);
+            nmod_poly_randtest(P + k, state, n_randint(state, 2 * npoints + 2));
+        }
+
+        nmod_poly_multi_point_init(M, x, npoints, mod);
+        nmod_poly_multi_point_evaluate_vec(z, P, num, M);
+
+        for (k = 0; k < num; k++)
+        {
+            nmod_poly_evaluate_nmod_vec_iter(y, P + k, x, npoints);
+
+            result = _nmod_vec_equal(y, z[k], npoints);
+
+            if (!result)
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("mod=%wu, npoints=%wd, k=%wd\n\n", mod, npoints, k);
+                nmod_poly_print(P + k), flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        nmod_poly_multi_point_clear(M);
+
+        for (k = 0; k < num; k++)
+        {
+            _nmod_vec_clear(z[k]);
+            nmod_poly_clear(P + k);
+        }
+
+        flint_free(z);
+        flint_free(P);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(y);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
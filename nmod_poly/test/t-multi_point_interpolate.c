@@ -0,0 +1,172 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result = 1;
+    FLINT_TEST_INIT(state);
+    
+    flint_printf("multi_point_interpolate....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_multi_point_t M;
+        nmod_poly_t P, Q;
+        mp_ptr x, y;
+        mp_limb_t mod;
+        slong j, n, npoints;
+
+        mod = n_randtest_prime(state, 0);
+        npoints = n_randint(state, 4) == 0 ? 600 : 40;
+        npoints = n_randint(state, FLINT_MIN(npoints, mod));
+        n = n_randint(state, npoints + 1);
+
+        nmod_poly_init(P, mod);
+        nmod_poly_init(Q, mod);
+        x = _nmod_vec_init(npoints);
+        y = _nmod_vec_init(npoints);
+
+        nmod_poly_randtest(P, state, n);
+
+        for (j = 0; j < npoints; j++)
+            x[j] = mod - 1 - j;
+
+        /* a repeated point makes interpolation impossible */
+        if (npoints >= 2 && n_randint(state, 4) == 0)
+        {
+            x[n_randint(state, npoints)] = x[0];
+            x[0] = x[npoints - 1];
+
+            nmod_poly_multi_point_init(M, x, npoints, mod);
+            result = !nmod_poly_multi_point_can_interpolate(M);
+            nmod_poly_multi_point_clear(M);
+
+            if (!result)
+            {
+                flint_printf("FAIL (repeated point):\n");
+                flint_printf("mod=%wu, npoints=%wd\n\n", mod, npoints);
+                abort();
+            }
+
+            for (j = 0; j < npoints; j++)
+                x[j] = mod - 1 - j;
+        }
+
+        nmod_poly_multi_point_init(M, x, npoints, mod);
+
+        nmod_poly_multi_point_evaluate(y, P, M);
+        nmod_poly_multi_point_interpolate(Q, y, M);
+
+        result = nmod_poly_multi_point_can_interpolate(M)
+                 && nmod_poly_equal(P, Q);
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("mod=%wu, n=%wd, npoints=%wd\n\n", mod, n, npoints);
+            nmod_poly_print(P), flint_printf("\n\n");
+            nmod_poly_print(Q), flint_printf("\n\n");
+            abort();
+        }
+
+        nmod_poly_multi_point_clear(M);
+        nmod_poly_clear(P);
+        nmod_poly_clear(Q);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(y);
+    }
+
+    /* check threaded trees, evaluation and interpolation */
+    for (i = 0; i < 3 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_multi_point_t M;
+        nmod_poly_t P, Q;
+        mp_ptr x, y, z;
+        mp_limb_t mod;
+        slong j, n, npoints;
+
+        mod = n_randtest_prime(state, 0);
+        npoints = 3 * NMOD_POLY_TREE_THREADED_CUTOFF;
+        npoints = n_randint(state, FLINT_MIN(npoints, mod));
+        n = n_randint(state, 2 * npoints + 1);
+
+        nmod_poly_init(P, mod);
+        nmod_poly_init(Q, mod);
+        x = _nmod_vec_init(npoints);
+        y = _nmod_vec_init(npoints);
+        z = _nmod_vec_init(npoints);
+
+        nmod_poly_randtest(P, state, n);
+
+        for (j = 0; j < npoints; j++)
+            x[j] = mod - 1 - j;
+
+        nmod_poly_evaluate_nmod_vec_fast(z, P, x, npoints);
+
+        flint_set_num_threads(2 + n_randint(state, 7));
+
+        nmod_poly_multi_point_init(M, x, npoints, mod);
+        nmod_poly_multi_point_evaluate(y, P, M);
+
+        result = _nmod_vec_equal(y, z, npoints);
+
+        if (result && n <= npoints)
+        {
+            nmod_poly_multi_point_interpolate(Q, y, M);
+            result = nmod_poly_equal(P, Q);
+        }
+
+        flint_set_num_threads(1);
+
+        if (!result)
+        {
+            flint_printf("FAIL (threaded):\n");
+            flint_printf("mod=%wu, n=%wd, npoints=%wd\n\n", mod, n, npoints);
+            abort();
+        }
+
+        nmod_poly_multi_point_clear(M);
+        nmod_poly_clear(P);
+        nmod_poly_clear(Q);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(y);
+        _nmod_vec_clear(z);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
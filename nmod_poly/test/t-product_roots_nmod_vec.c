@@ -85,6 +85,40 @@ main(void)
         _nmod_vec_clear(x);
     }
 
+    /* check threaded against one thread */
+    for (i = 0; i < 5 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_t P, Q;
+        mp_ptr x;
+        mp_limb_t mod;
+        slong n;
+
+        n = n_randint(state, 3 * NMOD_POLY_TREE_THREADED_CUTOFF);
+        mod = n_randtest_prime(state, 0);
+
+        nmod_poly_init(P, mod);
+        nmod_poly_init(Q, mod);
+        x = _nmod_vec_init(n);
+        _nmod_vec_randtest(x, state, n, P->mod);
+
+        flint_set_num_threads(2 + n_randint(state, 7));
+        nmod_poly_product_roots_nmod_vec(P, x, n);
+        flint_set_num_threads(1);
+        nmod_poly_product_roots_nmod_vec(Q, x, n);
+
+        result = (nmod_poly_equal(P, Q));
+        if (!result)
+        {
+            flint_printf("FAIL (threaded):\n");
+            flint_printf("n = %wd\n", n);
+            abort();
+        }
+
+        nmod_poly_clear(P);
+        nmod_poly_clear(Q);
+        _nmod_vec_clear(x);
+    }
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
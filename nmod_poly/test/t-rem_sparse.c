@@ -0,0 +1,103 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("rem_sparse....");
+    fflush(stdout);
+
+    for (i = 0; i < 2000 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_t a, f, r, s;
+        slong exps[NMOD_POLY_SPARSE_TERMS];
+        slong j, n, t, terms;
+        mp_limb_t p;
+
+        do {
+            p = n_randtest_not_zero(state);
+        } while (p == 1);
+
+        nmod_poly_init(a, p);
+        nmod_poly_init(f, p);
+        nmod_poly_init(r, p);
+        nmod_poly_init(s, p);
+
+        /* Monic f with at most NMOD_POLY_SPARSE_TERMS lower terms */
+        n = n_randint(state, 200) + 1;
+        terms = n_randint(state, NMOD_POLY_SPARSE_TERMS + 1);
+        nmod_poly_set_coeff_ui(f, n, 1);
+        for (j = 0; j < terms; j++)
+            nmod_poly_set_coeff_ui(f, n_randint(state, n),
+                                   n_randint(state, p));
+
+        nmod_poly_randtest(a, state, n + n_randint(state, 2 * n + 1));
+        nmod_poly_fit_length(a, n);
+        if (a->length < n)
+            _nmod_vec_zero(a->coeffs + a->length, n - a->length);
+
+        nmod_poly_rem(r, a, f);
+
+        t = _nmod_poly_sparse_terms(exps, f->coeffs, f->length);
+
+        nmod_poly_fit_length(s, n);
+        _nmod_poly_rem_sparse(s->coeffs, a->coeffs, FLINT_MAX(a->length, n),
+                              f->coeffs, f->length, exps, t, f->mod);
+        s->length = n;
+        _nmod_poly_normalise(s);
+
+        result = (t >= 0 && t <= terms && nmod_poly_equal(r, s));
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("t = %wd\n", t);
+            nmod_poly_print(f), flint_printf("\n\n");
+            nmod_poly_print(r), flint_printf("\n\n");
+            nmod_poly_print(s), flint_printf("\n\n");
+            abort();
+        }
+
+        nmod_poly_clear(a);
+        nmod_poly_clear(f);
+        nmod_poly_clear(r);
+        nmod_poly_clear(s);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
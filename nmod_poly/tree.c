@@ -23,6 +23,7 @@
 
 ******************************************************************************/
 
+#include <pthread.h>
 #include <gmp.h>
 #include "flint.h"
 #include "ulong_extras.h"
@@ -58,11 +59,60 @@ void _nmod_poly_tree_free(mp_ptr * tree, slong len)
     }
 }
 
+typedef struct
+{
+    mp_ptr pb;
+    mp_srcptr pa;
+    slong pow;
+    slong len;
+    slong start;
+    slong stop;
+    slong num_threads;
+    nmod_t mod;
+}
+tree_level_arg_t;
+
+/* Computes the products for the blocks [start, stop) of the next level */
+static void
+_nmod_poly_tree_level_range(tree_level_arg_t * arg)
+{
+    const slong pow = arg->pow;
+    slong b, left;
+    mp_srcptr pa;
+    mp_ptr pb;
+
+    for (b = arg->start; b < arg->stop; b++)
+    {
+        pa = arg->pa + b * (2 * pow + 2);
+        pb = arg->pb + b * (2 * pow + 1);
+        left = arg->len - b * 2 * pow;
+
+        if (left >= 2 * pow)
+            _nmod_poly_mul_threaded(pb, pa, pow + 1, pa + pow + 1, pow + 1,
+                                              arg->mod, arg->num_threads);
+        else if (left > pow)
+            _nmod_poly_mul_threaded(pb, pa, pow + 1, pa + pow + 1,
+                                left - pow + 1, arg->mod, arg->num_threads);
+        else
+            _nmod_vec_set(pb, pa, left + 1);
+    }
+}
+
+static void *
+_nmod_poly_tree_level_worker(void * arg_ptr)
+{
+    _nmod_poly_tree_level_range((tree_level_arg_t *) arg_ptr);
+    flint_cleanup();
+    return NULL;
+}
+
 void
 _nmod_poly_tree_build(mp_ptr * tree, mp_srcptr roots, slong len, nmod_t mod)
 {
-    slong height, pow, left, i;
-    mp_ptr pa, pb;
+    slong height, pow, i, j, nb, num, num_threads;
+    tree_level_arg_t * args;
+    pthread_t * threads;
+    mp_ptr pa;
 
     if (len == 0)
         return;
@@ -100,24 +150,43 @@ _nmod_poly_tree_build(mp_ptr * tree, mp_srcptr roots, slong len, nmod_t mod)
         }
     }
 
+    num_threads = (len < NMOD_POLY_TREE_THREADED_CUTOFF) ?
+                                               1 : flint_get_num_threads();
+
+    args = flint_malloc(sizeof(tree_level_arg_t) * num_threads);
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+
+    /* Higher levels. The blocks of a level are shared out between the
+       threads; near the top, where there are fewer blocks than threads,
+       the individual products are split up as well. */
     for (i = 1; i < height - 1; i++)
     {
-        left = len;
         pow = WORD(1) << i;
-        pa = tree[i];
-        pb = tree[i + 1];
+        nb = (len + 2 * pow - 1) / (2 * pow);
+        num = FLINT_MIN(nb, num_threads);
 
-        while (left >= 2 * pow)
+        for (j = 0; j < num; j++)
         {
-            _nmod_poly_mul(pb, pa, pow + 1, pa + pow + 1, pow + 1, mod);
-            left -= 2 * pow;
-            pa += 2 * pow + 2;
-            pb += 2 * pow + 1;
+            args[j].pb = tree[i + 1];
+            args[j].pa = tree[i];
+            args[j].pow = pow;
+            args[j].len = len;
+            args[j].start = (j * nb) / num;
+            args[j].stop = ((j + 1) * nb) / num;
+            args[j].num_threads = num_threads / num;
+            args[j].mod = mod;
         }
 
-        if (left > pow)
-            _nmod_poly_mul(pb, pa, pow + 1, pa + pow + 1, left - pow + 1, mod);
-        else if (left > 0)
-            _nmod_vec_set(pb, pa, left + 1);
+        for (j = 1; j < num; j++)
+            pthread_create(threads + j, NULL,
+                           _nmod_poly_tree_level_worker, args + j);
+
+        _nmod_poly_tree_level_range(args);
+
+        for (j = 1; j < num; j++)
+            pthread_join(threads[j], NULL);
     }
+
+    flint_free(args);
+    flint_free(threads);
 }
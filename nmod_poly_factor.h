@@ -72,6 +72,18 @@ typedef struct
 }
 nmod_poly_interval_poly_arg_t;
 
+typedef struct
+{
+    nmod_poly_struct * pows;
+    slong num;
+    slong alloc;
+    nmod_poly_struct f;
+    nmod_poly_struct finv;
+}
+nmod_poly_frobenius_powers_struct;
+
+typedef nmod_poly_frobenius_powers_struct nmod_poly_frobenius_powers_t[1];
+
 /* Factoring  ****************************************************************/
 
 typedef nmod_poly_factor_struct nmod_poly_factor_t[1];
@@ -96,6 +108,29 @@ FLINT_DLL void nmod_poly_factor_concat(nmod_poly_factor_t res,
 
 FLINT_DLL void nmod_poly_factor_pow(nmod_poly_factor_t fac, slong exp);
 
+/* Frobenius power tables  **************************************************/
+
+FLINT_DLL void nmod_poly_frobenius_powers_init(nmod_poly_frobenius_powers_t frob,
+                                     const nmod_poly_t f);
+
+FLINT_DLL void nmod_poly_frobenius_powers_clear(nmod_poly_frobenius_powers_t frob);
+
+FLINT_DLL void nmod_poly_frobenius_powers_fit_length(
+                           nmod_poly_frobenius_powers_t frob, slong len);
+
+FLINT_DLL void nmod_poly_frobenius_power(nmod_poly_t res,
+                nmod_poly_frobenius_powers_t frob, ulong k,
+                const nmod_poly_t g, const nmod_poly_t ginv);
+
+/* Factoring with shared tables  *********************************************/
+
+FLINT_DLL void nmod_poly_factor_equal_deg_frob(nmod_poly_factor_t factors,
+    const nmod_poly_t pol, slong d, nmod_poly_frobenius_powers_t frob);
+
+FLINT_DLL void nmod_poly_factor_distinct_deg_frob(nmod_poly_factor_t res,
+                                   const nmod_poly_t poly, slong * const *degs,
+                                   nmod_poly_frobenius_powers_t frob);
+
 FLINT_DLL void nmod_poly_factor_equal_deg(nmod_poly_factor_t factors,
                                 const nmod_poly_t pol, slong d);
 
@@ -145,6 +180,11 @@ FLINT_DLL mp_limb_t nmod_poly_factor_with_kaltofen_shoup(nmod_poly_factor_t resu
 FLINT_DLL mp_limb_t nmod_poly_factor(nmod_poly_factor_t result,
     const nmod_poly_t input);
 
+/* Roots  *******************************************************************/
+
+FLINT_DLL void nmod_poly_roots(nmod_poly_factor_t r, const nmod_poly_t f,
+                               int with_multiplicity);
+
 FLINT_DLL void * _nmod_poly_interval_poly_worker(void* arg_ptr);
 
 #ifdef __cplusplus
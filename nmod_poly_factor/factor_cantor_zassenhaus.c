@@ -32,6 +32,7 @@ void
 nmod_poly_factor_cantor_zassenhaus(nmod_poly_factor_t res, const nmod_poly_t f)
 {
     nmod_poly_t h, v, g, x;
+    nmod_poly_frobenius_powers_t frob;
     slong i, j, num;
 
     nmod_poly_init_preinv(h, f->mod.n, f->mod.ninv);
@@ -43,6 +44,7 @@ nmod_poly_factor_cantor_zassenhaus(nmod_poly_factor_t res, const nmod_poly_t f)
     nmod_poly_set_coeff_ui(x, 1, 1);
 
     nmod_poly_make_monic(v, f);
+    nmod_poly_frobenius_powers_init(frob, v);
 
     i = 0;
     do
@@ -58,7 +60,7 @@ nmod_poly_factor_cantor_zassenhaus(nmod_poly_factor_t res, const nmod_poly_t f)
         {
             nmod_poly_make_monic(g, g);
             num = res->num;
-            nmod_poly_factor_equal_deg(res, g, i);
+            nmod_poly_factor_equal_deg_frob(res, g, i, frob);
 
             for (j = num; j < res->num; j++)
                 res->exp[j] = nmod_poly_remove(v, res->p + j);
@@ -69,6 +71,7 @@ nmod_poly_factor_cantor_zassenhaus(nmod_poly_factor_t res, const nmod_poly_t f)
     if (v->length > 1)
         nmod_poly_factor_insert(res, v, 1);
 
+    nmod_poly_frobenius_powers_clear(frob);
     nmod_poly_clear(g);
     nmod_poly_clear(h);
     nmod_poly_clear(v);
@@ -39,23 +39,10 @@ nmod_poly_factor_equal_deg(nmod_poly_factor_t factors,
     }
     else
     {
-        nmod_poly_t f, g;
-        flint_rand_t state;
+        nmod_poly_frobenius_powers_t frob;
 
-        nmod_poly_init_preinv(f, pol->mod.n, pol->mod.ninv);
-
-        flint_randinit(state);
-
-        while (!nmod_poly_factor_equal_deg_prob(f, state, pol, d)) {};
-
-        flint_randclear(state);
-
-        nmod_poly_init_preinv(g, pol->mod.n, pol->mod.ninv);
-        nmod_poly_div(g, pol, f);
-
-        nmod_poly_factor_equal_deg(factors, f, d);
-        nmod_poly_clear(f);
-        nmod_poly_factor_equal_deg(factors, g, d);
-        nmod_poly_clear(g);
+        nmod_poly_frobenius_powers_init(frob, pol);
+        nmod_poly_factor_equal_deg_frob(factors, pol, d, frob);
+        nmod_poly_frobenius_powers_clear(frob);
     }
 }
@@ -0,0 +1,229 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+/*
+    Given chain[j] = x^{p^{k_j}} mod pol for the prefixes k_j of the binary
+    expansion of d, splits pol using a random a and
+
+        b = a^{1 + p + ... + p^{d-1}} = a(x) a(x^p) ... a(x^{p^{d-1}})
+
+    raised to the power (p - 1)/2, or the trace a + a^2 + ... + a^{2^{d-1}}
+    when p = 2. The product is built by doubling, with O(log d) modular
+    compositions instead of the d log p modular squarings needed to
+    compute a^{(p^d - 1)/2} directly.
+ */
+static int
+_nmod_poly_factor_equal_deg_prob_chain(nmod_poly_t factor,
+    flint_rand_t state, const nmod_poly_t pol, const nmod_poly_t polinv,
+    slong d, const nmod_poly_struct * chain, slong nb)
+{
+    const mp_limb_t p = pol->mod.n;
+    nmod_poly_t a, b, t;
+    slong j;
+    int res = 1;
+
+    nmod_poly_init_preinv(a, p, pol->mod.ninv);
+
+    do {
+        nmod_poly_randtest(a, state, pol->length - 1);
+    } while (a->length <= 1);
+
+    nmod_poly_gcd(factor, a, pol);
+
+    if (factor->length != 1)
+    {
+        nmod_poly_clear(a);
+        return 1;
+    }
+
+    nmod_poly_init_preinv(b, p, pol->mod.ninv);
+    nmod_poly_init_preinv(t, p, pol->mod.ninv);
+
+    nmod_poly_set(b, a);
+
+    for (j = 1; j < nb; j++)
+    {
+        /* k -> 2k */
+        nmod_poly_compose_mod_brent_kung_preinv(t, b, chain + j - 1,
+                                                pol, polinv);
+        if (p == 2)
+            nmod_poly_add(b, b, t);
+        else
+            nmod_poly_mulmod_preinv(b, b, t, pol, polinv);
+
+        /* k -> k + 1 */
+        if ((d >> (nb - 1 - j)) & 1)
+        {
+            nmod_poly_compose_mod_brent_kung_preinv(t, b, chain + 0,
+                                                    pol, polinv);
+            if (p == 2)
+                nmod_poly_add(b, a, t);
+            else
+                nmod_poly_mulmod_preinv(b, a, t, pol, polinv);
+        }
+    }
+
+    if (p > 2)
+        nmod_poly_powmod_ui_binexp_preinv(b, b, (p - 1) / 2, pol, polinv);
+
+    nmod_poly_set_coeff_ui(b, 0,
+                           n_submod(nmod_poly_get_coeff_ui(b, 0), 1, p));
+
+    nmod_poly_gcd(factor, b, pol);
+
+    if ((factor->length <= 1) || (factor->length == pol->length)) res = 0;
+
+    nmod_poly_clear(a);
+    nmod_poly_clear(b);
+    nmod_poly_clear(t);
+
+    return res;
+}
+
+static void
+_nmod_poly_factor_equal_deg_frob(nmod_poly_factor_t factors,
+    const nmod_poly_t pol, slong d, const nmod_poly_struct * chain,
+    slong nb, flint_rand_t state)
+{
+    if (pol->length == d + 1)
+    {
+        nmod_poly_factor_insert(factors, pol, 1);
+    }
+    else
+    {
+        nmod_poly_t f, g, polinv;
+        nmod_poly_struct * sub;
+        slong j;
+
+        nmod_poly_init_preinv(f, pol->mod.n, pol->mod.ninv);
+        nmod_poly_init_preinv(g, pol->mod.n, pol->mod.ninv);
+
+        if (chain == NULL)
+        {
+            while (!nmod_poly_factor_equal_deg_prob(f, state, pol, d)) {};
+        }
+        else
+        {
+            nmod_poly_init_preinv(polinv, pol->mod.n, pol->mod.ninv);
+            nmod_poly_reverse(polinv, pol, pol->length);
+            nmod_poly_inv_series(polinv, polinv, pol->length);
+
+            while (!_nmod_poly_factor_equal_deg_prob_chain(f, state,
+                                            pol, polinv, d, chain, nb)) {};
+
+            nmod_poly_clear(polinv);
+        }
+
+        nmod_poly_make_monic(f, f);
+        nmod_poly_div(g, pol, f);
+
+        sub = (chain == NULL) ? NULL :
+              flint_malloc((nb - 1) * sizeof(nmod_poly_struct));
+
+        for (j = 0; sub != NULL && j < nb - 1; j++)
+        {
+            nmod_poly_init_preinv(sub + j, pol->mod.n, pol->mod.ninv);
+            nmod_poly_rem(sub + j, chain + j, f);
+        }
+        _nmod_poly_factor_equal_deg_frob(factors, f, d, sub, nb, state);
+
+        for (j = 0; sub != NULL && j < nb - 1; j++)
+            nmod_poly_rem(sub + j, chain + j, g);
+        _nmod_poly_factor_equal_deg_frob(factors, g, d, sub, nb, state);
+
+        if (sub != NULL)
+        {
+            for (j = 0; j < nb - 1; j++)
+                nmod_poly_clear(sub + j);
+            flint_free(sub);
+        }
+
+        nmod_poly_clear(f);
+        nmod_poly_clear(g);
+    }
+}
+
+void
+nmod_poly_factor_equal_deg_frob(nmod_poly_factor_t factors,
+    const nmod_poly_t pol, slong d, nmod_poly_frobenius_powers_t frob)
+{
+    const mp_limb_t p = pol->mod.n;
+    const slong n = pol->length - 1;
+    nmod_poly_struct * chain = NULL;
+    nmod_poly_t polinv;
+    flint_rand_t state;
+    slong j, k, nb = FLINT_BIT_COUNT(d);
+
+    if (pol->length == d + 1)
+    {
+        nmod_poly_factor_insert(factors, pol, 1);
+        return;
+    }
+
+    /* Compositions only pay off when p is large compared to the degree */
+    if (d > 1 && FLINT_BIT_COUNT(p) > ((n_sqrt(n) + 1) * 3) / 4)
+    {
+        nmod_poly_init_preinv(polinv, p, pol->mod.ninv);
+        nmod_poly_reverse(polinv, pol, pol->length);
+        nmod_poly_inv_series(polinv, polinv, pol->length);
+
+        chain = flint_malloc((nb - 1) * sizeof(nmod_poly_struct));
+
+        for (j = 0; j < nb - 1; j++)
+        {
+            nmod_poly_init_preinv(chain + j, p, pol->mod.ninv);
+            k = d >> (nb - 1 - j);
+
+            if (k < frob->num || j == 0)
+            {
+                nmod_poly_frobenius_power(chain + j, frob, k, pol, polinv);
+            }
+            else
+            {
+                nmod_poly_compose_mod_brent_kung_preinv(chain + j,
+                                   chain + j - 1, chain + j - 1, pol, polinv);
+                if (k & 1)
+                    nmod_poly_compose_mod_brent_kung_preinv(chain + j,
+                                   chain + j, chain + 0, pol, polinv);
+            }
+        }
+
+        nmod_poly_clear(polinv);
+    }
+
+    flint_randinit(state);
+    _nmod_poly_factor_equal_deg_frob(factors, pol, d, chain, nb, state);
+    flint_randclear(state);
+
+    if (chain != NULL)
+    {
+        for (j = 0; j < nb - 1; j++)
+            nmod_poly_clear(chain + j);
+        flint_free(chain);
+    }
+}
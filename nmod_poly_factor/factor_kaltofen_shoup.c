@@ -31,6 +31,7 @@ void nmod_poly_factor_kaltofen_shoup(nmod_poly_factor_t res,
 {
     nmod_poly_t v;
     nmod_poly_factor_t sq_free, dist_deg;
+    nmod_poly_frobenius_powers_t frob;
     slong i, j, k, l, res_num, dist_deg_num;
     slong *degs;
 
@@ -62,22 +63,29 @@ void nmod_poly_factor_kaltofen_shoup(nmod_poly_factor_t res,
     {
         dist_deg_num = dist_deg->num;
 
+        /* x^{p^i} mod the squarefree part, shared by the DDF and EDF */
+        nmod_poly_frobenius_powers_init(frob, sq_free->p + i);
+
         if ((flint_get_num_threads() > 1) &&
             ((sq_free->p + i)->length > (1024*flint_get_num_threads())/4))
             nmod_poly_factor_distinct_deg_threaded(dist_deg, sq_free->p + i,
                                                    &degs);
         else
-            nmod_poly_factor_distinct_deg(dist_deg, sq_free->p + i, &degs);
+            nmod_poly_factor_distinct_deg_frob(dist_deg, sq_free->p + i,
+                                               &degs, frob);
 
         /* compute equal-degree factorisation */
         for (j = dist_deg_num, l = 0; j < dist_deg->num; j++, l++)
         {
             res_num = res->num;
 
-            nmod_poly_factor_equal_deg(res, dist_deg->p + j, degs[l]);
+            nmod_poly_factor_equal_deg_frob(res, dist_deg->p + j, degs[l],
+                                            frob);
             for (k = res_num; k < res->num; k++)
                 res->exp[k] = nmod_poly_remove(v, res->p + k);
         }
+
+        nmod_poly_frobenius_powers_clear(frob);
     }
 
     flint_free(degs);
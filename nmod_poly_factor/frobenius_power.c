@@ -0,0 +1,68 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include "nmod_poly.h"
+
+void nmod_poly_frobenius_power(nmod_poly_t res,
+                nmod_poly_frobenius_powers_t frob, ulong k,
+                const nmod_poly_t g, const nmod_poly_t ginv)
+{
+    nmod_poly_t y, z;
+    ulong q, s;
+
+    if (k < frob->num)
+    {
+        nmod_poly_rem(res, frob->pows + k, g);
+        return;
+    }
+
+    nmod_poly_frobenius_powers_fit_length(frob, 2);
+
+    /* x^{p^k} = x^{p^r}(x^{p^{qs}}) where k = qs + r */
+    s = frob->num - 1;
+    q = k / s;
+
+    nmod_poly_init_preinv(y, g->mod.n, g->mod.ninv);
+    nmod_poly_init_preinv(z, g->mod.n, g->mod.ninv);
+
+    nmod_poly_rem(y, frob->pows + (k % s), g);
+    nmod_poly_rem(z, frob->pows + s, g);
+
+    while (q != 0)
+    {
+        if (q & 1)
+            nmod_poly_compose_mod_brent_kung_preinv(y, y, z, g, ginv);
+
+        q >>= 1;
+
+        if (q != 0)
+            nmod_poly_compose_mod_brent_kung_preinv(z, z, z, g, ginv);
+    }
+
+    nmod_poly_swap(res, y);
+
+    nmod_poly_clear(y);
+    nmod_poly_clear(z);
+}
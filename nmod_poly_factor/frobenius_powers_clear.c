@@ -0,0 +1,38 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include "nmod_poly.h"
+
+void nmod_poly_frobenius_powers_clear(nmod_poly_frobenius_powers_t frob)
+{
+    slong i;
+
+    for (i = 0; i < frob->num; i++)
+        nmod_poly_clear(frob->pows + i);
+
+    flint_free(frob->pows);
+    nmod_poly_clear(&frob->f);
+    nmod_poly_clear(&frob->finv);
+}
@@ -0,0 +1,86 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include "nmod_poly.h"
+
+void nmod_poly_frobenius_powers_fit_length(nmod_poly_frobenius_powers_t frob,
+                                           slong len)
+{
+    const mp_limb_t p = frob->f.mod.n;
+    const slong n = frob->f.length - 1;
+    slong i, k;
+
+    if (len <= frob->num)
+        return;
+
+    if (len > frob->alloc)
+    {
+        frob->alloc = FLINT_MAX(len, 2 * frob->alloc);
+        frob->pows = flint_realloc(frob->pows,
+                                   frob->alloc * sizeof(nmod_poly_struct));
+    }
+
+    if (n == 1)
+    {
+        /* Every element of GF(p) is fixed by the Frobenius */
+        for (i = frob->num; i < len; i++)
+        {
+            nmod_poly_init_preinv(frob->pows + i, p, frob->f.mod.ninv);
+            nmod_poly_set(frob->pows + i, frob->pows + 0);
+        }
+        frob->num = len;
+        return;
+    }
+
+    if (frob->num == 1)
+    {
+        nmod_poly_init_preinv(frob->pows + 1, p, frob->f.mod.ninv);
+        nmod_poly_powmod_x_ui_preinv(frob->pows + 1, p, &frob->f, &frob->finv);
+        frob->num = 2;
+    }
+
+    if (FLINT_BIT_COUNT(p) > ((n_sqrt(n) + 1) * 3) / 4)
+    {
+        /* x^{p^{s + t}} = x^{p^t}(x^{p^s}), doubling the table each time */
+        while (frob->num < len)
+        {
+            k = FLINT_MIN(frob->num - 1, len - frob->num);
+            nmod_poly_compose_mod_brent_kung_vec_preinv(frob->pows + frob->num,
+                            frob->pows + 1, frob->num - 1, k,
+                            &frob->f, &frob->finv);
+            frob->num += k;
+        }
+    }
+    else
+    {
+        for (i = frob->num; i < len; i++)
+        {
+            nmod_poly_init_preinv(frob->pows + i, p, frob->f.mod.ninv);
+            nmod_poly_powmod_ui_binexp_preinv(frob->pows + i,
+                          frob->pows + i - 1, p, &frob->f, &frob->finv);
+        }
+        frob->num = len;
+    }
+}
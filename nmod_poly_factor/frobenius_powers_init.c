@@ -0,0 +1,53 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include "nmod_poly.h"
+
+void nmod_poly_frobenius_powers_init(nmod_poly_frobenius_powers_t frob,
+                                     const nmod_poly_t f)
+{
+    if (f->length < 2)
+    {
+        flint_printf("Exception (nmod_poly_frobenius_powers_init). "
+                     "Modulus must have positive degree.\n");
+        abort();
+    }
+
+    nmod_poly_init_preinv(&frob->f, f->mod.n, f->mod.ninv);
+    nmod_poly_init_preinv(&frob->finv, f->mod.n, f->mod.ninv);
+
+    nmod_poly_make_monic(&frob->f, f);
+    nmod_poly_reverse(&frob->finv, &frob->f, frob->f.length);
+    nmod_poly_inv_series(&frob->finv, &frob->finv, frob->f.length);
+
+    frob->alloc = 2;
+    frob->pows = flint_malloc(frob->alloc * sizeof(nmod_poly_struct));
+
+    /* pows[0] = x mod f */
+    nmod_poly_init_preinv(frob->pows + 0, f->mod.n, f->mod.ninv);
+    nmod_poly_set_coeff_ui(frob->pows + 0, 1, 1);
+    nmod_poly_rem(frob->pows + 0, frob->pows + 0, &frob->f);
+    frob->num = 1;
+}
@@ -41,7 +41,9 @@ int nmod_poly_is_irreducible_ddf(const nmod_poly_t poly)
 {
 
     nmod_poly_t f, v, vinv, tmp;
-    nmod_poly_t *h, *H, *I;
+    nmod_poly_struct * h;
+    nmod_poly_t *H, *I;
+    nmod_poly_frobenius_powers_t frob;
     nmod_mat_t HH;
     slong i, j, l, m, n, d;
     double beta;
@@ -64,16 +66,13 @@ int nmod_poly_is_irreducible_ddf(const nmod_poly_t poly)
     nmod_poly_init_preinv(vinv, poly->mod.n, poly->mod.ninv);
     nmod_poly_init_preinv(tmp, poly->mod.n, poly->mod.ninv);
 
-    if (!(h = flint_malloc((2 * m + l + 1) * sizeof(nmod_poly_struct))))
+    if (!(H = flint_malloc(2 * m * sizeof(nmod_poly_struct))))
     {
         flint_printf("Exception (nmod_poly_is_irreducible_ddf):\n");
         flint_printf("Not enough memory.\n");
         abort();
     }
-    H = h + (l + 1);
     I = H + m;
-    nmod_poly_init_preinv(h[0], poly->mod.n, poly->mod.ninv);
-    nmod_poly_init_preinv(h[1], poly->mod.n, poly->mod.ninv);
     for (i = 0; i < m; i++)
     {
         nmod_poly_init_preinv(H[i], poly->mod.n, poly->mod.ninv);
@@ -84,35 +83,14 @@ int nmod_poly_is_irreducible_ddf(const nmod_poly_t poly)
 
     nmod_poly_reverse(vinv, v, v->length);
     nmod_poly_inv_series(vinv, vinv, v->length);
-    /* compute baby steps: h[i]=x^{p^i}mod v */
-    nmod_poly_set_coeff_ui(h[0], 1, 1);
-    nmod_poly_powmod_x_ui_preinv(h[1], poly->mod.n, v, vinv);
-    if (FLINT_BIT_COUNT(poly->mod.n) > ((n_sqrt(v->length - 1) + 1) * 3) / 4)
-    {
-        for (i= 1; i < FLINT_BIT_COUNT (l); i++)
-            nmod_poly_compose_mod_brent_kung_vec_preinv(*(h + 1 +
-                                                        (1 << (i - 1))),
-                                                        *(h + 1),
-                                                        (1 << (i - 1)),
-                                                        (1 << (i - 1)), v,
-                                                        vinv);
-        nmod_poly_compose_mod_brent_kung_vec_preinv(*(h + 1 + (1 << (i - 1))),
-                                                    *(h + 1), (1 << (i - 1)),
-                                                    l - (1 << (i - 1)), v,
-                                                    vinv);
-    }
-    else
-    {
-        for (i = 2; i < l + 1; i++)
-        {
-            nmod_poly_init_preinv(h[i], poly->mod.n, poly->mod.ninv);
-            nmod_poly_powmod_ui_binexp_preinv(h[i], h[i - 1], poly->mod.n,
-                                              v, vinv);
-        }
-    }
+
+    /* baby steps: h[i] = x^{p^i} mod v */
+    nmod_poly_frobenius_powers_init(frob, v);
+    nmod_poly_frobenius_powers_fit_length(frob, l + 1);
+    h = frob->pows;
 
     /* compute coarse distinct-degree factorisation */
-    nmod_poly_set(H[0], h[l]);
+    nmod_poly_set(H[0], h + l);
     nmod_mat_init(HH, n_sqrt(v->length - 1) + 1, v->length - 1, poly->mod.n);
     nmod_poly_precompute_matrix(HH, H[0], v, vinv);
     d = 1;
@@ -126,7 +104,7 @@ int nmod_poly_is_irreducible_ddf(const nmod_poly_t poly)
         nmod_poly_set_coeff_ui(I[j], 0, 1);
         for (i = l - 1; (i >= 0) && (2 * d <= v->length - 1); i--, d++)
         {
-            nmod_poly_rem(tmp, h[i], v);
+            nmod_poly_rem(tmp, h + i, v);
             nmod_poly_sub(tmp, H[j], tmp);
             nmod_poly_mulmod_preinv (I[j], tmp, I[j], v, vinv);
         }
@@ -148,14 +126,13 @@ int nmod_poly_is_irreducible_ddf(const nmod_poly_t poly)
 
     nmod_mat_clear (HH);
 
-    for (i = 0; i < l + 1; i++)
-        nmod_poly_clear(h[i]);
+    nmod_poly_frobenius_powers_clear(frob);
     for (i = 0; i < m; i++)
     {
         nmod_poly_clear(H[i]);
         nmod_poly_clear(I[i]);
     }
-    flint_free (h);
+    flint_free(H);
 
     return result;
 }
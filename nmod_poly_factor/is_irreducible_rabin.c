@@ -54,25 +54,24 @@ nmod_poly_is_irreducible_rabin(const nmod_poly_t f)
     {
         const mp_limb_t p = nmod_poly_modulus(f);
         const slong n     = nmod_poly_degree(f);
-        nmod_poly_t a, x, x_p;
+        nmod_poly_frobenius_powers_t frob;
+        nmod_poly_t a, x;
+        int res = 1;
 
         nmod_poly_init(a, p);
         nmod_poly_init(x, p);
-        nmod_poly_init(x_p, p);
         nmod_poly_set_coeff_ui(x, 1, 1);
 
+        /* x^{p^k} mod f is computed with O(log k) modular compositions */
+        nmod_poly_frobenius_powers_init(frob, f);
+
         /* Compute x^q mod f */
-        nmod_poly_powpowmod(x_p, x, p, n, f);
-        if (!nmod_poly_is_zero(x_p))
-            nmod_poly_make_monic(x_p, x_p);
+        nmod_poly_frobenius_power(a, frob, n, &frob->f, &frob->finv);
 
         /* Now do the irreducibility test */
-        if (!nmod_poly_equal(x_p, x))
+        if (!nmod_poly_equal(a, x))
         {
-            nmod_poly_clear(a);
-            nmod_poly_clear(x);
-            nmod_poly_clear(x_p);
-            return 0;
+            res = 0;
         }
         else
         {
@@ -82,29 +81,23 @@ nmod_poly_is_irreducible_rabin(const nmod_poly_t f)
             n_factor_init(&factors);
             n_factor(&factors, n, 1);
 
-            for (i = 0; i < factors.num; i++)
+            for (i = 0; i < factors.num && res; i++)
             {
-                nmod_poly_powpowmod(a, x, p, n / factors.p[i], f);
+                nmod_poly_frobenius_power(a, frob, n / factors.p[i],
+                                          &frob->f, &frob->finv);
                 nmod_poly_sub(a, a, x);
-
-                if (!nmod_poly_is_zero(a))
-                    nmod_poly_make_monic(a, a);
-
-                nmod_poly_gcd(a, a, f);
+                nmod_poly_gcd(a, a, &frob->f);
 
                 if (a->length != 1)
-                {
-                    nmod_poly_clear(a);
-                    nmod_poly_clear(x);
-                    nmod_poly_clear(x_p);
-                    return 0;
-                }
+                    res = 0;
             }
         }
 
+        nmod_poly_frobenius_powers_clear(frob);
         nmod_poly_clear(a);
         nmod_poly_clear(x);
-        nmod_poly_clear(x_p);   
+
+        return res;
     }
 
     return 1;
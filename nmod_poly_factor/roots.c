@@ -0,0 +1,234 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+/* append the root a, i.e. the factor x - a, with the given multiplicity */
+static void
+_nmod_poly_roots_push(nmod_poly_factor_t r, mp_limb_t a, slong mult,
+                      nmod_t mod)
+{
+    nmod_poly_struct * f;
+
+    nmod_poly_factor_fit_length(r, r->num + 1);
+
+    f = r->p + r->num;
+    f->mod = mod;
+    nmod_poly_fit_length(f, 2);
+    f->coeffs[0] = nmod_neg(a, mod);
+    f->coeffs[1] = UWORD(1);
+    f->length = 2;
+    r->exp[r->num] = mult;
+    r->num++;
+}
+
+/*
+    f is monic, squarefree and a product of linear factors. It is split
+    by gcd((x + a)^((p - 1)/2) - 1, f) for random shifts a; quadratics
+    are solved directly.
+*/
+static void
+_nmod_poly_roots_split(nmod_poly_factor_t r, const nmod_poly_t f,
+                       slong mult, flint_rand_t state)
+{
+    mp_limb_t p = f->mod.n;
+    nmod_poly_t g, h, finv;
+
+    if (f->length <= 1)
+        return;
+
+    if (f->length == 2)
+    {
+        _nmod_poly_roots_push(r, nmod_neg(f->coeffs[0], f->mod), mult,
+                              f->mod);
+        return;
+    }
+
+    if (p == 2)
+    {
+        /* f = x (x + 1) */
+        _nmod_poly_roots_push(r, 0, mult, f->mod);
+        _nmod_poly_roots_push(r, 1, mult, f->mod);
+        return;
+    }
+
+    if (f->length == 3)
+    {
+        /* x^2 + b x + c has roots (-b +- sqrt(b^2 - 4c))/2 */
+        mp_limb_t b = f->coeffs[1], c = f->coeffs[0], d, s, inv2;
+
+        d = nmod_sub(nmod_mul(b, b, f->mod),
+                     nmod_mul(UWORD(4) % p, c, f->mod), f->mod);
+        s = n_sqrtmod(d, p);
+        inv2 = (p + 1) / 2;
+        _nmod_poly_roots_push(r, nmod_mul(nmod_sub(s, b, f->mod), inv2,
+                                          f->mod), mult, f->mod);
+        _nmod_poly_roots_push(r, nmod_mul(nmod_sub(nmod_neg(s, f->mod), b,
+                                          f->mod), inv2, f->mod), mult, f->mod);
+        return;
+    }
+
+    nmod_poly_init_preinv(g, p, f->mod.ninv);
+    nmod_poly_init_preinv(h, p, f->mod.ninv);
+    nmod_poly_init_preinv(finv, p, f->mod.ninv);
+
+    nmod_poly_reverse(finv, f, f->length);
+    nmod_poly_inv_series_newton(finv, finv, f->length);
+
+    while (1)
+    {
+        nmod_poly_zero(h);
+        nmod_poly_set_coeff_ui(h, 1, 1);
+        nmod_poly_set_coeff_ui(h, 0, n_randint(state, p));
+
+        nmod_poly_powmod_ui_binexp_preinv(h, h, (p - 1) / 2, f, finv);
+        if (h->length == 0)
+            continue;
+
+        nmod_poly_set_coeff_ui(h, 0, nmod_sub(h->coeffs[0], 1, f->mod));
+        nmod_poly_gcd(g, h, f);
+
+        if (g->length > 1 && g->length < f->length)
+            break;
+    }
+
+    nmod_poly_div(h, f, g);
+
+    _nmod_poly_roots_split(r, g, mult, state);
+    _nmod_poly_roots_split(r, h, mult, state);
+
+    nmod_poly_clear(g);
+    nmod_poly_clear(h);
+    nmod_poly_clear(finv);
+}
+
+/* pushes each distinct root of the monic polynomial f once */
+static void
+_nmod_poly_roots_distinct(nmod_poly_factor_t r, const nmod_poly_t f,
+                          slong mult, flint_rand_t state)
+{
+    mp_limb_t p = f->mod.n;
+    slong i, n = f->length - 1;
+
+    if (n <= 0)
+        return;
+
+    if (n == 1)
+    {
+        _nmod_poly_roots_push(r, nmod_neg(f->coeffs[0], f->mod), mult,
+                              f->mod);
+    }
+    else if (p <= n)
+    {
+        /* tiny field: evaluate at every point */
+        mp_ptr xs, ys;
+
+        xs = _nmod_vec_init(2 * p);
+        ys = xs + p;
+
+        for (i = 0; i < p; i++)
+            xs[i] = i;
+
+        nmod_poly_evaluate_nmod_vec_fast(ys, f, xs, p);
+
+        for (i = 0; i < p; i++)
+            if (ys[i] == 0)
+                _nmod_poly_roots_push(r, i, mult, f->mod);
+
+        _nmod_vec_clear(xs);
+    }
+    else
+    {
+        /* g = gcd(f, x^p - x) is the product of the distinct linear factors */
+        nmod_poly_t g, x, finv;
+
+        nmod_poly_init_preinv(g, p, f->mod.ninv);
+        nmod_poly_init_preinv(x, p, f->mod.ninv);
+        nmod_poly_init_preinv(finv, p, f->mod.ninv);
+
+        nmod_poly_reverse(finv, f, f->length);
+        nmod_poly_inv_series_newton(finv, finv, f->length);
+
+        nmod_poly_powmod_x_ui_preinv(g, p, f, finv);
+        nmod_poly_set_coeff_ui(x, 1, 1);
+        nmod_poly_sub(g, g, x);
+        nmod_poly_gcd(g, g, f);
+
+        _nmod_poly_roots_split(r, g, mult, state);
+
+        nmod_poly_clear(g);
+        nmod_poly_clear(x);
+        nmod_poly_clear(finv);
+    }
+}
+
+void
+nmod_poly_roots(nmod_poly_factor_t r, const nmod_poly_t f,
+                int with_multiplicity)
+{
+    nmod_poly_t v;
+    flint_rand_t state;
+    slong i;
+
+    r->num = 0;
+
+    if (f->length == 0)
+    {
+        flint_printf("Exception (nmod_poly_roots). Input polynomial is zero.\n");
+        abort();
+    }
+
+    if (f->length == 1)
+        return;
+
+    nmod_poly_init_preinv(v, f->mod.n, f->mod.ninv);
+    nmod_poly_make_monic(v, f);
+
+    flint_randinit(state);
+
+    if (with_multiplicity)
+    {
+        nmod_poly_factor_t sqf;
+
+        nmod_poly_factor_init(sqf);
+        nmod_poly_factor_squarefree(sqf, v);
+
+        for (i = 0; i < sqf->num; i++)
+            _nmod_poly_roots_distinct(r, sqf->p + i, sqf->exp[i], state);
+
+        nmod_poly_factor_clear(sqf);
+    }
+    else
+    {
+        _nmod_poly_roots_distinct(r, v, 1, state);
+    }
+
+    flint_randclear(state);
+    nmod_poly_clear(v);
+}
@@ -0,0 +1,106 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("frobenius_power....");
+    fflush(stdout);
+
+    /* Compare x^{p^k} mod g with repeated powering, for g dividing f */
+    for (iter = 0; iter < 500 * flint_test_multiplier(); iter++)
+    {
+        nmod_poly_t f, g, ginv, h, a, b;
+        nmod_poly_frobenius_powers_t frob;
+        mp_limb_t p;
+        slong len;
+        ulong i, k;
+
+        p = n_randtest_prime(state, 0);
+
+        nmod_poly_init(f, p);
+        nmod_poly_init(g, p);
+        nmod_poly_init(ginv, p);
+        nmod_poly_init(h, p);
+        nmod_poly_init(a, p);
+        nmod_poly_init(b, p);
+
+        do {
+            nmod_poly_randtest_monic(g, state, n_randint(state, 20) + 2);
+        } while (g->length < 2);
+
+        nmod_poly_randtest_monic(h, state, n_randint(state, 20) + 1);
+        nmod_poly_mul(f, g, h);
+
+        nmod_poly_reverse(ginv, g, g->length);
+        nmod_poly_inv_series(ginv, ginv, g->length);
+
+        nmod_poly_frobenius_powers_init(frob, f);
+        len = n_randint(state, 6);
+        if (len > 0)
+            nmod_poly_frobenius_powers_fit_length(frob, len);
+
+        k = n_randint(state, 30);
+        nmod_poly_frobenius_power(a, frob, k, g, ginv);
+
+        nmod_poly_set_coeff_ui(b, 1, 1);
+        nmod_poly_rem(b, b, g);
+        for (i = 0; i < k; i++)
+            nmod_poly_powmod_ui_binexp(b, b, p, g);
+
+        if (!nmod_poly_equal(a, b))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("p = %wu, k = %wu, len = %wd\n", p, k, len);
+            nmod_poly_print(g), flint_printf("\n\n");
+            nmod_poly_print(a), flint_printf("\n\n");
+            nmod_poly_print(b), flint_printf("\n\n");
+            abort();
+        }
+
+        nmod_poly_frobenius_powers_clear(frob);
+        nmod_poly_clear(f);
+        nmod_poly_clear(g);
+        nmod_poly_clear(ginv);
+        nmod_poly_clear(h);
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,123 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("roots....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 500 * flint_test_multiplier(); iter++)
+    {
+        nmod_poly_t f, g;
+        nmod_poly_factor_t r, fac;
+        mp_limb_t p;
+        slong i, j, k, num, e, lin;
+        int mult, result;
+
+        /* mix tiny fields, where every point is evaluated, and large ones */
+        if (n_randint(state, 2))
+            p = n_nth_prime(n_randint(state, 10) + 1);
+        else
+            p = n_randtest_prime(state, 0);
+
+        nmod_poly_init(f, p);
+        nmod_poly_init(g, p);
+        nmod_poly_factor_init(r);
+        nmod_poly_factor_init(fac);
+
+        nmod_poly_set_coeff_ui(f, 0, n_randint(state, p - 1) + 1);
+
+        /* random linear factors with multiplicity */
+        num = n_randint(state, 12);
+        for (i = 0; i < num; i++)
+        {
+            nmod_poly_zero(g);
+            nmod_poly_set_coeff_ui(g, 1, 1);
+            nmod_poly_set_coeff_ui(g, 0, n_randint(state, p));
+            e = n_randint(state, 3) + 1;
+            for (j = 0; j < e; j++)
+                nmod_poly_mul(f, f, g);
+        }
+
+        /* and some noise, possibly with further roots */
+        nmod_poly_randtest(g, state, n_randint(state, 12));
+        if (!nmod_poly_is_zero(g))
+            nmod_poly_mul(f, f, g);
+
+        mult = n_randint(state, 2);
+        nmod_poly_roots(r, f, mult);
+
+        /* compare with the linear factors of the full factorisation */
+        nmod_poly_factor(fac, f);
+
+        result = 1;
+        lin = 0;
+        for (i = 0; i < fac->num; i++)
+        {
+            if (fac->p[i].length != 2)
+                continue;
+
+            lin++;
+            for (k = 0; k < r->num; k++)
+                if (nmod_poly_equal(fac->p + i, r->p + k))
+                    break;
+
+            result = result && (k < r->num) &&
+                     (r->exp[k] == (mult ? fac->exp[i] : 1));
+        }
+        result = result && (lin == r->num);
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("p = %wu, with_multiplicity = %d\n", p, mult);
+            nmod_poly_print(f); flint_printf("\n\n");
+            nmod_poly_factor_print(r); flint_printf("\n\n");
+            nmod_poly_factor_print(fac); flint_printf("\n\n");
+            abort();
+        }
+
+        nmod_poly_clear(f);
+        nmod_poly_clear(g);
+        nmod_poly_factor_clear(r);
+        nmod_poly_factor_clear(fac);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,130 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#ifndef NMOD_SPARSE_MAT_H
+#define NMOD_SPARSE_MAT_H
+
+#ifdef NMOD_SPARSE_MAT_INLINES_C
+#define NMOD_SPARSE_MAT_INLINE FLINT_DLL
+#else
+#define NMOD_SPARSE_MAT_INLINE static __inline__
+#endif
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdlib.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*
+   Sparse matrices over Z/nZ in compressed sparse row format: the nonzero
+   entries of row i are entries[k] in columns cols[k] for
+   row_starts[i] <= k < row_starts[i + 1].
+*/
+typedef struct
+{
+    mp_limb_t * entries;
+    slong * cols;
+    slong * row_starts;
+    slong r;
+    slong c;
+    slong nnz;
+    nmod_t mod;
+}
+nmod_sparse_mat_struct;
+
+typedef nmod_sparse_mat_struct nmod_sparse_mat_t[1];
+
+NMOD_SPARSE_MAT_INLINE
+slong nmod_sparse_mat_nrows(const nmod_sparse_mat_t mat)
+{
+   return mat->r;
+}
+
+NMOD_SPARSE_MAT_INLINE
+slong nmod_sparse_mat_ncols(const nmod_sparse_mat_t mat)
+{
+   return mat->c;
+}
+
+NMOD_SPARSE_MAT_INLINE
+slong nmod_sparse_mat_nnz(const nmod_sparse_mat_t mat)
+{
+   return mat->nnz;
+}
+
+/* Memory management */
+
+FLINT_DLL void nmod_sparse_mat_init(nmod_sparse_mat_t mat,
+                                        slong rows, slong cols, mp_limb_t n);
+FLINT_DLL void nmod_sparse_mat_clear(nmod_sparse_mat_t mat);
+
+/* Conversions */
+
+FLINT_DLL void nmod_sparse_mat_set_triplets(nmod_sparse_mat_t mat,
+       const slong * rows, const slong * cols, mp_srcptr vals, slong len);
+FLINT_DLL void nmod_sparse_mat_set_nmod_mat(nmod_sparse_mat_t B,
+                                                        const nmod_mat_t A);
+FLINT_DLL void nmod_sparse_mat_get_nmod_mat(nmod_mat_t B,
+                                                const nmod_sparse_mat_t A);
+
+/* Matrix-vector multiplication */
+
+FLINT_DLL void nmod_sparse_mat_mul_vec(mp_ptr y,
+                                  const nmod_sparse_mat_t A, mp_srcptr x);
+FLINT_DLL void _nmod_sparse_mat_mul_vec(mp_ptr y, const nmod_sparse_mat_t A,
+                          mp_srcptr x, slong r0, slong r1, int nlimbs);
+FLINT_DLL void nmod_sparse_mat_mul_vec_threaded(mp_ptr y,
+                                  const nmod_sparse_mat_t A, mp_srcptr x);
+
+/* Structured Gaussian elimination */
+
+FLINT_DLL slong nmod_sparse_mat_echelon(nmod_sparse_mat_t E, slong * pivots,
+                                                 const nmod_sparse_mat_t A);
+FLINT_DLL slong nmod_sparse_mat_rank(const nmod_sparse_mat_t A);
+FLINT_DLL slong nmod_sparse_mat_nullspace(nmod_sparse_mat_t X,
+                                                 const nmod_sparse_mat_t A);
+
+/* Solving */
+
+FLINT_DLL int nmod_sparse_mat_solve_wiedemann(mp_ptr x,
+                                  const nmod_sparse_mat_t A, mp_srcptr b);
+FLINT_DLL slong nmod_sparse_mat_nullspace_block_wiedemann(
+          nmod_sparse_mat_t X, const nmod_sparse_mat_t A, slong b);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
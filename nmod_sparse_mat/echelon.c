@@ -0,0 +1,516 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+/*
+    Structured Gaussian elimination. The active rows are kept as sparse
+    vectors sorted by column, and each pivot is taken in a column of
+    least weight, in the shortest active row containing it. Columns of
+    weight one are thus eliminated first, without fill-in. Once more
+    than a quarter of the entries of the active part are nonzero, it is
+    finished by dense elimination.
+*/
+
+typedef struct
+{
+    slong * cols;
+    mp_ptr vals;
+    slong len;
+    slong alloc;
+}
+_row_struct;
+
+/* min-heap of (weight, column) pairs; entries whose weight is no longer
+   the weight of their column are skipped when they reach the top */
+typedef struct
+{
+    slong * w;
+    slong * c;
+    slong num;
+    slong alloc;
+}
+_heap_struct;
+
+static void
+_heap_push(_heap_struct * h, slong w, slong c)
+{
+    slong i, j;
+
+    if (h->num == h->alloc)
+    {
+        h->alloc = 2 * h->alloc + 1;
+        h->w = flint_realloc(h->w, sizeof(slong) * h->alloc);
+        h->c = flint_realloc(h->c, sizeof(slong) * h->alloc);
+    }
+
+    for (i = h->num++; i > 0 && h->w[j = (i - 1) / 2] > w; i = j)
+    {
+        h->w[i] = h->w[j];
+        h->c[i] = h->c[j];
+    }
+
+    h->w[i] = w;
+    h->c[i] = c;
+}
+
+static void
+_heap_pop(_heap_struct * h)
+{
+    slong i, j, n, w, c;
+
+    n = --h->num;
+    w = h->w[n];
+    c = h->c[n];
+
+    for (i = 0; (j = 2 * i + 1) < n; i = j)
+    {
+        if (j + 1 < n && h->w[j + 1] < h->w[j])
+            j++;
+
+        if (w <= h->w[j])
+            break;
+
+        h->w[i] = h->w[j];
+        h->c[i] = h->c[j];
+    }
+
+    h->w[i] = w;
+    h->c[i] = c;
+}
+
+static void
+_row_fit_length(_row_struct * row, slong len)
+{
+    if (row->alloc < len)
+    {
+        row->alloc = FLINT_MAX(len, 2 * row->alloc);
+        row->cols = flint_realloc(row->cols, sizeof(slong) * row->alloc);
+        row->vals = flint_realloc(row->vals, sizeof(mp_limb_t) * row->alloc);
+    }
+}
+
+static slong
+_row_find(const _row_struct * row, slong c)
+{
+    slong lo = 0, hi = row->len, mid;
+
+    while (lo < hi)
+    {
+        mid = lo + (hi - lo) / 2;
+
+        if (row->cols[mid] < c)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return (lo < row->len && row->cols[lo] == c) ? lo : -1;
+}
+
+static int
+_slong_cmp(const void * a, const void * b)
+{
+    slong x = *((const slong *) a), y = *((const slong *) b);
+
+    return (x > y) - (x < y);
+}
+
+typedef struct
+{
+    slong * weight;
+    slong ** col_rows;
+    slong * col_len;
+    slong * col_alloc;
+    _heap_struct heap;
+    slong active_nnz;
+    slong active_cols;
+}
+_cols_struct;
+
+static void
+_col_add_row(_cols_struct * C, slong c, slong i)
+{
+    if (C->col_len[c] == C->col_alloc[c])
+    {
+        C->col_alloc[c] = 2 * C->col_alloc[c] + 1;
+        C->col_rows[c] = flint_realloc(C->col_rows[c],
+                                           sizeof(slong) * C->col_alloc[c]);
+    }
+
+    C->col_rows[c][C->col_len[c]++] = i;
+}
+
+static void
+_col_dec(_cols_struct * C, slong c)
+{
+    if (--C->weight[c] == 0)
+        C->active_cols--;
+    else
+        _heap_push(&C->heap, C->weight[c], c);
+}
+
+/* sets row i to row i minus a times row p, updating the column data */
+static void
+_row_submul(_row_struct * rows, _row_struct * tmp, slong i, slong p,
+                                   mp_limb_t a, _cols_struct * C, nmod_t mod)
+{
+    _row_struct * ri = rows + i, * rp = rows + p, t;
+    slong ki = 0, kp = 0, len = 0, c;
+    mp_limb_t v;
+
+    _row_fit_length(tmp, ri->len + rp->len);
+
+    while (ki < ri->len || kp < rp->len)
+    {
+        if (kp == rp->len || (ki < ri->len && ri->cols[ki] < rp->cols[kp]))
+        {
+            tmp->cols[len] = ri->cols[ki];
+            tmp->vals[len] = ri->vals[ki];
+            len++;
+            ki++;
+        }
+        else if (ki == ri->len || rp->cols[kp] < ri->cols[ki])
+        {
+            /* fill-in */
+            c = rp->cols[kp];
+            tmp->cols[len] = c;
+            tmp->vals[len] = nmod_neg(nmod_mul(a, rp->vals[kp], mod), mod);
+            len++;
+            kp++;
+
+            if (C->weight[c]++ == 0)
+                C->active_cols++;
+            _heap_push(&C->heap, C->weight[c], c);
+            _col_add_row(C, c, i);
+        }
+        else
+        {
+            c = ri->cols[ki];
+            v = nmod_sub(ri->vals[ki], nmod_mul(a, rp->vals[kp], mod), mod);
+            ki++;
+            kp++;
+
+            if (v != 0)
+            {
+                tmp->cols[len] = c;
+                tmp->vals[len] = v;
+                len++;
+            }
+            else
+                _col_dec(C, c);
+        }
+    }
+
+    C->active_nnz += len - ri->len;
+    tmp->len = len;
+
+    t = *ri;
+    *ri = *tmp;
+    *tmp = t;
+}
+
+slong
+nmod_sparse_mat_echelon(nmod_sparse_mat_t E, slong * pivots,
+                                                 const nmod_sparse_mat_t A)
+{
+    slong m = A->r, n = A->c;
+    slong i, j, k, p, t, c, len, rank, active_rows, nnz;
+    slong * pivot_col, * order, * touched;
+    _row_struct * rows, tmp;
+    _cols_struct C;
+    mp_ptr acc;
+    char * mark;
+    mp_limb_t a;
+
+    rows = flint_malloc(sizeof(_row_struct) * FLINT_MAX(m, 1));
+    pivot_col = flint_malloc(sizeof(slong) * FLINT_MAX(m, 1));
+    order = flint_malloc(sizeof(slong) * FLINT_MAX(m, 1));
+
+    C.weight = flint_calloc(FLINT_MAX(n, 1), sizeof(slong));
+    C.col_rows = flint_calloc(FLINT_MAX(n, 1), sizeof(slong *));
+    C.col_len = flint_calloc(FLINT_MAX(n, 1), sizeof(slong));
+    C.col_alloc = flint_calloc(FLINT_MAX(n, 1), sizeof(slong));
+    C.heap.w = C.heap.c = NULL;
+    C.heap.num = C.heap.alloc = 0;
+    C.active_nnz = C.active_cols = 0;
+
+    /* sort the rows and merge repeated columns */
+    acc = _nmod_vec_init(FLINT_MAX(n, 1));
+    _nmod_vec_zero(acc, n);
+    mark = flint_calloc(FLINT_MAX(n, 1), sizeof(char));
+    touched = flint_malloc(sizeof(slong) * FLINT_MAX(n, 1));
+
+    active_rows = 0;
+    for (i = 0; i < m; i++)
+    {
+        len = 0;
+        for (k = A->row_starts[i]; k < A->row_starts[i + 1]; k++)
+        {
+            c = A->cols[k];
+
+            if (!mark[c])
+            {
+                mark[c] = 1;
+                touched[len++] = c;
+            }
+
+            acc[c] = nmod_add(acc[c], A->entries[k], A->mod);
+        }
+
+        qsort(touched, len, sizeof(slong), _slong_cmp);
+
+        rows[i].cols = NULL;
+        rows[i].vals = NULL;
+        rows[i].len = rows[i].alloc = 0;
+        _row_fit_length(rows + i, len);
+
+        for (t = 0; t < len; t++)
+        {
+            c = touched[t];
+
+            if (acc[c] != 0)
+            {
+                rows[i].cols[rows[i].len] = c;
+                rows[i].vals[rows[i].len] = acc[c];
+                rows[i].len++;
+
+                if (C.weight[c]++ == 0)
+                    C.active_cols++;
+                _col_add_row(&C, c, i);
+            }
+
+            acc[c] = 0;
+            mark[c] = 0;
+        }
+
+        C.active_nnz += rows[i].len;
+        active_rows += (rows[i].len != 0);
+        pivot_col[i] = -1;
+    }
+
+    _nmod_vec_clear(acc);
+    flint_free(mark);
+    flint_free(touched);
+
+    for (c = 0; c < n; c++)
+        if (C.weight[c] != 0)
+            _heap_push(&C.heap, C.weight[c], c);
+
+    tmp.cols = NULL;
+    tmp.vals = NULL;
+    tmp.len = tmp.alloc = 0;
+
+    rank = 0;
+    while (active_rows != 0 &&
+           4.0 * C.active_nnz <= (double) active_rows * C.active_cols)
+    {
+        /* a column of least weight */
+        do
+        {
+            j = C.heap.c[0];
+            t = C.heap.w[0];
+            _heap_pop(&C.heap);
+        } while (C.weight[j] != t);
+
+        /* the shortest active row containing it */
+        p = -1;
+        for (t = 0; t < C.col_len[j]; t++)
+        {
+            i = C.col_rows[j][t];
+
+            if (pivot_col[i] == -1 && (p == -1 || rows[i].len < rows[p].len)
+                                   && _row_find(rows + i, j) != -1)
+                p = i;
+        }
+
+        k = _row_find(rows + p, j);
+        a = n_invmod(rows[p].vals[k], A->mod.n);
+        _nmod_vec_scalar_mul_nmod(rows[p].vals, rows[p].vals, rows[p].len,
+                                                                  a, A->mod);
+
+        for (t = 0; t < C.col_len[j]; t++)
+        {
+            i = C.col_rows[j][t];
+
+            if (i == p || pivot_col[i] != -1
+                       || (k = _row_find(rows + i, j)) == -1)
+                continue;
+
+            _row_submul(rows, &tmp, i, p, rows[i].vals[k], &C, A->mod);
+            active_rows -= (rows[i].len == 0);
+        }
+
+        /* row p leaves the active part */
+        for (k = 0; k < rows[p].len; k++)
+            _col_dec(&C, rows[p].cols[k]);
+
+        C.active_nnz -= rows[p].len;
+        active_rows--;
+
+        pivot_col[p] = j;
+        order[rank++] = p;
+
+        flint_free(C.col_rows[j]);
+        C.col_rows[j] = NULL;
+        C.col_len[j] = C.col_alloc[j] = 0;
+    }
+
+    /* finish the dense remainder */
+    if (active_rows != 0)
+    {
+        nmod_mat_t D;
+        slong * dense_col, * sparse_col, * dense_row, dr, dc, rk;
+
+        dense_col = flint_malloc(sizeof(slong) * n);
+        sparse_col = flint_malloc(sizeof(slong) * C.active_cols);
+        dense_row = flint_malloc(sizeof(slong) * active_rows);
+
+        dc = 0;
+        for (c = 0; c < n; c++)
+        {
+            if (C.weight[c] != 0)
+            {
+                dense_col[c] = dc;
+                sparse_col[dc++] = c;
+            }
+        }
+
+        nmod_mat_init(D, active_rows, dc, A->mod.n);
+
+        dr = 0;
+        for (i = 0; i < m; i++)
+        {
+            if (pivot_col[i] == -1 && rows[i].len != 0)
+            {
+                for (k = 0; k < rows[i].len; k++)
+                    nmod_mat_entry(D, dr, dense_col[rows[i].cols[k]])
+                                                            = rows[i].vals[k];
+                dense_row[dr++] = i;
+            }
+        }
+
+        rk = nmod_mat_rref(D);
+
+        for (k = 0; k < rk; k++)
+        {
+            i = dense_row[k];
+
+            _row_fit_length(rows + i, dc);
+            rows[i].len = 0;
+            pivot_col[i] = -1;
+
+            for (t = 0; t < dc; t++)
+            {
+                if (nmod_mat_entry(D, k, t) != 0)
+                {
+                    if (pivot_col[i] == -1)
+                        pivot_col[i] = sparse_col[t];
+
+                    rows[i].cols[rows[i].len] = sparse_col[t];
+                    rows[i].vals[rows[i].len] = nmod_mat_entry(D, k, t);
+                    rows[i].len++;
+                }
+            }
+
+            order[rank++] = i;
+        }
+
+        nmod_mat_clear(D);
+        flint_free(dense_col);
+        flint_free(sparse_col);
+        flint_free(dense_row);
+    }
+
+    /* write the pivot rows to E */
+    if (E->entries)
+    {
+        flint_free(E->entries);
+        flint_free(E->cols);
+        E->entries = NULL;
+        E->cols = NULL;
+    }
+
+    nnz = 0;
+    for (k = 0; k < rank; k++)
+        nnz += rows[order[k]].len;
+
+    E->nnz = nnz;
+
+    if (nnz != 0)
+    {
+        E->entries = flint_malloc(sizeof(mp_limb_t) * nnz);
+        E->cols = flint_malloc(sizeof(slong) * nnz);
+    }
+
+    nnz = 0;
+    for (k = 0; k < rank; k++)
+    {
+        i = order[k];
+
+        E->row_starts[k] = nnz;
+        for (t = 0; t < rows[i].len; t++)
+        {
+            E->entries[nnz] = rows[i].vals[t];
+            E->cols[nnz] = rows[i].cols[t];
+            nnz++;
+        }
+
+        pivots[k] = pivot_col[i];
+    }
+
+    for (k = rank; k <= E->r; k++)
+        E->row_starts[k] = nnz;
+
+    for (i = 0; i < m; i++)
+    {
+        flint_free(rows[i].cols);
+        flint_free(rows[i].vals);
+    }
+
+    for (c = 0; c < n; c++)
+        flint_free(C.col_rows[c]);
+
+    flint_free(tmp.cols);
+    flint_free(tmp.vals);
+    flint_free(rows);
+    flint_free(pivot_col);
+    flint_free(order);
+    flint_free(C.weight);
+    flint_free(C.col_rows);
+    flint_free(C.col_len);
+    flint_free(C.col_alloc);
+    flint_free(C.heap.w);
+    flint_free(C.heap.c);
+
+    return rank;
+}
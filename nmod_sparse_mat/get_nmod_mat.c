@@ -0,0 +1,46 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_get_nmod_mat(nmod_mat_t B, const nmod_sparse_mat_t A)
+{
+    slong i, k;
+
+    nmod_mat_zero(B);
+
+    for (i = 0; i < A->r; i++)
+    {
+        for (k = A->row_starts[i]; k < A->row_starts[i + 1]; k++)
+        {
+            mp_limb_t * e = nmod_mat_entry_ptr(B, i, A->cols[k]);
+            *e = nmod_add(*e, A->entries[k], A->mod);
+        }
+    }
+}
@@ -0,0 +1,44 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_init(nmod_sparse_mat_t mat, slong rows, slong cols,
+                                                               mp_limb_t n)
+{
+    mat->entries = NULL;
+    mat->cols = NULL;
+    mat->row_starts = flint_calloc(rows + 1, sizeof(slong));
+
+    mat->r = rows;
+    mat->c = cols;
+    mat->nnz = 0;
+
+    nmod_init(&mat->mod, n);
+}
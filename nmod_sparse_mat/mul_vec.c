@@ -0,0 +1,63 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_sparse_mat.h"
+
+void
+_nmod_sparse_mat_mul_vec(mp_ptr y, const nmod_sparse_mat_t A, mp_srcptr x,
+                                           slong r0, slong r1, int nlimbs)
+{
+    slong i, k, len;
+    mp_srcptr e;
+    const slong * c;
+
+    for (i = r0; i < r1; i++)
+    {
+        e = A->entries + A->row_starts[i];
+        c = A->cols + A->row_starts[i];
+        len = A->row_starts[i + 1] - A->row_starts[i];
+
+        NMOD_VEC_DOT(y[i], k, len, e[k], x[c[k]], A->mod, nlimbs);
+    }
+}
+
+void
+nmod_sparse_mat_mul_vec(mp_ptr y, const nmod_sparse_mat_t A, mp_srcptr x)
+{
+    slong i, len;
+    int nlimbs;
+
+    len = 0;
+    for (i = 0; i < A->r; i++)
+        len = FLINT_MAX(len, A->row_starts[i + 1] - A->row_starts[i]);
+
+    nlimbs = _nmod_vec_dot_bound_limbs(len, A->mod);
+
+    _nmod_sparse_mat_mul_vec(y, A, x, 0, A->r, nlimbs);
+}
@@ -0,0 +1,109 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_sparse_mat.h"
+
+typedef struct
+{
+    mp_ptr y;
+    const nmod_sparse_mat_struct * A;
+    mp_srcptr x;
+    slong r0;
+    slong r1;
+    int nlimbs;
+}
+mul_vec_arg_t;
+
+static void *
+_nmod_sparse_mat_mul_vec_worker(void * arg_ptr)
+{
+    mul_vec_arg_t arg = *((mul_vec_arg_t *) arg_ptr);
+
+    _nmod_sparse_mat_mul_vec(arg.y, arg.A, arg.x, arg.r0, arg.r1, arg.nlimbs);
+
+    flint_cleanup();
+    return NULL;
+}
+
+void
+nmod_sparse_mat_mul_vec_threaded(mp_ptr y, const nmod_sparse_mat_t A,
+                                                               mp_srcptr x)
+{
+    pthread_t * threads;
+    mul_vec_arg_t * args;
+    slong i, j, len, num_threads;
+    int nlimbs;
+
+    num_threads = flint_get_num_threads();
+
+    if (num_threads <= 1 || A->r < num_threads)
+    {
+        nmod_sparse_mat_mul_vec(y, A, x);
+        return;
+    }
+
+    len = 0;
+    for (i = 0; i < A->r; i++)
+        len = FLINT_MAX(len, A->row_starts[i + 1] - A->row_starts[i]);
+
+    nlimbs = _nmod_vec_dot_bound_limbs(len, A->mod);
+
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+    args = flint_malloc(sizeof(mul_vec_arg_t) * num_threads);
+
+    /* give each thread a block of rows with about the same number
+       of nonzero entries */
+    for (i = 0, j = 0; i < num_threads; i++)
+    {
+        args[i].y = y;
+        args[i].A = A;
+        args[i].x = x;
+        args[i].nlimbs = nlimbs;
+        args[i].r0 = j;
+
+        while (j < A->r &&
+               A->row_starts[j] < (A->nnz * (i + 1)) / num_threads)
+            j++;
+
+        if (i == num_threads - 1)
+            j = A->r;
+
+        args[i].r1 = j;
+
+        pthread_create(&threads[i], NULL,
+            _nmod_sparse_mat_mul_vec_worker, &args[i]);
+    }
+
+    for (i = 0; i < num_threads; i++)
+        pthread_join(threads[i], NULL);
+
+    flint_free(threads);
+    flint_free(args);
+}
@@ -0,0 +1,148 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_sparse_mat.h"
+
+slong
+nmod_sparse_mat_nullspace(nmod_sparse_mat_t X, const nmod_sparse_mat_t A)
+{
+    nmod_sparse_mat_t E;
+    slong i, j, k, t, n, rank, nullity, len, nnz, alloc;
+    slong * pivots, * sorted, * row;
+    char * is_pivot;
+    mp_ptr x;
+    mp_limb_t s;
+    int nlimbs;
+
+    n = A->c;
+
+    nmod_sparse_mat_init(E, A->r, n, A->mod.n);
+    pivots = flint_malloc(sizeof(slong) * FLINT_MAX(A->r, 1));
+
+    rank = nmod_sparse_mat_echelon(E, pivots, A);
+    nullity = n - rank;
+
+    is_pivot = flint_calloc(FLINT_MAX(n, 1), sizeof(char));
+    sorted = flint_malloc(sizeof(slong) * FLINT_MAX(n, 1));
+    row = flint_malloc(sizeof(slong) * FLINT_MAX(n, 1));
+    x = _nmod_vec_init(FLINT_MAX(n, 1));
+    _nmod_vec_zero(x, n);
+
+    for (k = 0; k < rank; k++)
+        is_pivot[pivots[k]] = 1;
+
+    /* the pivot columns in increasing order */
+    for (j = 0, k = 0; j < n; j++)
+        if (is_pivot[j])
+            sorted[k++] = j;
+
+    len = 0;
+    for (i = 0; i < E->r; i++)
+        len = FLINT_MAX(len, E->row_starts[i + 1] - E->row_starts[i]);
+
+    nlimbs = _nmod_vec_dot_bound_limbs(len, A->mod);
+
+    if (X->entries)
+    {
+        flint_free(X->entries);
+        flint_free(X->cols);
+        X->entries = NULL;
+        X->cols = NULL;
+    }
+
+    nnz = alloc = 0;
+    X->row_starts[0] = 0;
+
+    /* one basis vector per free column f, with x_f = 1 and the other free
+       entries zero, found by back substitution; row k of E has no entry
+       in the pivot columns of rows before k, and a pivot entry 1 */
+    for (i = 0, j = 0; j < n; j++)
+    {
+        if (is_pivot[j])
+            continue;
+
+        x[j] = 1;
+
+        for (k = rank - 1; k >= 0; k--)
+        {
+            mp_srcptr e = E->entries + E->row_starts[k];
+            const slong * c = E->cols + E->row_starts[k];
+
+            len = E->row_starts[k + 1] - E->row_starts[k];
+            NMOD_VEC_DOT(s, t, len, e[t], x[c[t]], A->mod, nlimbs);
+            x[pivots[k]] = nmod_neg(s, A->mod);
+        }
+
+        /* the nonzero entries are in column j and pivot columns */
+        len = 0;
+        for (t = 0; t < rank && sorted[t] < j; t++)
+            if (x[sorted[t]] != 0)
+                row[len++] = sorted[t];
+
+        row[len++] = j;
+
+        for ( ; t < rank; t++)
+            if (x[sorted[t]] != 0)
+                row[len++] = sorted[t];
+
+        if (nnz + len > alloc)
+        {
+            alloc = FLINT_MAX(nnz + len, 2 * alloc);
+            X->entries = flint_realloc(X->entries, sizeof(mp_limb_t) * alloc);
+            X->cols = flint_realloc(X->cols, sizeof(slong) * alloc);
+        }
+
+        for (t = 0; t < len; t++)
+        {
+            X->entries[nnz] = x[row[t]];
+            X->cols[nnz] = row[t];
+            nnz++;
+        }
+
+        x[j] = 0;
+        for (k = 0; k < rank; k++)
+            x[pivots[k]] = 0;
+
+        X->row_starts[++i] = nnz;
+    }
+
+    for (i = nullity + 1; i <= X->r; i++)
+        X->row_starts[i] = nnz;
+
+    X->nnz = nnz;
+
+    nmod_sparse_mat_clear(E);
+    flint_free(pivots);
+    flint_free(is_pivot);
+    flint_free(sorted);
+    flint_free(row);
+    _nmod_vec_clear(x);
+
+    return nullity;
+}
@@ -0,0 +1,533 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+
+/*
+    Block Wiedemann. For random n x b blocks U and Y, the sequence
+    S_i = U^T A^i (A Y), 0 <= i < L, has a vector generator f of degree
+    about n/b with sum_k S_{i+k} f_k = 0, found as a row [g | h] of a
+    minimal approximant basis of [S^T ; -I] with g = x^d f(1/x). Then
+    v = sum_k A^k Y f_k usually satisfies A v = 0. The b Krylov sequences
+    and the candidate vectors are independent, so each thread takes a
+    share of them and runs its matrix-vector products without
+    synchronisation.
+*/
+
+typedef struct
+{
+    const nmod_sparse_mat_struct * A;
+    mp_srcptr U;
+    mp_srcptr Y;
+    mp_ptr S;
+    slong b;
+    slong L;
+    slong j0;
+    slong j1;
+    int nlimbs;
+}
+krylov_arg_t;
+
+static slong
+_nmod_sparse_mat_nlimbs(const nmod_sparse_mat_t A)
+{
+    slong i, len = 0;
+
+    for (i = 0; i < A->r; i++)
+        len = FLINT_MAX(len, A->row_starts[i + 1] - A->row_starts[i]);
+
+    return _nmod_vec_dot_bound_limbs(len, A->mod);
+}
+
+/* S_i[r][j] = U_r . A^(i+1) Y_j for j0 <= j < j1 */
+static void
+_krylov_range(krylov_arg_t * arg)
+{
+    const nmod_sparse_mat_struct * A = arg->A;
+    slong n = A->r, b = arg->b, i, j, r;
+    int nlimbs = _nmod_vec_dot_bound_limbs(n, A->mod);
+    mp_ptr v, w, t;
+
+    v = _nmod_vec_init(n);
+    w = _nmod_vec_init(n);
+
+    for (j = arg->j0; j < arg->j1; j++)
+    {
+        _nmod_sparse_mat_mul_vec(v, A, arg->Y + j * n, 0, n, arg->nlimbs);
+
+        for (i = 0; i < arg->L; i++)
+        {
+            for (r = 0; r < b; r++)
+                arg->S[(i * b + r) * b + j] =
+                    _nmod_vec_dot(arg->U + r * n, v, n, A->mod, nlimbs);
+
+            _nmod_sparse_mat_mul_vec(w, A, v, 0, n, arg->nlimbs);
+            t = v; v = w; w = t;
+        }
+    }
+
+    _nmod_vec_clear(v);
+    _nmod_vec_clear(w);
+}
+
+static void *
+_krylov_worker(void * arg_ptr)
+{
+    _krylov_range((krylov_arg_t *) arg_ptr);
+    flint_cleanup();
+    return NULL;
+}
+
+typedef struct
+{
+    const nmod_sparse_mat_struct * A;
+    mp_srcptr Y;
+    mp_srcptr f;
+    const slong * deg;
+    mp_ptr v;
+    int * found;
+    slong b;
+    slong len;
+    slong c0;
+    slong c1;
+    int nlimbs;
+}
+candidate_arg_t;
+
+/*
+    For each candidate c in [c0, c1) with generator f of degree deg[c],
+    stored as f[(c * len + k) * b + j], computes v = sum_k A^k Y f_k by
+    Horner's rule, then multiplies by A until A v = 0 or v = 0.
+*/
+static void
+_candidate_range(candidate_arg_t * arg)
+{
+    const nmod_sparse_mat_struct * A = arg->A;
+    slong n = A->r, b = arg->b, c, j, k, d;
+    mp_ptr v, w;
+    mp_srcptr f;
+
+    w = _nmod_vec_init(n);
+
+    for (c = arg->c0; c < arg->c1; c++)
+    {
+        v = arg->v + c * n;
+        f = arg->f + c * arg->len * b;
+        d = arg->deg[c];
+
+        _nmod_vec_zero(v, n);
+
+        for (k = d; k >= 0; k--)
+        {
+            if (k != d)
+            {
+                _nmod_sparse_mat_mul_vec(w, A, v, 0, n, arg->nlimbs);
+                _nmod_vec_set(v, w, n);
+            }
+
+            for (j = 0; j < b; j++)
+                _nmod_vec_scalar_addmul_nmod(v, arg->Y + j * n, n,
+                                                  f[k * b + j], A->mod);
+        }
+
+        arg->found[c] = 0;
+
+        for (k = 0; k <= d && !_nmod_vec_is_zero(v, n); k++)
+        {
+            _nmod_sparse_mat_mul_vec(w, A, v, 0, n, arg->nlimbs);
+
+            if (_nmod_vec_is_zero(w, n))
+            {
+                arg->found[c] = 1;
+                break;
+            }
+
+            _nmod_vec_set(v, w, n);
+        }
+    }
+
+    _nmod_vec_clear(w);
+}
+
+static void *
+_candidate_worker(void * arg_ptr)
+{
+    _candidate_range((candidate_arg_t *) arg_ptr);
+    flint_cleanup();
+    return NULL;
+}
+
+/*
+    Minimal approximant basis P of F = [S^T ; -I] to order L, by the
+    iterative algorithm of Giorgi, Jeannerod and Villard: at step k the
+    coefficients of x^k of the residuals P F are reduced in order of
+    increasing shifted degree, and the rows still nonzero at x^k are
+    multiplied by x. Only the g part of P is stored, as
+    P[((i * b) + j) * len + t] with m = 2b rows and len = L + 2
+    coefficients, since h = S g mod x^deg is not needed; deg[i] is the
+    shifted degree of row i, initially 0 for the rows starting with g
+    and 1 for those starting with h.
+*/
+static void
+_approximant_basis(mp_ptr P, slong * deg, mp_srcptr S, slong b, slong L,
+                                                                nmod_t mod)
+{
+    slong m = 2 * b, len = L + 2, i, j, k, t, q, npiv;
+    slong * order, * piv_row, * piv_col;
+    mp_ptr R;
+    mp_limb_t a;
+
+    /* residuals R[((i * b) + j) * L + t] */
+    R = _nmod_vec_init(m * b * L);
+    _nmod_vec_zero(R, m * b * L);
+    _nmod_vec_zero(P, m * b * len);
+
+    for (i = 0; i < b; i++)
+    {
+        for (j = 0; j < b; j++)
+            for (t = 0; t < L; t++)
+                R[((i * b) + j) * L + t] = S[(t * b + j) * b + i];
+
+        R[(((b + i) * b) + i) * L] = nmod_neg(1, mod);
+        deg[i] = 0;
+        deg[b + i] = 1;
+    }
+
+    for (i = 0; i < b; i++)
+        P[((i * b) + i) * len] = 1;
+
+    order = flint_malloc(sizeof(slong) * m);
+    piv_row = flint_malloc(sizeof(slong) * m);
+    piv_col = flint_malloc(sizeof(slong) * m);
+
+    for (k = 0; k < L; k++)
+    {
+        /* rows by increasing shifted degree, stable */
+        for (i = 0; i < m; i++)
+        {
+            for (q = i; q > 0 && deg[order[q - 1]] > deg[i]; q--)
+                order[q] = order[q - 1];
+            order[q] = i;
+        }
+
+        npiv = 0;
+        for (q = 0; q < m; q++)
+        {
+            i = order[q];
+
+            for (t = 0; t < npiv; t++)
+            {
+                slong p = piv_row[t], c = piv_col[t];
+
+                a = R[((i * b) + c) * L + k];
+                if (a == 0)
+                    continue;
+
+                a = nmod_mul(a, n_invmod(R[((p * b) + c) * L + k], mod.n),
+                                                                         mod);
+                a = nmod_neg(a, mod);
+
+                for (j = 0; j < b; j++)
+                    _nmod_vec_scalar_addmul_nmod(R + ((i * b) + j) * L + k,
+                        R + ((p * b) + j) * L + k, L - k, a, mod);
+
+                for (j = 0; j < b; j++)
+                    _nmod_vec_scalar_addmul_nmod(P + ((i * b) + j) * len,
+                        P + ((p * b) + j) * len, deg[p] + 1, a, mod);
+            }
+
+            for (j = 0; j < b && R[((i * b) + j) * L + k] == 0; j++) ;
+
+            if (j < b)
+            {
+                piv_row[npiv] = i;
+                piv_col[npiv] = j;
+                npiv++;
+            }
+        }
+
+        /* multiply the pivot rows by x */
+        for (t = 0; t < npiv; t++)
+        {
+            i = piv_row[t];
+
+            for (j = 0; j < b; j++)
+            {
+                mp_ptr r = R + ((i * b) + j) * L;
+                for (q = L - 1; q > k; q--)
+                    r[q] = r[q - 1];
+                r[k] = 0;
+            }
+
+            for (j = 0; j < b; j++)
+            {
+                mp_ptr p = P + ((i * b) + j) * len;
+                for (q = deg[i] + 1; q > 0; q--)
+                    p[q] = p[q - 1];
+                p[0] = 0;
+            }
+
+            deg[i]++;
+        }
+    }
+
+    _nmod_vec_clear(R);
+    flint_free(order);
+    flint_free(piv_row);
+    flint_free(piv_col);
+}
+
+slong
+nmod_sparse_mat_nullspace_block_wiedemann(nmod_sparse_mat_t X,
+                                     const nmod_sparse_mat_t A, slong b)
+{
+    slong n, m, i, j, k, t, L, len, num, nnz, rank, num_threads;
+    mp_ptr U, Y, S, P, f, V;
+    slong * deg, * cand_deg, * order;
+    int * found;
+    nmod_mat_t K;
+    flint_rand_t state;
+    pthread_t * threads;
+    int nlimbs;
+
+    n = A->r;
+
+    if (n != A->c)
+    {
+        flint_printf("Exception (nmod_sparse_mat_nullspace_block_wiedemann). "
+                     "Non-square matrix.\n");
+        abort();
+    }
+
+    if (X->entries)
+    {
+        flint_free(X->entries);
+        flint_free(X->cols);
+        X->entries = NULL;
+        X->cols = NULL;
+    }
+
+    for (i = 0; i <= X->r; i++)
+        X->row_starts[i] = 0;
+    X->nnz = 0;
+
+    if (n == 0)
+        return 0;
+
+    b = FLINT_MAX(b, 1);
+    m = 2 * b;
+    L = 2 * ((n + b - 1) / b) + 6;
+    len = L + 2;
+
+    nlimbs = _nmod_sparse_mat_nlimbs(A);
+    num_threads = FLINT_MAX(1, FLINT_MIN(flint_get_num_threads(), b));
+    threads = flint_malloc(sizeof(pthread_t) * num_threads);
+
+    U = _nmod_vec_init(b * n);
+    Y = _nmod_vec_init(b * n);
+    S = _nmod_vec_init(L * b * b);
+
+    flint_randinit(state);
+    for (i = 0; i < b * n; i++)
+    {
+        U[i] = n_randint(state, A->mod.n);
+        Y[i] = n_randint(state, A->mod.n);
+    }
+    flint_randclear(state);
+
+    /* the Krylov sequences, a share of the columns of Y per thread */
+    {
+        krylov_arg_t * args = flint_malloc(sizeof(krylov_arg_t) * num_threads);
+
+        for (i = 0; i < num_threads; i++)
+        {
+            args[i].A = A;
+            args[i].U = U;
+            args[i].Y = Y;
+            args[i].S = S;
+            args[i].b = b;
+            args[i].L = L;
+            args[i].j0 = (i * b) / num_threads;
+            args[i].j1 = ((i + 1) * b) / num_threads;
+            args[i].nlimbs = nlimbs;
+        }
+
+        for (i = 1; i < num_threads; i++)
+            pthread_create(&threads[i], NULL, _krylov_worker, &args[i]);
+
+        _krylov_range(&args[0]);
+
+        for (i = 1; i < num_threads; i++)
+            pthread_join(threads[i], NULL);
+
+        flint_free(args);
+    }
+
+    P = _nmod_vec_init(m * b * len);
+    deg = flint_malloc(sizeof(slong) * m);
+
+    _approximant_basis(P, deg, S, b, L, A->mod);
+
+    /* the b rows of least degree with g != 0 whose recurrence holds for
+       at least n/b terms give the candidates, f_k = g_{d-k} */
+    f = _nmod_vec_init(b * len * b);
+    cand_deg = flint_malloc(sizeof(slong) * m);
+    order = flint_malloc(sizeof(slong) * m);
+
+    for (i = 0; i < m; i++)
+    {
+        for (t = i; t > 0 && deg[order[t - 1]] > deg[i]; t--)
+            order[t] = order[t - 1];
+        order[t] = i;
+    }
+
+    num = 0;
+    for (t = 0; t < m && num < b; t++)
+    {
+        slong d;
+        mp_ptr fc = f + num * len * b;
+        int nonzero = 0;
+
+        i = order[t];
+        d = deg[i];
+
+        if (L - d < (n + b - 1) / b)
+            break;
+
+        for (k = 0; k <= d; k++)
+        {
+            for (j = 0; j < b; j++)
+            {
+                fc[k * b + j] = P[((i * b) + j) * len + d - k];
+                nonzero |= (fc[k * b + j] != 0);
+            }
+        }
+
+        if (nonzero)
+            cand_deg[num++] = d;
+    }
+
+    V = _nmod_vec_init(FLINT_MAX(num, 1) * n);
+    found = flint_malloc(sizeof(int) * FLINT_MAX(num, 1));
+
+    if (num != 0)
+    {
+        slong nt = FLINT_MIN(num_threads, num);
+        candidate_arg_t * args = flint_malloc(sizeof(candidate_arg_t) * nt);
+
+        for (i = 0; i < nt; i++)
+        {
+            args[i].A = A;
+            args[i].Y = Y;
+            args[i].f = f;
+            args[i].deg = cand_deg;
+            args[i].v = V;
+            args[i].found = found;
+            args[i].b = b;
+            args[i].len = len;
+            args[i].c0 = (i * num) / nt;
+            args[i].c1 = ((i + 1) * num) / nt;
+            args[i].nlimbs = nlimbs;
+        }
+
+        for (i = 1; i < nt; i++)
+            pthread_create(&threads[i], NULL, _candidate_worker, &args[i]);
+
+        _candidate_range(&args[0]);
+
+        for (i = 1; i < nt; i++)
+            pthread_join(threads[i], NULL);
+
+        flint_free(args);
+    }
+
+    /* a basis of the span of the vectors found */
+    for (i = 0, t = 0; i < num; i++)
+        t += found[i];
+
+    nmod_mat_init(K, t, n, A->mod.n);
+
+    for (i = 0, t = 0; i < num; i++)
+        if (found[i])
+            _nmod_vec_set(K->rows[t++], V + i * n, n);
+
+    rank = nmod_mat_rref(K);
+    rank = FLINT_MIN(rank, X->r);
+
+    nnz = 0;
+    for (i = 0; i < rank; i++)
+        for (j = 0; j < n; j++)
+            nnz += (nmod_mat_entry(K, i, j) != 0);
+
+    if (nnz != 0)
+    {
+        X->entries = flint_malloc(sizeof(mp_limb_t) * nnz);
+        X->cols = flint_malloc(sizeof(slong) * nnz);
+    }
+
+    nnz = 0;
+    for (i = 0; i < rank; i++)
+    {
+        X->row_starts[i] = nnz;
+
+        for (j = 0; j < n; j++)
+        {
+            if (nmod_mat_entry(K, i, j) != 0)
+            {
+                X->entries[nnz] = nmod_mat_entry(K, i, j);
+                X->cols[nnz] = j;
+                nnz++;
+            }
+        }
+    }
+
+    for (i = rank; i <= X->r; i++)
+        X->row_starts[i] = nnz;
+
+    X->nnz = nnz;
+
+    nmod_mat_clear(K);
+    _nmod_vec_clear(U);
+    _nmod_vec_clear(Y);
+    _nmod_vec_clear(S);
+    _nmod_vec_clear(P);
+    _nmod_vec_clear(f);
+    _nmod_vec_clear(V);
+    flint_free(deg);
+    flint_free(cand_deg);
+    flint_free(order);
+    flint_free(found);
+    flint_free(threads);
+
+    return rank;
+}
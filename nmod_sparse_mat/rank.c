@@ -0,0 +1,47 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+slong
+nmod_sparse_mat_rank(const nmod_sparse_mat_t A)
+{
+    nmod_sparse_mat_t E;
+    slong * pivots;
+    slong rank;
+
+    nmod_sparse_mat_init(E, A->r, A->c, A->mod.n);
+    pivots = flint_malloc(sizeof(slong) * FLINT_MAX(A->r, 1));
+
+    rank = nmod_sparse_mat_echelon(E, pivots, A);
+
+    nmod_sparse_mat_clear(E);
+    flint_free(pivots);
+
+    return rank;
+}
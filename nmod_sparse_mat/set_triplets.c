@@ -0,0 +1,87 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_set_triplets(nmod_sparse_mat_t mat, const slong * rows,
+                           const slong * cols, mp_srcptr vals, slong len)
+{
+    slong i, k, nnz;
+    slong * pos;
+
+    if (mat->entries)
+    {
+        flint_free(mat->entries);
+        flint_free(mat->cols);
+        mat->entries = NULL;
+        mat->cols = NULL;
+    }
+
+    for (i = 0; i <= mat->r; i++)
+        mat->row_starts[i] = 0;
+
+    /* count the nonzero entries of each row */
+    nnz = 0;
+    for (k = 0; k < len; k++)
+    {
+        if (vals[k] != 0)
+        {
+            mat->row_starts[rows[k] + 1]++;
+            nnz++;
+        }
+    }
+
+    for (i = 0; i < mat->r; i++)
+        mat->row_starts[i + 1] += mat->row_starts[i];
+
+    mat->nnz = nnz;
+
+    if (nnz == 0)
+        return;
+
+    mat->entries = flint_malloc(sizeof(mp_limb_t) * nnz);
+    mat->cols = flint_malloc(sizeof(slong) * nnz);
+
+    /* counting sort by row, keeping the input order within each row */
+    pos = flint_malloc(sizeof(slong) * FLINT_MAX(mat->r, 1));
+    for (i = 0; i < mat->r; i++)
+        pos[i] = mat->row_starts[i];
+
+    for (k = 0; k < len; k++)
+    {
+        if (vals[k] != 0)
+        {
+            i = pos[rows[k]]++;
+            mat->entries[i] = vals[k];
+            mat->cols[i] = cols[k];
+        }
+    }
+
+    flint_free(pos);
+}
@@ -0,0 +1,192 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_sparse_mat.h"
+
+#define WIEDEMANN_MAX_ATTEMPTS 8
+
+/*
+    Berlekamp-Massey: sets C to the connection polynomial of the
+    sequence s of length len, returning its degree L. We have
+    C[0] = 1 and s[i] + C[1] s[i-1] + ... + C[L] s[i-L] = 0 for all
+    L <= i < len. The arrays C and B need space for len + 1 entries.
+*/
+static slong
+_berlekamp_massey(mp_ptr C, mp_ptr B, mp_ptr T, mp_srcptr s, slong len,
+                                                                  nmod_t mod)
+{
+    slong n, i, L, m, Blen, Clen;
+    mp_limb_t d, bb, c;
+
+    _nmod_vec_zero(C, len + 1);
+    _nmod_vec_zero(B, len + 1);
+    C[0] = B[0] = 1;
+    Clen = Blen = 1;
+    L = 0;
+    m = 1;
+    bb = 1;
+
+    for (n = 0; n < len; n++)
+    {
+        d = s[n];
+        for (i = 1; i <= L; i++)
+            d = nmod_add(d, nmod_mul(C[i], s[n - i], mod), mod);
+
+        if (d == 0)
+        {
+            m++;
+            continue;
+        }
+
+        c = nmod_mul(d, n_invmod(bb, mod.n), mod);
+
+        if (2 * L <= n)
+        {
+            _nmod_vec_set(T, C, Clen);
+            _nmod_vec_scalar_addmul_nmod(C + m, B, Blen,
+                                                   nmod_neg(c, mod), mod);
+            Clen = FLINT_MAX(Clen, Blen + m);
+            _nmod_vec_set(B, T, L + 1);
+            Blen = L + 1;
+            L = n + 1 - L;
+            bb = d;
+            m = 1;
+        }
+        else
+        {
+            _nmod_vec_scalar_addmul_nmod(C + m, B, Blen,
+                                                   nmod_neg(c, mod), mod);
+            Clen = FLINT_MAX(Clen, Blen + m);
+            m++;
+        }
+    }
+
+    return L;
+}
+
+int
+nmod_sparse_mat_solve_wiedemann(mp_ptr x, const nmod_sparse_mat_t A,
+                                                               mp_srcptr b)
+{
+    slong i, k, n, L, attempt;
+    mp_ptr s, u, v, w, C, B, T;
+    mp_limb_t c;
+    flint_rand_t state;
+    int nlimbs, result = 0;
+
+    n = A->r;
+
+    if (n != A->c)
+    {
+        flint_printf("Exception (nmod_sparse_mat_solve_wiedemann). "
+                     "Non-square matrix.\n");
+        abort();
+    }
+
+    if (n == 0)
+        return 1;
+
+    if (_nmod_vec_is_zero(b, n))
+    {
+        _nmod_vec_zero(x, n);
+        return 1;
+    }
+
+    s = _nmod_vec_init(2 * n);
+    u = _nmod_vec_init(n);
+    v = _nmod_vec_init(n);
+    w = _nmod_vec_init(n);
+    C = _nmod_vec_init(2 * n + 1);
+    B = _nmod_vec_init(2 * n + 1);
+    T = _nmod_vec_init(2 * n + 1);
+
+    nlimbs = _nmod_vec_dot_bound_limbs(n, A->mod);
+
+    flint_randinit(state);
+
+    for (attempt = 0; attempt < WIEDEMANN_MAX_ATTEMPTS && !result; attempt++)
+    {
+        /* the projected Krylov sequence s_i = u^T A^i b */
+        for (i = 0; i < n; i++)
+            u[i] = n_randint(state, A->mod.n);
+
+        _nmod_vec_set(v, b, n);
+        for (i = 0; i < 2 * n; i++)
+        {
+            s[i] = _nmod_vec_dot(u, v, n, A->mod, nlimbs);
+            nmod_sparse_mat_mul_vec(w, A, v);
+            _nmod_vec_set(v, w, n);
+        }
+
+        L = _berlekamp_massey(C, B, T, s, 2 * n, A->mod);
+
+        /* u is orthogonal to the Krylov space of b, try another one */
+        if (L == 0)
+            continue;
+
+        /* the minimal polynomial is f(z) = z^L C(1/z), i.e. f_k = C[L-k];
+           it divides the minimal polynomial of A, so if f_0 = 0 then A is
+           singular and no further projection can help */
+        if (C[L] == 0)
+            break;
+
+        /* f(A) b = 0 with f_0 != 0, so the solution is
+           x = -f_0^{-1} (f_1 b + f_2 A b + ... + f_L A^{L-1} b) */
+
+        _nmod_vec_scalar_mul_nmod(x, b, n, C[0], A->mod);
+        for (k = L - 1; k >= 1; k--)
+        {
+            nmod_sparse_mat_mul_vec(w, A, x);
+            _nmod_vec_scalar_addmul_nmod(w, b, n, C[L - k], A->mod);
+            _nmod_vec_set(x, w, n);
+        }
+
+        c = nmod_neg(n_invmod(C[L], A->mod.n), A->mod);
+        _nmod_vec_scalar_mul_nmod(x, x, n, c, A->mod);
+
+        /* the sequence may only have seen a factor of the minimal
+           polynomial of b, so check the solution */
+        nmod_sparse_mat_mul_vec(w, A, x);
+        result = _nmod_vec_equal(w, b, n);
+    }
+
+    flint_randclear(state);
+
+    _nmod_vec_clear(s);
+    _nmod_vec_clear(u);
+    _nmod_vec_clear(v);
+    _nmod_vec_clear(w);
+    _nmod_vec_clear(C);
+    _nmod_vec_clear(B);
+    _nmod_vec_clear(T);
+
+    return result;
+}
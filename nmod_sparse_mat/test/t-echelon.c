@@ -0,0 +1,162 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("echelon....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_sparse_mat_t A, E;
+        nmod_mat_t B, D, BD;
+        mp_limb_t mod;
+        slong m, n, j, k, t, len, rank, rank2, * pivots;
+
+        m = n_randint(state, 50);
+        n = n_randint(state, 50);
+        mod = n_randtest_prime(state, 0);
+
+        nmod_sparse_mat_init(A, m, n, mod);
+        nmod_sparse_mat_init(E, m, n, mod);
+        nmod_mat_init(B, m, n, mod);
+        nmod_mat_init(D, m, n, mod);
+        nmod_mat_init(BD, 2 * m, n, mod);
+        pivots = flint_malloc(sizeof(slong) * (m + 1));
+
+        /* from very sparse to dense, so both phases are used */
+        if (m != 0 && n != 0)
+        {
+            len = n_randint(state, 4) ? n_randint(state, 3 * (m + n))
+                                      : n_randint(state, m * n + 1);
+
+            for (j = 0; j < len; j++)
+                nmod_mat_entry(B, n_randint(state, m), n_randint(state, n))
+                                                    = n_randint(state, mod);
+        }
+
+        nmod_sparse_mat_set_nmod_mat(A, B);
+
+        if (n_randint(state, 2))
+        {
+            rank = nmod_sparse_mat_echelon(E, pivots, A);
+        }
+        else
+        {
+            nmod_sparse_mat_set_nmod_mat(E, B);
+            rank = nmod_sparse_mat_echelon(E, pivots, E);
+        }
+
+        nmod_sparse_mat_get_nmod_mat(D, E);
+
+        if (rank != nmod_mat_rank(B))
+        {
+            flint_printf("FAIL: wrong rank\n");
+            nmod_mat_print_pretty(B);
+            abort();
+        }
+
+        for (k = 0; k < m; k++)
+        {
+            for (t = E->row_starts[k] + 1; t < E->row_starts[k + 1]; t++)
+            {
+                if (E->cols[t - 1] >= E->cols[t])
+                {
+                    flint_printf("FAIL: row not sorted\n");
+                    abort();
+                }
+            }
+
+            if (k >= rank)
+            {
+                if (E->row_starts[k + 1] != E->row_starts[k])
+                {
+                    flint_printf("FAIL: nonzero row past the rank\n");
+                    abort();
+                }
+
+                continue;
+            }
+
+            if (nmod_mat_entry(D, k, pivots[k]) != 1)
+            {
+                flint_printf("FAIL: pivot entry\n");
+                abort();
+            }
+
+            for (j = 0; j < k; j++)
+            {
+                if (nmod_mat_entry(D, k, pivots[j]) != 0)
+                {
+                    flint_printf("FAIL: entry in an earlier pivot column\n");
+                    abort();
+                }
+            }
+        }
+
+        /* same row space */
+        for (j = 0; j < m; j++)
+        {
+            for (k = 0; k < n; k++)
+            {
+                nmod_mat_entry(BD, j, k) = nmod_mat_entry(B, j, k);
+                nmod_mat_entry(BD, m + j, k) = nmod_mat_entry(D, j, k);
+            }
+        }
+
+        rank2 = nmod_mat_rank(BD);
+
+        if (rank2 != rank)
+        {
+            flint_printf("FAIL: row spaces differ\n");
+            nmod_mat_print_pretty(B);
+            nmod_mat_print_pretty(D);
+            abort();
+        }
+
+        nmod_sparse_mat_clear(A);
+        nmod_sparse_mat_clear(E);
+        nmod_mat_clear(B);
+        nmod_mat_clear(D);
+        nmod_mat_clear(BD);
+        flint_free(pivots);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
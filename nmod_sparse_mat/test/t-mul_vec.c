@@ -0,0 +1,100 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_vec....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_sparse_mat_t A;
+        nmod_mat_t B, X, Y;
+        mp_ptr x, y, z;
+        mp_limb_t mod;
+        slong m, n, j;
+
+        m = n_randint(state, 50);
+        n = n_randint(state, 50);
+        mod = n_randtest_not_zero(state);
+
+        nmod_sparse_mat_init(A, m, n, mod);
+        nmod_mat_init(B, m, n, mod);
+        nmod_mat_init(X, n, 1, mod);
+        nmod_mat_init(Y, m, 1, mod);
+        x = _nmod_vec_init(n);
+        y = _nmod_vec_init(m);
+        z = _nmod_vec_init(m);
+
+        nmod_mat_randtest(B, state);
+        nmod_mat_randtest(X, state);
+        for (j = 0; j < n; j++)
+            x[j] = nmod_mat_entry(X, j, 0);
+
+        nmod_sparse_mat_set_nmod_mat(A, B);
+
+        nmod_mat_mul(Y, B, X);
+        nmod_sparse_mat_mul_vec(y, A, x);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+        nmod_sparse_mat_mul_vec_threaded(z, A, x);
+        flint_set_num_threads(1);
+
+        for (j = 0; j < m; j++)
+        {
+            if (y[j] != nmod_mat_entry(Y, j, 0) || z[j] != y[j])
+            {
+                flint_printf("FAIL: results not equal\n");
+                nmod_mat_print_pretty(B);
+                nmod_mat_print_pretty(X);
+                abort();
+            }
+        }
+
+        nmod_sparse_mat_clear(A);
+        nmod_mat_clear(B);
+        nmod_mat_clear(X);
+        nmod_mat_clear(Y);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(y);
+        _nmod_vec_clear(z);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
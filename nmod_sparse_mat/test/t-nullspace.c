@@ -0,0 +1,107 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("nullspace....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_sparse_mat_t A, X;
+        nmod_mat_t B, Y, AY;
+        mp_limb_t mod;
+        slong m, n, r, j, nullity;
+
+        m = n_randint(state, 50);
+        n = n_randint(state, 50);
+        r = n_randint(state, FLINT_MIN(m, n) + 1);
+        mod = n_randtest_prime(state, 0);
+
+        nmod_sparse_mat_init(A, m, n, mod);
+        nmod_sparse_mat_init(X, n, n, mod);
+        nmod_mat_init(B, m, n, mod);
+        nmod_mat_init(Y, n, n, mod);
+        nmod_mat_init(AY, m, n, mod);
+
+        nmod_mat_randrank(B, state, r);
+        for (j = 0; j < n_randint(state, 3); j++)
+            nmod_mat_randops(B, n_randint(state, 2 * (m + n) + 1), state);
+
+        nmod_sparse_mat_set_nmod_mat(A, B);
+
+        nullity = nmod_sparse_mat_nullspace(X, A);
+        nmod_sparse_mat_get_nmod_mat(Y, X);
+
+        if (nullity + r != n)
+        {
+            flint_printf("FAIL: wrong nullity\n");
+            nmod_mat_print_pretty(B);
+            abort();
+        }
+
+        if (nmod_mat_rank(Y) != nullity)
+        {
+            flint_printf("FAIL: basis not independent\n");
+            nmod_mat_print_pretty(B);
+            nmod_mat_print_pretty(Y);
+            abort();
+        }
+
+        /* the rows of Y are in the nullspace */
+        nmod_mat_transpose(Y, Y);
+        nmod_mat_mul(AY, B, Y);
+
+        if (!nmod_mat_is_zero(AY))
+        {
+            flint_printf("FAIL: not a nullspace\n");
+            nmod_mat_print_pretty(B);
+            nmod_mat_print_pretty(Y);
+            abort();
+        }
+
+        nmod_sparse_mat_clear(A);
+        nmod_sparse_mat_clear(X);
+        nmod_mat_clear(B);
+        nmod_mat_clear(Y);
+        nmod_mat_clear(AY);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
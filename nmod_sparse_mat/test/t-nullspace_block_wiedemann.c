@@ -0,0 +1,130 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("nullspace_block_wiedemann....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_sparse_mat_t A, X;
+        nmod_mat_t B, Y, Yt, AY;
+        mp_limb_t mod;
+        slong n, r, b, j, k, num;
+
+        n = n_randint(state, 60);
+        r = n_randint(state, n + 1);
+        b = 1 + n_randint(state, 6);
+        mod = n_randtest_prime(state, 0);
+
+        nmod_sparse_mat_init(A, n, n, mod);
+        nmod_sparse_mat_init(X, b, n, mod);
+        nmod_mat_init(B, n, n, mod);
+        nmod_mat_init(Y, b, n, mod);
+        nmod_mat_init(Yt, n, b, mod);
+        nmod_mat_init(AY, n, b, mod);
+
+        /* a sparse matrix whose last n - r columns are combinations of
+           two of the others */
+        for (j = 0; j < r; j++)
+        {
+            nmod_mat_entry(B, j, j) = 1 + n_randint(state, mod - 1);
+            for (k = 0; k < 2; k++)
+                nmod_mat_entry(B, n_randint(state, n), j) =
+                                                    n_randint(state, mod);
+        }
+
+        for (j = r; j < n && r != 0; j++)
+        {
+            slong c1 = n_randint(state, r), c2 = n_randint(state, r);
+            mp_limb_t a1 = n_randint(state, mod), a2 = n_randint(state, mod);
+
+            for (k = 0; k < n; k++)
+                nmod_mat_entry(B, k, j) = nmod_add(
+                    nmod_mul(a1, nmod_mat_entry(B, k, c1), B->mod),
+                    nmod_mul(a2, nmod_mat_entry(B, k, c2), B->mod), B->mod);
+        }
+
+        nmod_sparse_mat_set_nmod_mat(A, B);
+
+        flint_set_num_threads(1 + n_randint(state, 4));
+        num = nmod_sparse_mat_nullspace_block_wiedemann(X, A, b);
+        flint_set_num_threads(1);
+
+        nmod_sparse_mat_get_nmod_mat(Y, X);
+
+        if (num > FLINT_MIN(b, n - nmod_mat_rank(B))
+                || nmod_mat_rank(Y) != num)
+        {
+            flint_printf("FAIL: wrong number of vectors\n");
+            nmod_mat_print_pretty(B);
+            nmod_mat_print_pretty(Y);
+            abort();
+        }
+
+        nmod_mat_transpose(Yt, Y);
+        nmod_mat_mul(AY, B, Yt);
+
+        if (!nmod_mat_is_zero(AY))
+        {
+            flint_printf("FAIL: not in the nullspace\n");
+            nmod_mat_print_pretty(B);
+            nmod_mat_print_pretty(Y);
+            abort();
+        }
+
+        /* over a large field, a singular matrix has a nonzero vector */
+        if (num == 0 && nmod_mat_rank(B) < n && mod > 1000000)
+        {
+            flint_printf("FAIL: no vector found\n");
+            nmod_mat_print_pretty(B);
+            abort();
+        }
+
+        nmod_sparse_mat_clear(A);
+        nmod_sparse_mat_clear(X);
+        nmod_mat_clear(B);
+        nmod_mat_clear(Y);
+        nmod_mat_clear(Yt);
+        nmod_mat_clear(AY);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
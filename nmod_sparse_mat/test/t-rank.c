@@ -0,0 +1,79 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("rank....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_sparse_mat_t A;
+        nmod_mat_t B;
+        mp_limb_t mod;
+        slong m, n, r, j;
+
+        m = n_randint(state, 60);
+        n = n_randint(state, 60);
+        r = n_randint(state, FLINT_MIN(m, n) + 1);
+        mod = n_randtest_prime(state, 0);
+
+        nmod_sparse_mat_init(A, m, n, mod);
+        nmod_mat_init(B, m, n, mod);
+
+        /* a matrix of rank r with few entries per row */
+        nmod_mat_randrank(B, state, r);
+        for (j = 0; j < n_randint(state, 3); j++)
+            nmod_mat_randops(B, n_randint(state, 2 * (m + n) + 1), state);
+
+        nmod_sparse_mat_set_nmod_mat(A, B);
+
+        if (nmod_sparse_mat_rank(A) != r)
+        {
+            flint_printf("FAIL: wrong rank\n");
+            nmod_mat_print_pretty(B);
+            abort();
+        }
+
+        nmod_sparse_mat_clear(A);
+        nmod_mat_clear(B);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
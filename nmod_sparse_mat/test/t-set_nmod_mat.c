@@ -0,0 +1,93 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("set_nmod_mat....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_sparse_mat_t A;
+        nmod_mat_t B, C;
+        mp_limb_t mod;
+        slong m, n;
+
+        m = n_randint(state, 50);
+        n = n_randint(state, 50);
+        mod = n_randtest_not_zero(state);
+
+        nmod_sparse_mat_init(A, m, n, mod);
+        nmod_mat_init(B, m, n, mod);
+        nmod_mat_init(C, m, n, mod);
+
+        nmod_mat_randtest(B, state);
+        nmod_mat_randtest(C, state);
+
+        nmod_sparse_mat_set_nmod_mat(A, B);
+        nmod_sparse_mat_get_nmod_mat(C, A);
+
+        if (!nmod_mat_equal(B, C))
+        {
+            flint_printf("FAIL: results not equal\n");
+            nmod_mat_print_pretty(B);
+            nmod_mat_print_pretty(C);
+            abort();
+        }
+
+        /* converting twice must not leak */
+        nmod_mat_randtest(B, state);
+        nmod_sparse_mat_set_nmod_mat(A, B);
+        nmod_sparse_mat_get_nmod_mat(C, A);
+
+        if (!nmod_mat_equal(B, C))
+        {
+            flint_printf("FAIL: results not equal (second conversion)\n");
+            nmod_mat_print_pretty(B);
+            nmod_mat_print_pretty(C);
+            abort();
+        }
+
+        nmod_sparse_mat_clear(A);
+        nmod_mat_clear(B);
+        nmod_mat_clear(C);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
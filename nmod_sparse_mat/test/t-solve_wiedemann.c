@@ -0,0 +1,106 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("solve_wiedemann....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_sparse_mat_t A;
+        nmod_mat_t B;
+        mp_ptr x, b, c;
+        mp_limb_t mod;
+        slong n, j, k, rank;
+        int result;
+
+        n = n_randint(state, 40);
+        mod = n_randtest_prime(state, 0);
+
+        nmod_sparse_mat_init(A, n, n, mod);
+        nmod_mat_init(B, n, n, mod);
+        x = _nmod_vec_init(n);
+        b = _nmod_vec_init(n);
+        c = _nmod_vec_init(n);
+
+        /* a sparse matrix with nonzero diagonal and a few other entries */
+        for (j = 0; j < n; j++)
+        {
+            nmod_mat_entry(B, j, j) = 1 + n_randint(state, mod - 1);
+            for (k = 0; k < 3; k++)
+                nmod_mat_entry(B, j, n_randint(state, n)) =
+                                                    n_randint(state, mod);
+        }
+
+        rank = nmod_mat_rank(B);
+        nmod_sparse_mat_set_nmod_mat(A, B);
+
+        for (j = 0; j < n; j++)
+            b[j] = n_randint(state, mod);
+
+        result = nmod_sparse_mat_solve_wiedemann(x, A, b);
+
+        if (result)
+        {
+            nmod_sparse_mat_mul_vec(c, A, x);
+
+            if (!_nmod_vec_equal(b, c, n))
+            {
+                flint_printf("FAIL: Ax != b\n");
+                nmod_mat_print_pretty(B);
+                abort();
+            }
+        }
+        else if (rank == n && mod > 1000)
+        {
+            flint_printf("FAIL: nonsingular system not solved\n");
+            nmod_mat_print_pretty(B);
+            abort();
+        }
+
+        nmod_sparse_mat_clear(A);
+        nmod_mat_clear(B);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(b);
+        _nmod_vec_clear(c);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -102,6 +102,12 @@ typedef struct {
     slong min;
     slong max;
 
+    /* powers outside [min, max), computed on demand; sorted by exponent */
+    slong *ext_exp;
+    fmpz *ext_pow;
+    slong ext_num;
+    slong ext_alloc;
+
     enum padic_print_mode mode;
 
 } padic_ctx_struct;
@@ -122,6 +128,11 @@ FLINT_DLL void padic_ctx_init(padic_ctx_t ctx, const fmpz_t p, slong min, slong
 
 FLINT_DLL void padic_ctx_clear(padic_ctx_t ctx);
 
+#define PADIC_CTX_POW_CACHE_MAX 256
+
+FLINT_DLL int _padic_ctx_pow_cached(fmpz_t rop, const padic_ctx_struct * ctx,
+                                    slong e);
+
 PADIC_INLINE 
 int _padic_ctx_pow_ui(fmpz_t rop, ulong e, const padic_ctx_t ctx)
 {
@@ -142,7 +153,8 @@ int _padic_ctx_pow_ui(fmpz_t rop, ulong e, const padic_ctx_t ctx)
         }
 
         fmpz_init(rop);
-        fmpz_pow_ui(rop, ctx->p, e);
+        if (!_padic_ctx_pow_cached(rop, ctx, l))
+            fmpz_pow_ui(rop, ctx->p, e);
         return 1;
     }
 }
@@ -163,7 +175,8 @@ void padic_ctx_pow_ui(fmpz_t rop, ulong e, const padic_ctx_t ctx)
             abort();
         }
 
-        fmpz_pow_ui(rop, ctx->p, e);
+        if (!_padic_ctx_pow_cached(rop, ctx, l))
+            fmpz_pow_ui(rop, ctx->p, e);
     }
 }
 
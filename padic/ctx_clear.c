@@ -33,5 +33,11 @@ void padic_ctx_clear(padic_ctx_t ctx)
     {
         _fmpz_vec_clear(ctx->pow, ctx->max - ctx->min);
     }
+
+    if (ctx->ext_alloc)
+    {
+        _fmpz_vec_clear(ctx->ext_pow, ctx->ext_alloc);
+        flint_free(ctx->ext_exp);
+    }
 }
 
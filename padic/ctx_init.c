@@ -58,6 +58,11 @@ void padic_ctx_init(padic_ctx_t ctx, const fmpz_t p, slong min, slong max,
         ctx->pow = NULL;
     }
 
+    ctx->ext_exp   = NULL;
+    ctx->ext_pow   = NULL;
+    ctx->ext_num   = 0;
+    ctx->ext_alloc = 0;
+
     ctx->mode = mode;
 }
 
@@ -0,0 +1,150 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <pthread.h>
+
+#include "padic.h"
+
+/*
+    One lock serialises access to the on-demand caches of all contexts;
+    it is only taken for exponents outside [min, max), and never while a
+    new power is being computed.
+*/
+static pthread_mutex_t _padic_ctx_pow_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/*
+    Returns the index of the first cached exponent which is at least e.
+    Assumes the lock is held.
+*/
+static slong _padic_ctx_pow_search(const padic_ctx_struct * c, slong e)
+{
+    slong lo = 0, hi = c->ext_num, mid;
+
+    while (lo < hi)
+    {
+        mid = lo + (hi - lo) / 2;
+        if (c->ext_exp[mid] < e)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return lo;
+}
+
+/*
+    Sets rop to p^e and returns 1 if p^e is held in, or could be added 
+    to, the context's cache, and returns 0 without touching rop once the 
+    cache holds PADIC_CTX_POW_CACHE_MAX powers. Entries are never removed 
+    before the context is cleared, so a shallow copy of the nearest 
+    smaller power taken under the lock stays valid while the new power 
+    is computed without it.
+*/
+int _padic_ctx_pow_cached(fmpz_t rop, const padic_ctx_struct * ctx, slong e)
+{
+    padic_ctx_struct * c = (padic_ctx_struct *) ctx;
+    fmpz_t t;
+    fmpz base;
+    slong lo, i, ebase;
+
+    pthread_mutex_lock(&_padic_ctx_pow_lock);
+
+    lo = _padic_ctx_pow_search(c, e);
+
+    if (lo < c->ext_num && c->ext_exp[lo] == e)
+    {
+        fmpz_set(rop, c->ext_pow + lo);
+        pthread_mutex_unlock(&_padic_ctx_pow_lock);
+        return 1;
+    }
+
+    if (c->ext_num >= PADIC_CTX_POW_CACHE_MAX)
+    {
+        pthread_mutex_unlock(&_padic_ctx_pow_lock);
+        return 0;
+    }
+
+    /* start from the nearest cached power below e where possible */
+    if (lo > 0)
+    {
+        base  = c->ext_pow[lo - 1];
+        ebase = c->ext_exp[lo - 1];
+    }
+    else if (c->max > c->min && e >= c->max)
+    {
+        base  = c->pow[c->max - 1 - c->min];
+        ebase = c->max - 1;
+    }
+    else
+    {
+        base  = WORD(1);
+        ebase = 0;
+    }
+
+    pthread_mutex_unlock(&_padic_ctx_pow_lock);
+
+    fmpz_init(t);
+    fmpz_pow_ui(t, c->p, e - ebase);
+    fmpz_mul(t, t, &base);
+    fmpz_set(rop, t);
+
+    pthread_mutex_lock(&_padic_ctx_pow_lock);
+
+    /* another thread may have changed the cache in the meantime */
+    lo = _padic_ctx_pow_search(c, e);
+
+    if ((lo == c->ext_num || c->ext_exp[lo] != e)
+        && c->ext_num < PADIC_CTX_POW_CACHE_MAX)
+    {
+        if (c->ext_num == c->ext_alloc)
+        {
+            slong alloc = FLINT_MAX(8, 2 * c->ext_alloc);
+
+            c->ext_exp = flint_realloc(c->ext_exp, alloc * sizeof(slong));
+            c->ext_pow = flint_realloc(c->ext_pow, alloc * sizeof(fmpz));
+            for (i = c->ext_alloc; i < alloc; i++)
+                fmpz_init(c->ext_pow + i);
+            c->ext_alloc = alloc;
+        }
+
+        /* shift the fmpz values themselves, which moves no mpz data */
+        for (i = c->ext_num; i > lo; i--)
+        {
+            c->ext_exp[i] = c->ext_exp[i - 1];
+            c->ext_pow[i] = c->ext_pow[i - 1];
+        }
+        c->ext_exp[lo] = e;
+        fmpz_init(c->ext_pow + lo);
+        fmpz_swap(c->ext_pow + lo, t);
+
+        c->ext_num++;
+    }
+
+    pthread_mutex_unlock(&_padic_ctx_pow_lock);
+
+    fmpz_clear(t);
+
+    return 1;
+}
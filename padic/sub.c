@@ -60,9 +60,9 @@ void padic_sub(padic_t rop, const padic_t op1, const padic_t op2,
         else if (padic_val(op1) < padic_val(op2))
         {
             fmpz_t f;
+            int alloc;
 
-            fmpz_init(f);
-            fmpz_pow_ui(f, ctx->p, padic_val(op2) - padic_val(op1));
+            alloc = _padic_ctx_pow_ui(f, padic_val(op2) - padic_val(op1), ctx);
             if (rop != op2)
             {
                 fmpz_set(padic_unit(rop), padic_unit(op1));
@@ -74,16 +74,17 @@ void padic_sub(padic_t rop, const padic_t op1, const padic_t op2,
                 fmpz_sub(padic_unit(rop), padic_unit(rop), padic_unit(op1));
                 fmpz_neg(padic_unit(rop), padic_unit(rop));
             }
-            fmpz_clear(f);
+            if (alloc)
+                fmpz_clear(f);
 
             padic_val(rop) = padic_val(op1);
         }
         else  /* padic_val(op1) > padic_val(op2) */
         {
             fmpz_t f;
+            int alloc;
 
-            fmpz_init(f);
-            fmpz_pow_ui(f, ctx->p, padic_val(op1) - padic_val(op2));
+            alloc = _padic_ctx_pow_ui(f, padic_val(op1) - padic_val(op2), ctx);
             if (rop != op1)
             {
                 fmpz_neg(padic_unit(rop), padic_unit(op2));
@@ -94,7 +95,8 @@ void padic_sub(padic_t rop, const padic_t op1, const padic_t op2,
                 fmpz_mul(padic_unit(rop), f, padic_unit(op1));
                 fmpz_sub(padic_unit(rop), padic_unit(rop), padic_unit(op2));
             }
-            fmpz_clear(f);
+            if (alloc)
+                fmpz_clear(f);
 
             padic_val(rop) = padic_val(op2);
         }
@@ -0,0 +1,172 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <pthread.h>
+#include "ulong_extras.h"
+#include "long_extras.h"
+#include "padic.h"
+
+typedef struct
+{
+    const padic_ctx_struct * ctx;
+    ulong seed;
+    int ok;
+}
+pow_arg_t;
+
+static void *
+_pow_worker(void * arg_ptr)
+{
+    pow_arg_t * arg = (pow_arg_t *) arg_ptr;
+    fmpz_t x, y;
+    slong j;
+
+    fmpz_init(x);
+    fmpz_init(y);
+
+    arg->ok = 1;
+    for (j = 0; j < 200; j++)
+    {
+        ulong e = (arg->seed + 37 * j) % 500;
+
+        fmpz_pow_ui(x, arg->ctx->p, e);
+        padic_ctx_pow_ui(y, e, arg->ctx);
+
+        if (!fmpz_equal(x, y))
+            arg->ok = 0;
+    }
+
+    fmpz_clear(x);
+    fmpz_clear(y);
+    flint_cleanup();
+    return NULL;
+}
+
+int
+main(void)
+{
+    int i, j, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("ctx_pow_ui... ");
+    fflush(stdout);
+
+    /* Compare with fmpz_pow_ui, inside and outside the precomputed range */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p, x, y;
+        slong min, max, len;
+        padic_ctx_t ctx;
+
+        fmpz_init_set_ui(p, n_randtest_prime(state, 0));
+        min = n_randint(state, 20);
+        max = min + n_randint(state, 20);
+        padic_ctx_init(ctx, p, min, max, PADIC_SERIES);
+
+        fmpz_init(x);
+        fmpz_init(y);
+
+        len = n_randint(state, 2 * PADIC_CTX_POW_CACHE_MAX);
+
+        for (j = 0; j < len; j++)
+        {
+            fmpz_t z;
+            int alloc;
+            ulong e = n_randint(state, 400);
+
+            fmpz_pow_ui(x, p, e);
+
+            padic_ctx_pow_ui(y, e, ctx);
+            alloc = _padic_ctx_pow_ui(z, e, ctx);
+
+            result = (fmpz_equal(x, y) && fmpz_equal(x, z));
+            if (!result)
+            {
+                flint_printf("FAIL:\n\n");
+                flint_printf("p = "), fmpz_print(p), flint_printf("\n");
+                flint_printf("e = %wu\n", e);
+                flint_printf("x = "), fmpz_print(x), flint_printf("\n");
+                flint_printf("y = "), fmpz_print(y), flint_printf("\n");
+                flint_printf("z = "), fmpz_print(z), flint_printf("\n");
+                abort();
+            }
+
+            if (alloc)
+                fmpz_clear(z);
+        }
+
+        result = (ctx->ext_num <= PADIC_CTX_POW_CACHE_MAX);
+        if (!result)
+        {
+            flint_printf("FAIL (cache size):\n\n");
+            flint_printf("ext_num = %wd\n", ctx->ext_num);
+            abort();
+        }
+
+        fmpz_clear(x);
+        fmpz_clear(y);
+        fmpz_clear(p);
+        padic_ctx_clear(ctx);
+    }
+
+    /* Share one context between threads filling its cache concurrently */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p;
+        padic_ctx_t ctx;
+        pthread_t threads[4];
+        pow_arg_t args[4];
+
+        fmpz_init_set_ui(p, n_randtest_prime(state, 0));
+        padic_ctx_init(ctx, p, 0, n_randint(state, 20), PADIC_SERIES);
+
+        for (j = 0; j < 4; j++)
+        {
+            args[j].ctx = ctx;
+            args[j].seed = n_randlimb(state);
+            pthread_create(&threads[j], NULL, _pow_worker, &args[j]);
+        }
+
+        for (j = 0; j < 4; j++)
+        {
+            pthread_join(threads[j], NULL);
+
+            if (!args[j].ok)
+            {
+                flint_printf("FAIL (threaded):\n\n");
+                flint_printf("p = "), fmpz_print(p), flint_printf("\n");
+                abort();
+            }
+        }
+
+        fmpz_clear(p);
+        padic_ctx_clear(ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
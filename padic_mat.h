@@ -263,6 +263,11 @@ FLINT_DLL void _padic_mat_sub(padic_mat_t C, const padic_mat_t A, const padic_ma
 FLINT_DLL void padic_mat_sub(padic_mat_t C, const padic_mat_t A, const padic_mat_t B, 
                                   const padic_ctx_t ctx);
 
+FLINT_DLL void padic_mat_add_lazy(padic_mat_t C, const padic_mat_t A, 
+                                  const padic_mat_t B, const padic_ctx_t ctx);
+FLINT_DLL void padic_mat_sub_lazy(padic_mat_t C, const padic_mat_t A, 
+                                  const padic_mat_t B, const padic_ctx_t ctx);
+
 FLINT_DLL void _padic_mat_neg(padic_mat_t B, const padic_mat_t A);
 FLINT_DLL void padic_mat_neg(padic_mat_t B, const padic_mat_t A, const padic_ctx_t ctx);
 
@@ -291,6 +296,9 @@ FLINT_DLL void padic_mat_scalar_div_fmpz(padic_mat_t B,
 FLINT_DLL void padic_mat_mul(padic_mat_t C, const padic_mat_t A, const padic_mat_t B, 
                                   const padic_ctx_t ctx);
 
+FLINT_DLL void padic_mat_mul_lazy(padic_mat_t C, const padic_mat_t A, 
+                                  const padic_mat_t B, const padic_ctx_t ctx);
+
 #ifdef __cplusplus
 }
 #endif
@@ -63,9 +63,9 @@ void _padic_mat_add(padic_mat_t C, const padic_mat_t A, const padic_mat_t B,
     else  /* padic_mat_val(A) > padic_mat_val(B) */
     {
         fmpz_t x;
+        int alloc;
 
-        fmpz_init(x);
-        fmpz_pow_ui(x, ctx->p, padic_mat_val(A) - padic_mat_val(B));
+        alloc = _padic_ctx_pow_ui(x, padic_mat_val(A) - padic_mat_val(B), ctx);
 
         if (C == B)
         {
@@ -84,7 +84,8 @@ void _padic_mat_add(padic_mat_t C, const padic_mat_t A, const padic_mat_t B,
             padic_mat_val(C) = padic_mat_val(B);
         }
 
-        fmpz_clear(x);
+        if (alloc)
+            fmpz_clear(x);
     }
 
     /* Reduction */
@@ -38,15 +38,16 @@ void _padic_mat_reduce(padic_mat_t mat, const padic_ctx_t ctx)
         {
             slong i;
             fmpz_t pow;
+            int alloc;
 
-            fmpz_init(pow);
-            fmpz_pow_ui(pow, ctx->p, padic_mat_prec(mat) - mat->val);
+            alloc = _padic_ctx_pow_ui(pow, padic_mat_prec(mat) - mat->val, ctx);
             for (i = 0; i < padic_mat(mat)->r * padic_mat(mat)->c; i++)
             {
                 fmpz_mod(padic_mat(mat)->entries + i, 
                          padic_mat(mat)->entries + i, pow);
             }
-            fmpz_clear(pow);
+            if (alloc)
+                fmpz_clear(pow);
 
             if (padic_mat_is_zero(mat))
             {
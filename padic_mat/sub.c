@@ -62,11 +62,11 @@ void _padic_mat_sub(padic_mat_t C, const padic_mat_t A, const padic_mat_t B,
     else 
     {
         fmpz_t x;
-        fmpz_init(x);
+        int alloc;
 
         if (padic_mat_val(A) < padic_mat_val(B))
         {
-            fmpz_pow_ui(x, ctx->p, padic_mat_val(B) - padic_mat_val(A));
+            alloc = _padic_ctx_pow_ui(x, padic_mat_val(B) - padic_mat_val(A), ctx);
 
             if (C == A)
             {
@@ -74,9 +74,8 @@ void _padic_mat_sub(padic_mat_t C, const padic_mat_t A, const padic_mat_t B,
             }
             else if (C == B)
             {
-                fmpz_neg(x, x);
                 fmpz_mat_scalar_mul_fmpz(padic_mat(C), padic_mat(B), x);
-                fmpz_mat_add(padic_mat(C), padic_mat(A), padic_mat(C));
+                fmpz_mat_sub(padic_mat(C), padic_mat(A), padic_mat(C));
                 padic_mat_val(C) = padic_mat_val(A);
             }
             else
@@ -88,7 +87,7 @@ void _padic_mat_sub(padic_mat_t C, const padic_mat_t A, const padic_mat_t B,
         }
         else  /* A->val > B->val */
         {
-            fmpz_pow_ui(x, ctx->p, padic_mat_val(A) - padic_mat_val(B));
+            alloc = _padic_ctx_pow_ui(x, padic_mat_val(A) - padic_mat_val(B), ctx);
 
             if (C == B)
             {
@@ -102,7 +101,8 @@ void _padic_mat_sub(padic_mat_t C, const padic_mat_t A, const padic_mat_t B,
                 padic_mat_val(C) = padic_mat_val(B);
             }
         }
-        fmpz_clear(x);
+        if (alloc)
+            fmpz_clear(x);
     }
 
 }
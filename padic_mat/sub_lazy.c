@@ -0,0 +1,106 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include "fmpz_mat.h"
+#include "padic_mat.h"
+
+void padic_mat_sub_lazy(padic_mat_t C, const padic_mat_t A, const padic_mat_t B, 
+                                       const padic_ctx_t ctx)
+{
+    if (padic_mat_is_empty(C))
+    {
+        return;
+    }
+
+    if (padic_mat_is_zero(A))
+    {
+        fmpz_mat_neg(padic_mat(C), padic_mat(B));
+        padic_mat_val(C) = padic_mat_val(B);
+    }
+    else if (padic_mat_is_zero(B))
+    {
+        fmpz_mat_set(padic_mat(C), padic_mat(A));
+        padic_mat_val(C) = padic_mat_val(A);
+    }
+    else if (FLINT_MIN(padic_mat_val(A), padic_mat_val(B)) >= padic_mat_prec(C))
+    {
+        padic_mat_zero(C);
+    }
+    else if (padic_mat_val(A) == padic_mat_val(B))
+    {
+        fmpz_mat_sub(padic_mat(C), padic_mat(A), padic_mat(B));
+        padic_mat_val(C) = padic_mat_val(A);
+    }
+    else
+    {
+        fmpz_t x;
+        int alloc;
+
+        if (padic_mat_val(A) < padic_mat_val(B))
+        {
+            alloc = _padic_ctx_pow_ui(x, padic_mat_val(B) - padic_mat_val(A), ctx);
+
+            if (C == A)
+            {
+                fmpz_mat_scalar_submul_fmpz(padic_mat(C), padic_mat(B), x);
+            }
+            else if (C == B)
+            {
+                fmpz_mat_scalar_mul_fmpz(padic_mat(C), padic_mat(B), x);
+                fmpz_mat_sub(padic_mat(C), padic_mat(A), padic_mat(C));
+            }
+            else
+            {
+                fmpz_mat_set(padic_mat(C), padic_mat(A));
+                fmpz_mat_scalar_submul_fmpz(padic_mat(C), padic_mat(B), x);
+            }
+            padic_mat_val(C) = padic_mat_val(A);
+        }
+        else
+        {
+            alloc = _padic_ctx_pow_ui(x, padic_mat_val(A) - padic_mat_val(B), ctx);
+
+            if (C == B)
+            {
+                fmpz_mat_scalar_submul_fmpz(padic_mat(C), padic_mat(A), x);
+                fmpz_mat_neg(padic_mat(C), padic_mat(C));
+            }
+            else
+            {
+                fmpz_mat_scalar_mul_fmpz(padic_mat(C), padic_mat(A), x);
+                fmpz_mat_sub(padic_mat(C), padic_mat(C), padic_mat(B));
+            }
+            padic_mat_val(C) = padic_mat_val(B);
+        }
+
+        if (alloc)
+            fmpz_clear(x);
+    }
+
+    if (padic_mat_val(C) != 0 && fmpz_mat_is_zero(padic_mat(C)))
+    {
+        padic_mat_val(C) = 0;
+    }
+}
@@ -0,0 +1,171 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "long_extras.h"
+#include "padic.h"
+#include "padic_mat.h"
+
+static void
+_randtest_nonneg(padic_mat_t a, flint_rand_t state, const padic_ctx_t ctx)
+{
+    padic_mat_randtest(a, state, ctx);
+    if (padic_mat_val(a) < 0)
+    {
+        padic_mat_val(a) = - padic_mat_val(a);
+        padic_mat_reduce(a, ctx);
+    }
+}
+
+int
+main(void)
+{
+    int i, j, result;
+
+    fmpz_t p;
+    slong N;
+    padic_ctx_t ctx;
+    slong m;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("lazy... ");
+    fflush(stdout);    
+
+    /* Check a b + c - a computed lazily and reduced once */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        padic_mat_t a, b, c, d, t;
+
+        fmpz_init_set_ui(p, n_randtest_prime(state, 0));
+        N = n_randint(state, PADIC_TEST_PREC_MAX - PADIC_TEST_PREC_MIN) 
+            + PADIC_TEST_PREC_MIN;
+        padic_ctx_init(ctx, p, FLINT_MAX(0, N-10), FLINT_MAX(0, N+10), PADIC_VAL_UNIT);
+
+        m = n_randint(state, 10);
+
+        padic_mat_init2(a, m, m, N);
+        padic_mat_init2(b, m, m, N);
+        padic_mat_init2(c, m, m, N);
+        padic_mat_init2(d, m, m, N);
+        padic_mat_init2(t, m, m, N);
+
+        _randtest_nonneg(a, state, ctx);
+        _randtest_nonneg(b, state, ctx);
+        _randtest_nonneg(c, state, ctx);
+
+        padic_mat_mul(d, a, b, ctx);
+        padic_mat_add(d, d, c, ctx);
+        padic_mat_sub(d, d, a, ctx);
+
+        padic_mat_mul_lazy(t, a, b, ctx);
+        padic_mat_add_lazy(t, c, t, ctx);
+        padic_mat_sub_lazy(t, t, a, ctx);
+        padic_mat_reduce(t, ctx);
+
+        result = (padic_mat_equal(t, d) && padic_mat_is_reduced(t, ctx));
+        if (!result)
+        {
+            flint_printf("FAIL:\n\n");
+            flint_printf("a = "), padic_mat_print(a, ctx), flint_printf("\n");
+            flint_printf("b = "), padic_mat_print(b, ctx), flint_printf("\n");
+            flint_printf("c = "), padic_mat_print(c, ctx), flint_printf("\n");
+            flint_printf("d = "), padic_mat_print(d, ctx), flint_printf("\n");
+            flint_printf("t = "), padic_mat_print(t, ctx), flint_printf("\n");
+            abort();
+        }
+
+        padic_mat_clear(a);
+        padic_mat_clear(b);
+        padic_mat_clear(c);
+        padic_mat_clear(d);
+        padic_mat_clear(t);
+
+        fmpz_clear(p);
+        padic_ctx_clear(ctx);
+    }
+
+    /* Check a sum of products a (b_1 + ... + b_k) - a b_1 - ... - a b_k */
+    for (i = 0; i < 500 * flint_test_multiplier(); i++)
+    {
+        padic_mat_t a, b, s, t, u;
+        slong k;
+
+        fmpz_init_set_ui(p, n_randtest_prime(state, 0));
+        N = n_randint(state, PADIC_TEST_PREC_MAX - PADIC_TEST_PREC_MIN) 
+            + PADIC_TEST_PREC_MIN;
+        padic_ctx_init(ctx, p, FLINT_MAX(0, N-10), FLINT_MAX(0, N+10), PADIC_VAL_UNIT);
+
+        m = n_randint(state, 8);
+        k = n_randint(state, 10);
+
+        padic_mat_init2(a, m, m, N);
+        padic_mat_init2(b, m, m, N);
+        padic_mat_init2(s, m, m, N);
+        padic_mat_init2(t, m, m, N);
+        padic_mat_init2(u, m, m, N);
+
+        _randtest_nonneg(a, state, ctx);
+
+        for (j = 0; j < k; j++)
+        {
+            _randtest_nonneg(b, state, ctx);
+            padic_mat_add(s, s, b, ctx);
+            padic_mat_mul_lazy(u, a, b, ctx);
+            padic_mat_sub_lazy(t, t, u, ctx);
+        }
+        padic_mat_mul_lazy(u, a, s, ctx);
+        padic_mat_add_lazy(t, t, u, ctx);
+        padic_mat_reduce(t, ctx);
+
+        result = (padic_mat_is_zero(t));
+        if (!result)
+        {
+            flint_printf("FAIL (sum of products):\n\n");
+            flint_printf("a = "), padic_mat_print(a, ctx), flint_printf("\n");
+            flint_printf("s = "), padic_mat_print(s, ctx), flint_printf("\n");
+            flint_printf("t = "), padic_mat_print(t, ctx), flint_printf("\n");
+            abort();
+        }
+
+        padic_mat_clear(a);
+        padic_mat_clear(b);
+        padic_mat_clear(s);
+        padic_mat_clear(t);
+        padic_mat_clear(u);
+
+        fmpz_clear(p);
+        padic_ctx_clear(ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,156 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#ifndef PADIC_NMOD_H
+#define PADIC_NMOD_H
+
+#ifdef PADIC_NMOD_INLINES_C
+#define PADIC_NMOD_INLINE FLINT_DLL
+#else
+#define PADIC_NMOD_INLINE static __inline__
+#endif
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdlib.h>
+#include <stdio.h>
+#undef ulong
+
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "fmpz.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "padic.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*
+    Elements of Z_p / p^N Z_p stored as a single word in [0, p^N), 
+    for p^N < 2^PADIC_NMOD_MAX_BITS.
+ */
+
+#define PADIC_NMOD_MAX_BITS (FLINT_BITS - 2)
+
+/* Context *******************************************************************/
+
+typedef struct
+{
+    mp_limb_t p;
+    slong N;
+
+    nmod_t mod;     /* p^N */
+    nmod_t pmod;    /* p   */
+
+    mp_limb_t *pow; /* p^0, ..., p^N */
+}
+padic_nmod_ctx_struct;
+
+typedef padic_nmod_ctx_struct padic_nmod_ctx_t[1];
+
+FLINT_DLL slong padic_nmod_max_prec(mp_limb_t p);
+
+FLINT_DLL void padic_nmod_ctx_init(padic_nmod_ctx_t ctx, mp_limb_t p, slong N);
+
+FLINT_DLL void padic_nmod_ctx_clear(padic_nmod_ctx_t ctx);
+
+PADIC_NMOD_INLINE mp_limb_t padic_nmod_ctx_prime(const padic_nmod_ctx_t ctx)
+{
+    return ctx->p;
+}
+
+PADIC_NMOD_INLINE slong padic_nmod_ctx_prec(const padic_nmod_ctx_t ctx)
+{
+    return ctx->N;
+}
+
+/* Basic arithmetic **********************************************************/
+
+PADIC_NMOD_INLINE 
+mp_limb_t padic_nmod_add(mp_limb_t a, mp_limb_t b, const padic_nmod_ctx_t ctx)
+{
+    return _nmod_add(a, b, ctx->mod);
+}
+
+PADIC_NMOD_INLINE 
+mp_limb_t padic_nmod_sub(mp_limb_t a, mp_limb_t b, const padic_nmod_ctx_t ctx)
+{
+    return _nmod_sub(a, b, ctx->mod);
+}
+
+PADIC_NMOD_INLINE 
+mp_limb_t padic_nmod_neg(mp_limb_t a, const padic_nmod_ctx_t ctx)
+{
+    return nmod_neg(a, ctx->mod);
+}
+
+PADIC_NMOD_INLINE 
+mp_limb_t padic_nmod_mul(mp_limb_t a, mp_limb_t b, const padic_nmod_ctx_t ctx)
+{
+    return n_mulmod2_preinv(a, b, ctx->mod.n, ctx->mod.ninv);
+}
+
+PADIC_NMOD_INLINE 
+mp_limb_t padic_nmod_pow_ui(mp_limb_t a, ulong e, const padic_nmod_ctx_t ctx)
+{
+    return n_powmod2_ui_preinv(a, e, ctx->mod.n, ctx->mod.ninv);
+}
+
+PADIC_NMOD_INLINE int padic_nmod_is_unit(mp_limb_t a, const padic_nmod_ctx_t ctx)
+{
+    return (a % ctx->p) != 0;
+}
+
+FLINT_DLL mp_limb_t padic_nmod_inv(mp_limb_t a, const padic_nmod_ctx_t ctx);
+
+FLINT_DLL slong padic_nmod_val(mp_limb_t a, const padic_nmod_ctx_t ctx);
+
+/* Special functions *********************************************************/
+
+FLINT_DLL mp_limb_t padic_nmod_teichmuller(mp_limb_t a, 
+                                           const padic_nmod_ctx_t ctx);
+
+/* Conversions ***************************************************************/
+
+FLINT_DLL mp_limb_t padic_nmod_set_padic(const padic_t op, 
+                                         const padic_nmod_ctx_t ctx);
+
+FLINT_DLL void padic_nmod_get_padic(padic_t rop, mp_limb_t op, 
+                          const padic_ctx_t pctx, const padic_nmod_ctx_t ctx);
+
+/* Randomisation *************************************************************/
+
+FLINT_DLL mp_limb_t padic_nmod_randtest(flint_rand_t state, 
+                                        const padic_nmod_ctx_t ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,56 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include "padic_nmod.h"
+
+void padic_nmod_ctx_init(padic_nmod_ctx_t ctx, mp_limb_t p, slong N)
+{
+    slong i;
+
+    if (N < 1)
+    {
+        flint_printf("Exception (padic_nmod_ctx_init).  N < 1.\n");
+        abort();
+    }
+
+    if (N > padic_nmod_max_prec(p))
+    {
+        flint_printf("Exception (padic_nmod_ctx_init).  "
+                     "p^N does not fit in %d bits.\n", PADIC_NMOD_MAX_BITS);
+        abort();
+    }
+
+    ctx->pow = flint_malloc((N + 1) * sizeof(mp_limb_t));
+    ctx->pow[0] = 1;
+
+    for (i = 1; i <= N; i++)
+        ctx->pow[i] = ctx->pow[i - 1] * p;
+
+    ctx->p = p;
+    ctx->N = N;
+
+    nmod_init(&ctx->mod, ctx->pow[N]);
+    nmod_init(&ctx->pmod, p);
+}
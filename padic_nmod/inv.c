@@ -0,0 +1,37 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include "padic_nmod.h"
+
+mp_limb_t padic_nmod_inv(mp_limb_t a, const padic_nmod_ctx_t ctx)
+{
+    if (a % ctx->p == 0)
+    {
+        flint_printf("Exception (padic_nmod_inv).  Operand is not a unit.\n");
+        abort();
+    }
+
+    return n_invmod(a, ctx->mod.n);
+}
@@ -0,0 +1,45 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include "padic_nmod.h"
+
+mp_limb_t padic_nmod_set_padic(const padic_t op, const padic_nmod_ctx_t ctx)
+{
+    const slong v = padic_val(op);
+    mp_limb_t u;
+
+    if (padic_is_zero(op) || v >= ctx->N)
+        return 0;
+
+    if (v < 0)
+    {
+        flint_printf("Exception (padic_nmod_set_padic).  Negative valuation.\n");
+        abort();
+    }
+
+    u = fmpz_fdiv_ui(padic_unit(op), ctx->pow[ctx->N - v]);
+
+    return u * ctx->pow[v];
+}
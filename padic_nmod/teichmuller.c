@@ -0,0 +1,46 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include "padic_nmod.h"
+
+/*
+    The Teichm\"uller lift of a is the limit of a^{p^k}; after reducing 
+    a modulo p, N - 1 further powerings by p give it modulo p^N.
+ */
+
+mp_limb_t padic_nmod_teichmuller(mp_limb_t a, const padic_nmod_ctx_t ctx)
+{
+    slong i;
+
+    a = n_mod2_preinv(a, ctx->pmod.n, ctx->pmod.ninv);
+
+    if (a == 0)
+        return 0;
+
+    for (i = 1; i < ctx->N; i++)
+        a = n_powmod2_ui_preinv(a, ctx->p, ctx->mod.n, ctx->mod.ninv);
+
+    return a;
+}
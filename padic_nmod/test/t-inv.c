@@ -0,0 +1,77 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "padic_nmod.h"
+#include "ulong_extras.h"
+#include "long_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("inv... ");
+    fflush(stdout);
+
+    /* Check a a^{-1} = 1 and the valuation of units */
+    for (i = 0; i < 10000 * flint_test_multiplier(); i++)
+    {
+        mp_limb_t p, a, b;
+        slong N;
+        padic_nmod_ctx_t ctx;
+
+        p = n_randprime(state, 2 + n_randint(state, 20), 1);
+        N = n_randint(state, padic_nmod_max_prec(p)) + 1;
+
+        padic_nmod_ctx_init(ctx, p, N);
+
+        do
+            a = padic_nmod_randtest(state, ctx);
+        while (!padic_nmod_is_unit(a, ctx));
+
+        b = padic_nmod_inv(a, ctx);
+
+        result = (padic_nmod_mul(a, b, ctx) == UWORD(1) % ctx->mod.n 
+                  && padic_nmod_val(a, ctx) == 0);
+        if (!result)
+        {
+            flint_printf("FAIL:\n\n");
+            flint_printf("p = %wu, N = %wd\n", p, N);
+            flint_printf("a = %wu, b = %wu\n", a, b);
+            abort();
+        }
+
+        padic_nmod_ctx_clear(ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
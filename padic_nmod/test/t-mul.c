@@ -0,0 +1,102 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "padic_nmod.h"
+#include "ulong_extras.h"
+#include "long_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul... ");
+    fflush(stdout);
+
+    /* Compare add, sub and mul with padic */
+    for (i = 0; i < 10000 * flint_test_multiplier(); i++)
+    {
+        fmpz_t P;
+        mp_limb_t p, a, b, c, d, e;
+        slong N;
+        padic_nmod_ctx_t ctx;
+        padic_ctx_t pctx;
+        padic_t x, y, z;
+
+        p = n_randprime(state, 2 + n_randint(state, 20), 1);
+        N = n_randint(state, padic_nmod_max_prec(p)) + 1;
+
+        padic_nmod_ctx_init(ctx, p, N);
+        fmpz_init_set_ui(P, p);
+        padic_ctx_init(pctx, P, 0, N, PADIC_SERIES);
+
+        padic_init2(x, N);
+        padic_init2(y, N);
+        padic_init2(z, N);
+
+        a = padic_nmod_randtest(state, ctx);
+        b = padic_nmod_randtest(state, ctx);
+
+        padic_nmod_get_padic(x, a, pctx, ctx);
+        padic_nmod_get_padic(y, b, pctx, ctx);
+
+        padic_mul(z, x, y, pctx);
+        c = padic_nmod_set_padic(z, ctx);
+        padic_add(z, x, y, pctx);
+        d = padic_nmod_set_padic(z, ctx);
+        padic_sub(z, x, y, pctx);
+        e = padic_nmod_set_padic(z, ctx);
+
+        result = (c == padic_nmod_mul(a, b, ctx) 
+               && d == padic_nmod_add(a, b, ctx) 
+               && e == padic_nmod_sub(a, b, ctx)
+               && padic_nmod_add(e, padic_nmod_neg(e, ctx), ctx) == 0);
+        if (!result)
+        {
+            flint_printf("FAIL:\n\n");
+            flint_printf("p = %wu, N = %wd\n", p, N);
+            flint_printf("a = %wu, b = %wu\n", a, b);
+            flint_printf("c = %wu, d = %wu, e = %wu\n", c, d, e);
+            abort();
+        }
+
+        padic_clear(x);
+        padic_clear(y);
+        padic_clear(z);
+
+        padic_ctx_clear(pctx);
+        fmpz_clear(P);
+        padic_nmod_ctx_clear(ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
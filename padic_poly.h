@@ -277,6 +277,24 @@ FLINT_DLL void padic_poly_sub(padic_poly_t f,
 FLINT_DLL void padic_poly_neg(padic_poly_t f, const padic_poly_t g, 
                     const padic_ctx_t ctx);
 
+FLINT_DLL void _padic_poly_add_lazy(fmpz *rop, slong *rval, 
+                     const fmpz *op1, slong val1, slong len1, 
+                     const fmpz *op2, slong val2, slong len2, 
+                     const padic_ctx_t ctx);
+
+FLINT_DLL void padic_poly_add_lazy(padic_poly_t f, 
+                    const padic_poly_t g, const padic_poly_t h, 
+                    const padic_ctx_t ctx);
+
+FLINT_DLL void _padic_poly_sub_lazy(fmpz *rop, slong *rval, 
+                     const fmpz *op1, slong val1, slong len1, 
+                     const fmpz *op2, slong val2, slong len2, 
+                     const padic_ctx_t ctx);
+
+FLINT_DLL void padic_poly_sub_lazy(padic_poly_t f, 
+                    const padic_poly_t g, const padic_poly_t h, 
+                    const padic_ctx_t ctx);
+
 /*  Scalar multiplication and division  **************************************/
 
 FLINT_DLL void _padic_poly_scalar_mul_padic(fmpz *rop, slong *rval, slong N, 
@@ -297,6 +315,10 @@ FLINT_DLL void padic_poly_mul(padic_poly_t f,
                     const padic_poly_t g, const padic_poly_t h, 
                     const padic_ctx_t ctx);
 
+FLINT_DLL void padic_poly_mul_lazy(padic_poly_t f, 
+                    const padic_poly_t g, const padic_poly_t h, 
+                    const padic_ctx_t ctx);
+
 /*  Powering  ****************************************************************/
 
 FLINT_DLL void _padic_poly_pow(fmpz *rop, slong *rval, slong N, 
@@ -0,0 +1,133 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include "padic_poly.h"
+
+void _padic_poly_add_lazy(fmpz *rop, slong *val, 
+                     const fmpz *op1, slong val1, slong len1, 
+                     const fmpz *op2, slong val2, slong len2, 
+                     const padic_ctx_t ctx)
+{
+    const slong len = FLINT_MAX(len1, len2);
+
+    *val = FLINT_MIN(val1, val2);
+
+    if (val1 == val2)
+    {
+        _fmpz_poly_add(rop, op1, len1, op2, len2);
+        _padic_poly_canonicalise(rop, val, len, ctx->p);
+    }
+    else  /* => (op1 != op2) */
+    {
+        fmpz_t x;
+        int alloc;
+
+        if (val1 < val2)  /* F := p^g (G + p^{h-g} H) */
+        {
+            alloc = _padic_ctx_pow_ui(x, val2 - val1, ctx);
+
+            if (rop == op1)
+            {
+                _fmpz_vec_zero(rop + len1, len2 - len1);
+                _fmpz_vec_scalar_addmul_fmpz(rop, op2, len2, x);
+            }
+            else
+            {
+                _fmpz_vec_scalar_mul_fmpz(rop, op2, len2, x);
+                _fmpz_poly_add(rop, op1, len1, rop, len2);
+            }
+        }
+        else  /* F := p^h (p^{g-h} G + H) */
+        {
+            alloc = _padic_ctx_pow_ui(x, val1 - val2, ctx);
+
+            if (rop == op2)
+            {
+                _fmpz_vec_zero(rop + len2, len1 - len2);
+                _fmpz_vec_scalar_addmul_fmpz(rop, op1, len1, x);
+            }
+            else
+            {
+                _fmpz_vec_scalar_mul_fmpz(rop, op1, len1, x);
+                _fmpz_poly_add(rop, rop, len1, op2, len2);
+            }
+        }
+        if (alloc)
+            fmpz_clear(x);
+    }
+}
+
+void padic_poly_add_lazy(padic_poly_t f, 
+                    const padic_poly_t g, const padic_poly_t h, 
+                    const padic_ctx_t ctx)
+{
+    const slong lenG = g->length;
+    const slong lenH = h->length;
+    const slong lenF = FLINT_MAX(lenG, lenH);
+
+    if (lenG == 0 && lenH == 0)
+    {
+        padic_poly_zero(f);
+        return;
+    }
+    if (lenG == 0)
+    {
+        if (f != h)
+        {
+            padic_poly_fit_length(f, lenH);
+            _fmpz_vec_set(f->coeffs, h->coeffs, lenH);
+            f->val = h->val;
+            _padic_poly_set_length(f, lenH);
+        }
+        return;
+    }
+    if (lenH == 0)
+    {
+        if (f != g)
+        {
+            padic_poly_fit_length(f, lenG);
+            _fmpz_vec_set(f->coeffs, g->coeffs, lenG);
+            f->val = g->val;
+            _padic_poly_set_length(f, lenG);
+        }
+        return;
+    }
+    if (FLINT_MIN(g->val, h->val) >= f->N)
+    {
+        padic_poly_zero(f);
+        return;
+    }
+
+    padic_poly_fit_length(f, lenF);
+
+    _padic_poly_add_lazy(f->coeffs, &(f->val), 
+                         g->coeffs, g->val, lenG, 
+                         h->coeffs, h->val, lenH, ctx);
+
+    _padic_poly_set_length(f, lenF);
+    _padic_poly_normalise(f);
+    if (f->length == 0)
+        f->val = 0;
+}
@@ -33,52 +33,7 @@ void _padic_poly_sub(fmpz *rop, slong *val, slong N,
 {
     const slong len = FLINT_MAX(len1, len2);
 
-    *val = FLINT_MIN(val1, val2);
-
-    if (val1 == val2)
-    {
-        _fmpz_poly_sub(rop, op1, len1, op2, len2);
-        _padic_poly_canonicalise(rop, val, len, ctx->p);
-    }
-    else
-    {
-        fmpz_t x;
-
-        fmpz_init(x);
-        if (val1 < val2)  /* F := p^g (G - p^{h-g} H) */
-        {
-            fmpz_pow_ui(x, ctx->p, val2 - val1);
-
-            if (rop == op1)
-            {
-                _fmpz_vec_zero(rop + len1, len2 - len1);
-                _fmpz_vec_scalar_submul_fmpz(rop, op2, len2, x);
-            }
-            else
-            {
-                _fmpz_vec_scalar_mul_fmpz(rop, op2, len2, x);
-                _fmpz_vec_neg(rop, rop, len2);
-                _fmpz_poly_add(rop, op1, len1, rop, len2);
-            }
-        }
-        else  /* F := p^h (p^(g-h) G - H) */
-        {
-            fmpz_pow_ui(x, ctx->p, val1 - val2);
-
-            if (rop == op2)
-            {
-                _fmpz_vec_neg(rop, op2, len2);
-                _fmpz_vec_zero(rop + len2, len1 - len2);
-                _fmpz_vec_scalar_addmul_fmpz(rop, op1, len1, x);
-            }
-            else
-            {
-                _fmpz_vec_scalar_mul_fmpz(rop, op1, len1, x);
-                _fmpz_poly_sub(rop, rop, len1, op2, len2);
-            }
-        }
-        fmpz_clear(x);
-    }
+    _padic_poly_sub_lazy(rop, val, op1, val1, len1, op2, val2, len2, ctx);
 
     /* Reduce */
     if (N - *val > 0)
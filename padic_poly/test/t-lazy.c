@@ -0,0 +1,153 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "padic_poly.h"
+#include "ulong_extras.h"
+#include "long_extras.h"
+
+int
+main(void)
+{
+    int i, j, result;
+
+    padic_ctx_t ctx;
+    fmpz_t p;
+    slong N;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("lazy... ");
+    fflush(stdout);    
+
+    /* Check b c + d - b computed lazily and reduced once */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        padic_poly_t a, b, c, d, t;
+
+        fmpz_init_set_ui(p, n_randtest_prime(state, 0));
+        N = n_randint(state, PADIC_TEST_PREC_MAX - 1) + 1;
+        padic_ctx_init(ctx, p, FLINT_MAX(0, N-10), FLINT_MAX(0, N+10), PADIC_SERIES);
+
+        padic_poly_init2(a, 0, N);
+        padic_poly_init2(b, 0, N);
+        padic_poly_init2(c, 0, N);
+        padic_poly_init2(d, 0, N);
+        padic_poly_init2(t, 0, N);
+
+        padic_poly_randtest_val(b, state, n_randint(state, N), n_randint(state, 40), ctx);
+        padic_poly_randtest_val(c, state, n_randint(state, N), n_randint(state, 40), ctx);
+        padic_poly_randtest_val(d, state, n_randint(state, N), n_randint(state, 40), ctx);
+
+        padic_poly_mul(a, b, c, ctx);
+        padic_poly_add(a, a, d, ctx);
+        padic_poly_sub(a, a, b, ctx);
+
+        padic_poly_mul_lazy(t, b, c, ctx);
+        padic_poly_add_lazy(t, d, t, ctx);
+        padic_poly_sub_lazy(t, t, b, ctx);
+        padic_poly_reduce(t, ctx);
+
+        result = (padic_poly_equal(a, t) && padic_poly_is_reduced(t, ctx) 
+                  && padic_poly_is_canonical(t, ctx));
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("b = "), padic_poly_print(b, ctx), flint_printf("\n\n");
+            flint_printf("c = "), padic_poly_print(c, ctx), flint_printf("\n\n");
+            flint_printf("d = "), padic_poly_print(d, ctx), flint_printf("\n\n");
+            flint_printf("a = "), padic_poly_print(a, ctx), flint_printf("\n\n");
+            flint_printf("t = "), padic_poly_print(t, ctx), flint_printf("\n\n");
+            abort();
+        }
+
+        padic_poly_clear(a);
+        padic_poly_clear(b);
+        padic_poly_clear(c);
+        padic_poly_clear(d);
+        padic_poly_clear(t);
+
+        padic_ctx_clear(ctx);
+        fmpz_clear(p);
+    }
+
+    /* Check a Horner chain with a single reduction at the end */
+    for (i = 0; i < 500 * flint_test_multiplier(); i++)
+    {
+        padic_poly_t a, b, c, t;
+        slong k;
+
+        fmpz_init_set_ui(p, n_randtest_prime(state, 0));
+        N = n_randint(state, PADIC_TEST_PREC_MAX - 1) + 1;
+        padic_ctx_init(ctx, p, FLINT_MAX(0, N-10), FLINT_MAX(0, N+10), PADIC_SERIES);
+
+        padic_poly_init2(a, 0, N);
+        padic_poly_init2(b, 0, N);
+        padic_poly_init2(c, 0, N);
+        padic_poly_init2(t, 0, N);
+
+        padic_poly_randtest_val(b, state, n_randint(state, N), n_randint(state, 10), ctx);
+        k = n_randint(state, 6);
+
+        for (j = 0; j < k; j++)
+        {
+            padic_poly_randtest_val(c, state, n_randint(state, N), n_randint(state, 10), ctx);
+
+            padic_poly_mul(a, a, b, ctx);
+            padic_poly_add(a, a, c, ctx);
+
+            padic_poly_mul_lazy(t, t, b, ctx);
+            padic_poly_add_lazy(t, t, c, ctx);
+        }
+        padic_poly_reduce(t, ctx);
+
+        result = (padic_poly_equal(a, t) && padic_poly_is_reduced(t, ctx));
+        if (!result)
+        {
+            flint_printf("FAIL (Horner):\n");
+            flint_printf("b = "), padic_poly_print(b, ctx), flint_printf("\n\n");
+            flint_printf("a = "), padic_poly_print(a, ctx), flint_printf("\n\n");
+            flint_printf("t = "), padic_poly_print(t, ctx), flint_printf("\n\n");
+            abort();
+        }
+
+        padic_poly_clear(a);
+        padic_poly_clear(b);
+        padic_poly_clear(c);
+        padic_poly_clear(t);
+
+        padic_ctx_clear(ctx);
+        fmpz_clear(p);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -87,6 +87,19 @@ FLINT_DLL void qadic_ctx_init_conway(qadic_ctx_t ctx,
                            const fmpz_t p, slong d, slong min, slong max, 
                            const char *var, enum padic_print_mode mode);
 
+FLINT_DLL void qadic_ctx_init(qadic_ctx_t ctx, 
+                           const fmpz_t p, slong d, slong min, slong max, 
+                           const char *var, enum padic_print_mode mode);
+
+#define QADIC_CTX_CACHE_MAX 64
+
+FLINT_DLL int _qadic_ctx_init_cached(qadic_ctx_t ctx, const fmpz_t p,
+                                     slong d, int conway_only);
+
+FLINT_DLL void qadic_ctx_cache_clear(void);
+
+FLINT_DLL const int * _qadic_conway_lookup(const fmpz_t p, slong d);
+
 FLINT_DLL void qadic_ctx_clear(qadic_ctx_t ctx);
 
 QADIC_INLINE slong qadic_ctx_degree(const qadic_ctx_t ctx)
@@ -424,12 +437,57 @@ FLINT_DLL void _qadic_frobenius(fmpz *rop, const fmpz *op, slong len, slong e,
 
 FLINT_DLL void qadic_frobenius(qadic_t rop, const qadic_t op, slong e, const qadic_ctx_t ctx);
 
+FLINT_DLL void _fmpz_mod_poly_compose_smod(fmpz *rop, 
+                  const fmpz *op1, slong len1, const fmpz *op2, slong len2, 
+                  const fmpz *a, const slong *j, slong lena, const fmpz_t p);
+
+/* Frobenius maps ************************************************************/
+
+typedef struct
+{
+    slong e;
+    slong N;
+    slong B;
+    fmpz_t pN;
+    fmpz *x;
+    fmpz *inv;
+    fmpz *pows;
+}
+qadic_frobenius_map_struct;
+
+typedef qadic_frobenius_map_struct qadic_frobenius_map_t[1];
+
+FLINT_DLL void qadic_frobenius_map_init(qadic_frobenius_map_t map, slong e, 
+                                        slong N, const qadic_ctx_t ctx);
+
+FLINT_DLL void qadic_frobenius_map_clear(qadic_frobenius_map_t map, 
+                                         const qadic_ctx_t ctx);
+
+FLINT_DLL void qadic_frobenius_map_fit_prec(qadic_frobenius_map_t map, 
+                                            slong N, const qadic_ctx_t ctx);
+
+QADIC_INLINE slong 
+qadic_frobenius_map_prec(const qadic_frobenius_map_t map)
+{
+    return map->N;
+}
+
+FLINT_DLL void _qadic_frobenius_map_apply(fmpz *rop, const fmpz *op, slong len, 
+                  const qadic_frobenius_map_t map, 
+                  const fmpz *a, const slong *j, slong lena, const fmpz_t pN);
+
+FLINT_DLL void qadic_frobenius_map_apply(qadic_t rop, const qadic_t op, 
+                  qadic_frobenius_map_t map, const qadic_ctx_t ctx);
+
 FLINT_DLL void _qadic_teichmuller(fmpz *rop, const fmpz *op, slong len, 
                         const fmpz *a, const slong *j, slong lena, 
                         const fmpz_t p, slong N);
 
 FLINT_DLL void qadic_teichmuller(qadic_t rop, const qadic_t op, const qadic_ctx_t ctx);
 
+FLINT_DLL void qadic_teichmuller_vec(qadic_struct *rop, const qadic_struct *op, 
+                                     slong n, const qadic_ctx_t ctx);
+
 FLINT_DLL void _qadic_trace(fmpz_t rop, const fmpz *op, slong len, 
                   const fmpz *a, const slong *j, slong lena, const fmpz_t pN);
 
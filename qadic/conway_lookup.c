@@ -0,0 +1,139 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "qadic.h"
+
+/* from qadic/ctx_init_conway.c */
+extern int flint_conway_polynomials [];
+
+/*
+    Positions of the entries of flint_conway_polynomials sorted by (p, d),
+    built on first use and shared by all threads, so only freed by
+    flint_cleanup_master().
+*/
+static unsigned int * _qadic_conway_index = NULL;
+static slong _qadic_conway_index_len = 0;
+static pthread_mutex_t _qadic_conway_index_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static int
+_qadic_conway_cmp(const void * a, const void * b)
+{
+    const int * x = flint_conway_polynomials + *((const unsigned int *) a);
+    const int * y = flint_conway_polynomials + *((const unsigned int *) b);
+
+    if (x[0] != y[0])
+        return (x[0] < y[0]) ? -1 : 1;
+    if (x[1] != y[1])
+        return (x[1] < y[1]) ? -1 : 1;
+    return 0;
+}
+
+static void
+_qadic_conway_index_clear(void)
+{
+    pthread_mutex_lock(&_qadic_conway_index_lock);
+    flint_free(_qadic_conway_index);
+    _qadic_conway_index = NULL;
+    _qadic_conway_index_len = 0;
+    pthread_mutex_unlock(&_qadic_conway_index_lock);
+}
+
+/* Assumes the lock is held */
+static void
+_qadic_conway_index_init(void)
+{
+    unsigned int position;
+    slong n;
+
+    n = 0;
+    for (position = 0; flint_conway_polynomials[position] != 0;
+         position += 3 + flint_conway_polynomials[position + 1])
+        n++;
+
+    _qadic_conway_index = flint_malloc(n * sizeof(unsigned int));
+
+    n = 0;
+    for (position = 0; flint_conway_polynomials[position] != 0;
+         position += 3 + flint_conway_polynomials[position + 1])
+        _qadic_conway_index[n++] = position;
+
+    qsort(_qadic_conway_index, n, sizeof(unsigned int), _qadic_conway_cmp);
+
+    _qadic_conway_index_len = n;
+}
+
+const int *
+_qadic_conway_lookup(const fmpz_t p, slong d)
+{
+    const int * res = NULL;
+    slong lo, hi, mid;
+    ulong up;
+    int built = 0;
+
+    if (fmpz_sgn(p) <= 0 || fmpz_cmp_ui(p, 109987) > 0 || d < 1)
+        return NULL;
+
+    pthread_mutex_lock(&_qadic_conway_index_lock);
+
+    if (_qadic_conway_index == NULL)
+    {
+        _qadic_conway_index_init();
+        built = 1;
+    }
+
+    up = fmpz_get_ui(p);
+    lo = 0;
+    hi = _qadic_conway_index_len;
+
+    while (lo < hi)
+    {
+        const int * e;
+
+        mid = lo + (hi - lo) / 2;
+        e = flint_conway_polynomials + _qadic_conway_index[mid];
+
+        if ((ulong) e[0] < up || ((ulong) e[0] == up && e[1] < d))
+            lo = mid + 1;
+        else if ((ulong) e[0] == up && e[1] == d)
+        {
+            res = e + 2;
+            break;
+        }
+        else
+            hi = mid;
+    }
+
+    pthread_mutex_unlock(&_qadic_conway_index_lock);
+
+    /* outside the lock, as flint_cleanup_master() calls back into this
+       file while holding its own lock */
+    if (built)
+        flint_register_master_cleanup_function(_qadic_conway_index_clear);
+
+    return res;
+}
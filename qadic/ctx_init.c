@@ -0,0 +1,222 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <string.h>
+#include <pthread.h>
+
+#include "fmpz_mod_poly.h"
+#include "qadic.h"
+
+/*
+    Process-wide cache of the sparse moduli used by qadic contexts, keyed
+    by (p, d), holding at most QADIC_CTX_CACHE_MAX entries. It is freed by
+    qadic_ctx_cache_clear() or flint_cleanup_master(), but not by the
+    flint_cleanup() of a thread, as other threads may still use it.
+*/
+typedef struct qadic_ctx_cache_entry_struct
+{
+    fmpz_t p;
+    slong d;
+    int conway;
+    fmpz * a;
+    slong * j;
+    slong len;
+    struct qadic_ctx_cache_entry_struct * next;
+} qadic_ctx_cache_entry_struct;
+
+static qadic_ctx_cache_entry_struct * _qadic_ctx_cache = NULL;
+static slong _qadic_ctx_cache_num = 0;
+
+static pthread_mutex_t _qadic_ctx_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void
+_qadic_ctx_cache_entry_clear(qadic_ctx_cache_entry_struct * e)
+{
+    fmpz_clear(e->p);
+    _fmpz_vec_clear(e->a, e->len);
+    flint_free(e->j);
+    flint_free(e);
+}
+
+/* Conway polynomial if known, otherwise a sparse irreducible modulus */
+static qadic_ctx_cache_entry_struct *
+_qadic_ctx_cache_entry_init(const fmpz_t p, slong d)
+{
+    qadic_ctx_cache_entry_struct * e;
+    const int * coeffs;
+    fmpz_mod_poly_t f;
+    slong i, k;
+
+    fmpz_mod_poly_init2(f, p, d + 1);
+
+    coeffs = _qadic_conway_lookup(p, d);
+
+    if (coeffs != NULL)
+    {
+        for (i = 0; i < d; i++)
+            fmpz_mod_poly_set_coeff_ui(f, i, coeffs[i]);
+        fmpz_mod_poly_set_coeff_ui(f, d, 1);
+    }
+    else
+    {
+        flint_rand_t state;
+
+        flint_randinit(state);
+        fmpz_mod_poly_randtest_sparse_irreducible(f, state, d + 1);
+        fmpz_mod_poly_make_monic(f, f);
+        flint_randclear(state);
+    }
+
+    e = flint_malloc(sizeof(qadic_ctx_cache_entry_struct));
+    fmpz_init_set(e->p, p);
+    e->d = d;
+    e->conway = (coeffs != NULL);
+    e->next = NULL;
+
+    e->len = 0;
+    for (i = 0; i <= d; i++)
+        if (!fmpz_is_zero(f->coeffs + i))
+            e->len++;
+
+    e->a = _fmpz_vec_init(e->len);
+    e->j = flint_malloc(e->len * sizeof(slong));
+
+    for (i = 0, k = 0; i <= d; i++)
+    {
+        if (!fmpz_is_zero(f->coeffs + i))
+        {
+            fmpz_set(e->a + k, f->coeffs + i);
+            e->j[k] = i;
+            k++;
+        }
+    }
+
+    fmpz_mod_poly_clear(f);
+
+    return e;
+}
+
+static qadic_ctx_cache_entry_struct *
+_qadic_ctx_cache_find(const fmpz_t p, slong d)
+{
+    qadic_ctx_cache_entry_struct * e;
+
+    for (e = _qadic_ctx_cache; e != NULL; e = e->next)
+        if (e->d == d && fmpz_equal(e->p, p))
+            return e;
+
+    return NULL;
+}
+
+int
+_qadic_ctx_init_cached(qadic_ctx_t ctx, const fmpz_t p, slong d,
+                       int conway_only)
+{
+    qadic_ctx_cache_entry_struct * e, * f = NULL;
+    int result, inserted = 0;
+
+    pthread_mutex_lock(&_qadic_ctx_cache_lock);
+    e = _qadic_ctx_cache_find(p, d);
+
+    if (e == NULL)
+    {
+        pthread_mutex_unlock(&_qadic_ctx_cache_lock);
+
+        if (conway_only && _qadic_conway_lookup(p, d) == NULL)
+            return 0;
+
+        f = _qadic_ctx_cache_entry_init(p, d);
+
+        /* another thread may have inserted the same entry meanwhile */
+        pthread_mutex_lock(&_qadic_ctx_cache_lock);
+        e = _qadic_ctx_cache_find(p, d);
+        if (e == NULL)
+        {
+            e = f;
+
+            if (_qadic_ctx_cache_num < QADIC_CTX_CACHE_MAX)
+            {
+                f->next = _qadic_ctx_cache;
+                _qadic_ctx_cache = f;
+                _qadic_ctx_cache_num++;
+                f = NULL;
+                inserted = 1;
+            }
+        }
+    }
+
+    result = !conway_only || e->conway;
+
+    if (result)
+    {
+        ctx->len = e->len;
+        ctx->a = _fmpz_vec_init(ctx->len);
+        _fmpz_vec_set(ctx->a, e->a, ctx->len);
+        ctx->j = flint_malloc(ctx->len * sizeof(slong));
+        memcpy(ctx->j, e->j, ctx->len * sizeof(slong));
+    }
+
+    pthread_mutex_unlock(&_qadic_ctx_cache_lock);
+
+    /* outside the lock, as flint_cleanup_master() calls back into this
+       file while holding its own lock */
+    if (inserted)
+        flint_register_master_cleanup_function(qadic_ctx_cache_clear);
+
+    if (f != NULL)
+        _qadic_ctx_cache_entry_clear(f);
+
+    return result;
+}
+
+void
+qadic_ctx_cache_clear(void)
+{
+    qadic_ctx_cache_entry_struct * e, * next;
+
+    pthread_mutex_lock(&_qadic_ctx_cache_lock);
+    e = _qadic_ctx_cache;
+    _qadic_ctx_cache = NULL;
+    _qadic_ctx_cache_num = 0;
+    pthread_mutex_unlock(&_qadic_ctx_cache_lock);
+
+    for ( ; e != NULL; e = next)
+    {
+        next = e->next;
+        _qadic_ctx_cache_entry_clear(e);
+    }
+}
+
+void
+qadic_ctx_init(qadic_ctx_t ctx, const fmpz_t p, slong d, slong min, slong max,
+               const char *var, enum padic_print_mode mode)
+{
+    _qadic_ctx_init_cached(ctx, p, d, 0);
+
+    padic_ctx_init(&ctx->pctx, p, min, max, mode);
+
+    ctx->var = flint_malloc(strlen(var) + 1);
+    strcpy(ctx->var, var);
+}
@@ -0,0 +1,132 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include "fmpz_mod_poly.h"
+#include "qadic.h"
+
+/*
+    Evaluates (op, len) at the image of X by rectangular splitting 
+    over the baby-step table stored in the map, so that no powers of 
+    the image have to be recomputed per call.
+ */
+
+void _qadic_frobenius_map_apply(fmpz *rop, const fmpz *op, slong len, 
+                  const qadic_frobenius_map_t map, 
+                  const fmpz *a, const slong *j, slong lena, const fmpz_t pN)
+{
+    const slong d = j[lena - 1];
+    const slong B = map->B;
+    const fmpz *pows = map->pows;
+
+    if (len == 1)
+    {
+        fmpz_mod(rop, op, pN);
+        _fmpz_vec_zero(rop + 1, d - 1);
+    }
+    else
+    {
+        slong i, k;
+        fmpz *t;
+
+        t = _fmpz_vec_init(2 * d - 1);
+
+        _fmpz_vec_zero(rop, d);
+
+        for (i = (len + B - 1) / B - 1; i >= 0; i--)
+        {
+            if (i < (len + B - 1) / B - 1)
+            {
+                _fmpz_poly_mul(t, rop, d, pows + B * d, d);
+                _fmpz_poly_reduce(t, 2 * d - 1, a, j, lena);
+                _fmpz_vec_swap(rop, t, d);
+            }
+
+            fmpz_add(rop + 0, rop + 0, op + i*B);
+            for (k = FLINT_MIN(B, len - i*B) - 1; k > 0; k--)
+            {
+                _fmpz_vec_scalar_addmul_fmpz(rop, pows + k * d, d, op + (i*B + k));
+            }
+
+            _fmpz_vec_scalar_mod_fmpz(rop, rop, d, pN);
+        }
+
+        _fmpz_vec_clear(t, 2 * d - 1);
+    }
+}
+
+void qadic_frobenius_map_apply(qadic_t rop, const qadic_t op, 
+                  qadic_frobenius_map_t map, const qadic_ctx_t ctx)
+{
+    const slong N = qadic_prec(rop);
+    const slong d = qadic_ctx_degree(ctx);
+
+    if (qadic_is_zero(op) || op->val >= N)
+    {
+        qadic_zero(rop);
+    }
+    else if (map->e == 0)
+    {
+        padic_poly_set(rop, op, &ctx->pctx);
+    }
+    else
+    {
+        fmpz *t;
+        fmpz_t pow;
+        int alloc;
+
+        qadic_frobenius_map_fit_prec(map, N - op->val, ctx);
+
+        alloc = _padic_ctx_pow_ui(pow, N - op->val, &ctx->pctx);
+
+        if (rop == op)
+        {
+            t = _fmpz_vec_init(d);
+        }
+        else
+        {
+            padic_poly_fit_length(rop, d);
+            t = rop->coeffs;
+        }
+
+        _qadic_frobenius_map_apply(t, op->coeffs, op->length, map, 
+                                   ctx->a, ctx->j, ctx->len, pow);
+
+        if (rop == op)
+        {
+            _fmpz_vec_clear(rop->coeffs, rop->alloc);
+            rop->coeffs = t;
+            rop->alloc  = d;
+        }
+        else
+        {
+            rop->val = op->val;
+        }
+        _padic_poly_set_length(rop, d);
+        _padic_poly_normalise(rop);
+
+        if (alloc)
+            fmpz_clear(pow);
+    }
+}
@@ -0,0 +1,40 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include "qadic.h"
+
+void qadic_frobenius_map_clear(qadic_frobenius_map_t map, 
+                               const qadic_ctx_t ctx)
+{
+    const slong d = qadic_ctx_degree(ctx);
+
+    if (map->e != 0)
+    {
+        _fmpz_vec_clear(map->x, d);
+        _fmpz_vec_clear(map->inv, d);
+        _fmpz_vec_clear(map->pows, (map->B + 1) * d);
+    }
+    fmpz_clear(map->pN);
+}
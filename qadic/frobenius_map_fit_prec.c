@@ -0,0 +1,125 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include "fmpz_mod_poly.h"
+#include "qadic.h"
+
+/*
+    The image $x = \Sigma^e(X)$ is the root of $f$ congruent to $X^{p^e}$ 
+    modulo~$p$.  We store $x$ and $1/f'(x)$ modulo the current $p^N$, so 
+    that raising the precision only runs the remaining Newton steps 
+    $x \mapsto x - f(x)/f'(x)$, each of which doubles the precision.
+ */
+
+void qadic_frobenius_map_fit_prec(qadic_frobenius_map_t map, 
+                                  slong N, const qadic_ctx_t ctx)
+{
+    const slong d = qadic_ctx_degree(ctx);
+    const fmpz *a = ctx->a;
+    const slong *j = ctx->j;
+    const slong lena = ctx->len;
+    const fmpz *p = (&ctx->pctx)->p;
+
+    slong i, k;
+    fmpz *f1, *f2, *s, *t;
+    fmpz_t pk;
+
+    if (N <= map->N)
+        return;
+
+    if (map->e == 0)
+    {
+        map->N = N;
+        fmpz_pow_ui(map->pN, p, N);
+        return;
+    }
+
+    f1 = _fmpz_vec_init(d + 1);
+    f2 = _fmpz_vec_init(d);
+    s  = _fmpz_vec_init(2 * d - 1);
+    t  = _fmpz_vec_init(2 * d - 1);
+    fmpz_init(pk);
+
+    /* Dense representation of f and f' */
+    for (i = 0; i < lena; i++)
+        fmpz_set(f1 + j[i], a + i);
+    for (i = 1; i < lena; i++)
+        fmpz_mul_ui(f2 + (j[i] - 1), a + i, j[i]);
+
+    if (map->N == 0)
+    {
+        fmpz op[2] = {WORD(0), WORD(1)};
+
+        fmpz_pow_ui(t, p, map->e);
+        _qadic_pow(s, op, 2, t, a, j, lena, p);
+        _fmpz_vec_set(map->x, s, d);
+        _fmpz_mod_poly_compose_smod(t, f2, d, map->x, d, a, j, lena, p);
+        _qadic_inv(map->inv, t, d, a, j, lena, p, 1);
+        map->N = 1;
+    }
+
+    for (k = map->N; k < N; )
+    {
+        k = FLINT_MIN(2 * k, N);
+        fmpz_pow_ui(pk, p, k);
+
+        /* x := x - f(x) / f'(x) */
+        _fmpz_mod_poly_compose_smod(s, f1, d + 1, map->x, d, a, j, lena, pk);
+        _fmpz_mod_poly_mul(t, s, d, map->inv, d, pk);
+        _fmpz_mod_poly_reduce(t, 2 * d - 1, a, j, lena, pk);
+        _fmpz_mod_poly_sub(map->x, map->x, d, t, d, pk);
+
+        /* inv := inv (2 - f'(x) inv) */
+        _fmpz_mod_poly_compose_smod(s, f2, d, map->x, d, a, j, lena, pk);
+        _fmpz_mod_poly_mul(t, map->inv, d, s, d, pk);
+        _fmpz_mod_poly_reduce(t, 2 * d - 1, a, j, lena, pk);
+        _fmpz_mod_poly_neg(t, t, d, pk);
+        fmpz_add_ui(t, t, 2);
+        fmpz_mod(t, t, pk);
+        _fmpz_mod_poly_mul(s, map->inv, d, t, d, pk);
+        _fmpz_mod_poly_reduce(s, 2 * d - 1, a, j, lena, pk);
+        _fmpz_vec_set(map->inv, s, d);
+    }
+
+    map->N = N;
+    fmpz_pow_ui(map->pN, p, N);
+
+    /* Baby steps x^0, ..., x^B modulo p^N */
+    fmpz_one(map->pows + 0);
+    _fmpz_vec_zero(map->pows + 1, d - 1);
+    _fmpz_vec_set(map->pows + d, map->x, d);
+    for (i = 2; i <= map->B; i++)
+    {
+        _fmpz_poly_mul(t, map->pows + (i - 1) * d, d, map->x, d);
+        _fmpz_mod_poly_reduce(t, 2 * d - 1, a, j, lena, map->pN);
+        _fmpz_vec_set(map->pows + i * d, t, d);
+    }
+
+    _fmpz_vec_clear(f1, d + 1);
+    _fmpz_vec_clear(f2, d);
+    _fmpz_vec_clear(s, 2 * d - 1);
+    _fmpz_vec_clear(t, 2 * d - 1);
+    fmpz_clear(pk);
+}
@@ -0,0 +1,58 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include "qadic.h"
+
+void qadic_frobenius_map_init(qadic_frobenius_map_t map, slong e, 
+                              slong N, const qadic_ctx_t ctx)
+{
+    const slong d = qadic_ctx_degree(ctx);
+
+    e = e % d;
+    if (e < 0)
+        e += d;
+
+    map->e = e;
+    map->N = 0;
+    map->B = n_sqrt(d);
+    if (map->B * map->B < d)
+        map->B++;
+    fmpz_init(map->pN);
+
+    if (e == 0)
+    {
+        map->x    = NULL;
+        map->inv  = NULL;
+        map->pows = NULL;
+    }
+    else
+    {
+        map->x    = _fmpz_vec_init(d);
+        map->inv  = _fmpz_vec_init(d);
+        map->pows = _fmpz_vec_init((map->B + 1) * d);
+    }
+
+    qadic_frobenius_map_fit_prec(map, FLINT_MAX(N, 1), ctx);
+}
@@ -0,0 +1,171 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include "fmpz_mod_poly.h"
+#include "qadic.h"
+
+/*
+    Runs the Newton iteration of _qadic_teichmuller() on all elements 
+    at once, level by level, so that the precision chain, the powers 
+    of~$p$ and the lifted inverse of $q - 1$ are computed only once 
+    for the whole batch.
+ */
+
+void qadic_teichmuller_vec(qadic_struct *rop, const qadic_struct *op, 
+                           slong n, const qadic_ctx_t ctx)
+{
+    const slong d = qadic_ctx_degree(ctx);
+    const fmpz *p = (&ctx->pctx)->p;
+
+    slong N, i, k, m, *e;
+    fmpz *pow, *u, *t;
+    fmpz_t inv, q;
+    char *live;
+
+    for (k = 0; k < n; k++)
+    {
+        if (op[k].val < 0)
+        {
+            flint_printf("Exception (qadic_teichmuller_vec).  val(op) is negative.\n");
+            abort();
+        }
+    }
+
+    if (d == 1)
+    {
+        for (k = 0; k < n; k++)
+            qadic_teichmuller(rop + k, op + k, ctx);
+        return;
+    }
+
+    N = 0;
+    for (k = 0; k < n; k++)
+        N = FLINT_MAX(N, qadic_prec(rop + k));
+
+    if (N <= 0)
+    {
+        for (k = 0; k < n; k++)
+            qadic_zero(rop + k);
+        return;
+    }
+
+    m = FLINT_CLOG2(N) + 1;
+
+    e = flint_malloc(m * sizeof(slong));
+    for (e[i = 0] = N; e[i] > 1; i++)
+        e[i + 1] = (e[i] + 1) / 2;
+    m = i + 1;
+
+    pow  = _fmpz_vec_init(2 * m);
+    u    = pow + m;
+    t    = _fmpz_vec_init(2 * d - 1);
+    live = flint_malloc(n);
+    fmpz_init(inv);
+    fmpz_init(q);
+
+    /* Compute powers of p and reduced units for (q-1) */
+    fmpz_set(pow + (m - 1), p);
+    for (i = m - 2; i >= 0; i--)
+    {
+        fmpz_mul(pow + i, pow + (i + 1), pow + (i + 1));
+        if (e[i] & WORD(1))
+            fmpz_divexact(pow + i, pow + i, p);
+    }
+
+    fmpz_pow_ui(q, p, d);
+    fmpz_sub_ui(u + 0, q, 1);
+    fmpz_mod(u + 0, u + 0, pow + 0);
+    for (i = 1; i < m; i++)
+        fmpz_mod(u + i, u + (i - 1), pow + i);
+
+    /* Starting values modulo p */
+    for (k = 0; k < n; k++)
+    {
+        live[k] = !(qadic_is_zero(op + k) || op[k].val > 0 
+                    || qadic_prec(rop + k) <= 0);
+
+        if (live[k])
+        {
+            const slong len = op[k].length;
+
+            padic_poly_fit_length(rop + k, d);
+            _fmpz_vec_scalar_mod_fmpz(rop[k].coeffs, op[k].coeffs, len, p);
+            _fmpz_vec_zero(rop[k].coeffs + len, d - len);
+            rop[k].val = 0;
+        }
+        else
+        {
+            qadic_zero(rop + k);
+        }
+    }
+
+    /* Run Newton iteration */
+    fmpz_sub_ui(inv, p, 1);
+    for (i = m - 2; i >= 0; i--)
+    {
+        for (k = 0; k < n; k++)
+        {
+            fmpz *z = rop[k].coeffs;
+
+            if (!live[k])
+                continue;
+
+            _qadic_pow(t, z, d, q, ctx->a, ctx->j, ctx->len, pow + i);
+            _fmpz_poly_sub(t, t, d, z, d);
+            _fmpz_vec_scalar_submul_fmpz(z, t, d, inv);
+            _fmpz_vec_scalar_mod_fmpz(z, z, d, pow + i);
+        }
+
+        if (i > 0)
+        {
+            fmpz_mul(t, inv, inv);
+            fmpz_mul(t + 1, u + i, t);
+            fmpz_mul_2exp(inv, inv, 1);
+            fmpz_sub(inv, inv, t + 1);
+            fmpz_mod(inv, inv, pow + i);
+        }
+    }
+
+    /* Reduce to the precision of each output */
+    for (k = 0; k < n; k++)
+    {
+        if (!live[k])
+            continue;
+
+        _padic_poly_set_length(rop + k, d);
+        if (qadic_prec(rop + k) < N)
+            qadic_reduce(rop + k, ctx);
+        else
+            _padic_poly_normalise(rop + k);
+    }
+
+    _fmpz_vec_clear(pow, 2 * m);
+    _fmpz_vec_clear(t, 2 * d - 1);
+    flint_free(live);
+    flint_free(e);
+    fmpz_clear(inv);
+    fmpz_clear(q);
+}
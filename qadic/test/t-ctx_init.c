@@ -0,0 +1,144 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fmpz_mod_poly.h"
+#include "qadic.h"
+#include "ulong_extras.h"
+#include "long_extras.h"
+
+/* from qadic/ctx_init_conway.c */
+extern int flint_conway_polynomials [];
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("ctx_init... ");
+    fflush(stdout);
+
+    /* Check the index agrees with a linear scan of the database */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p;
+        slong d;
+        const int * c1, * c2 = NULL;
+        unsigned int position;
+
+        fmpz_init_set_ui(p, n_randprime(state, 2 + n_randint(state, 17), 1));
+        d = n_randint(state, 30) + 1;
+
+        c1 = _qadic_conway_lookup(p, d);
+
+        for (position = 0; flint_conway_polynomials[position] != 0;
+             position += 3 + flint_conway_polynomials[position + 1])
+        {
+            if (!fmpz_cmp_ui(p, flint_conway_polynomials[position])
+                && d == flint_conway_polynomials[position + 1])
+            {
+                c2 = flint_conway_polynomials + position + 2;
+                break;
+            }
+        }
+
+        result = (c1 == c2);
+        if (!result)
+        {
+            flint_printf("FAIL (lookup):\n\n");
+            flint_printf("p = "), fmpz_print(p), flint_printf("\n");
+            flint_printf("d = %wd\n", d);
+            abort();
+        }
+
+        fmpz_clear(p);
+    }
+
+    /* Check qadic_ctx_init agrees with the database, falls back otherwise */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p;
+        slong d, k;
+        qadic_ctx_t ctx1, ctx2;
+        fmpz_mod_poly_t f;
+
+        if (n_randint(state, 4) == 0)
+            fmpz_init_set_ui(p, n_nextprime(UWORD(109987) + n_randint(state, 1000), 1));
+        else
+            fmpz_init_set_ui(p, n_randprime(state, 2 + n_randint(state, 5), 1));
+        d = n_randint(state, 12) + 1;
+
+        qadic_ctx_init(ctx1, p, d, 0, 20, "a", PADIC_SERIES);
+
+        if (_qadic_conway_lookup(p, d) != NULL)
+            qadic_ctx_init_conway(ctx2, p, d, 0, 20, "b", PADIC_TERSE);
+        else
+            qadic_ctx_init(ctx2, p, d, 0, 20, "b", PADIC_TERSE);
+
+        result = (qadic_ctx_degree(ctx1) == d && ctx1->len == ctx2->len
+                  && fmpz_is_one(ctx1->a + ctx1->len - 1));
+        for (k = 0; result && k < ctx1->len; k++)
+            result = (fmpz_equal(ctx1->a + k, ctx2->a + k)
+                      && ctx1->j[k] == ctx2->j[k]);
+
+        /* the modulus must be irreducible mod p */
+        if (result)
+        {
+            fmpz_mod_poly_init(f, p);
+            for (k = 0; k < ctx1->len; k++)
+                fmpz_mod_poly_set_coeff_fmpz(f, ctx1->j[k], ctx1->a + k);
+            result = fmpz_mod_poly_is_irreducible(f);
+            fmpz_mod_poly_clear(f);
+        }
+
+        if (!result)
+        {
+            flint_printf("FAIL (ctx_init):\n\n");
+            qadic_ctx_print(ctx1), flint_printf("\n");
+            qadic_ctx_print(ctx2), flint_printf("\n");
+            abort();
+        }
+
+        qadic_ctx_clear(ctx1);
+        qadic_ctx_clear(ctx2);
+        fmpz_clear(p);
+
+        if (n_randint(state, 50) == 0)
+            qadic_ctx_cache_clear();
+        else if (n_randint(state, 50) == 0)
+            flint_cleanup();
+        else if (n_randint(state, 50) == 0)
+            flint_cleanup_master();
+    }
+
+    /* the cache is freed by flint_cleanup_master() */
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
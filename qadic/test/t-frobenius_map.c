@@ -0,0 +1,146 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "qadic.h"
+#include "ulong_extras.h"
+#include "long_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("frobenius_map... ");
+    fflush(stdout);
+
+    /* Check against qadic_frobenius, raising the precision of the map */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p;
+        slong d, N, e, k;
+        qadic_ctx_t ctx;
+        qadic_frobenius_map_t map;
+
+        qadic_t a, b, c;
+
+        fmpz_init_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        N = n_randint(state, 50) + 1;
+        qadic_ctx_init_conway(ctx, p, d, FLINT_MAX(0, N-10), FLINT_MAX(0, N+10), "a", PADIC_SERIES);
+
+        e = z_randint(state, 20);
+        qadic_frobenius_map_init(map, e, n_randint(state, 10), ctx);
+
+        for (k = 0; k < 5; k++)
+        {
+            slong M = n_randint(state, N) + 1;
+
+            qadic_init2(a, M);
+            qadic_init2(b, M);
+            qadic_init2(c, M);
+
+            qadic_randtest(a, state, ctx);
+
+            qadic_frobenius_map_apply(b, a, map, ctx);
+            qadic_frobenius(c, a, e, ctx);
+
+            result = (qadic_equal(b, c) && qadic_frobenius_map_prec(map) >= 1);
+            if (!result)
+            {
+                flint_printf("FAIL:\n\n");
+                flint_printf("a = "), qadic_print_pretty(a, ctx), flint_printf("\n");
+                flint_printf("b = "), qadic_print_pretty(b, ctx), flint_printf("\n");
+                flint_printf("c = "), qadic_print_pretty(c, ctx), flint_printf("\n");
+                flint_printf("e = %wd, M = %wd\n", e, M);
+                abort();
+            }
+
+            qadic_clear(a);
+            qadic_clear(b);
+            qadic_clear(c);
+        }
+
+        qadic_frobenius_map_clear(map, ctx);
+        fmpz_clear(p);
+        qadic_ctx_clear(ctx);
+    }
+
+    /* Check aliasing */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p;
+        slong d, N, e;
+        qadic_ctx_t ctx;
+        qadic_frobenius_map_t map;
+
+        qadic_t a, b, c;
+
+        fmpz_init_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        N = z_randint(state, 50) + 1;
+        qadic_ctx_init_conway(ctx, p, d, FLINT_MAX(0, N-10), FLINT_MAX(0, N+10), "a", PADIC_SERIES);
+
+        e = n_randint(state, 10);
+        qadic_frobenius_map_init(map, e, N, ctx);
+
+        qadic_init2(a, N);
+        qadic_init2(b, N);
+        qadic_init2(c, N);
+
+        qadic_randtest(a, state, ctx);
+        qadic_set(b, a, ctx);
+
+        qadic_frobenius_map_apply(c, b, map, ctx);
+        qadic_frobenius_map_apply(b, b, map, ctx);
+
+        result = (qadic_equal(b, c));
+        if (!result)
+        {
+            flint_printf("FAIL (alias):\n\n");
+            flint_printf("a = "), qadic_print_pretty(a, ctx), flint_printf("\n");
+            flint_printf("b = "), qadic_print_pretty(b, ctx), flint_printf("\n");
+            flint_printf("c = "), qadic_print_pretty(c, ctx), flint_printf("\n");
+            flint_printf("e = %wd\n", e);
+            abort();
+        }
+
+        qadic_clear(a);
+        qadic_clear(b);
+        qadic_clear(c);
+
+        qadic_frobenius_map_clear(map, ctx);
+        fmpz_clear(p);
+        qadic_ctx_clear(ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,111 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "qadic.h"
+#include "ulong_extras.h"
+#include "long_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("teichmuller_vec... ");
+    fflush(stdout);
+
+    /* Check against qadic_teichmuller, with aliasing */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p;
+        slong d, N, n, k;
+        qadic_ctx_t ctx;
+
+        qadic_struct *a, *b, *c;
+
+        fmpz_init_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        N = n_randint(state, 50) + 1;
+        n = n_randint(state, 8);
+        qadic_ctx_init_conway(ctx, p, d, FLINT_MAX(0, N-10), FLINT_MAX(0, N+10), "a", PADIC_SERIES);
+
+        a = flint_malloc(n * sizeof(qadic_struct));
+        b = flint_malloc(n * sizeof(qadic_struct));
+        c = flint_malloc(n * sizeof(qadic_struct));
+
+        for (k = 0; k < n; k++)
+        {
+            slong M = z_randint(state, N) + 1;
+
+            qadic_init2(a + k, N);
+            qadic_init2(b + k, M);
+            qadic_init2(c + k, M);
+
+            qadic_randtest_int(a + k, state, ctx);
+            qadic_teichmuller(c + k, a + k, ctx);
+            qadic_set(b + k, a + k, ctx);
+        }
+
+        if (n_randint(state, 2))
+            qadic_teichmuller_vec(b, b, n, ctx);
+        else
+            qadic_teichmuller_vec(b, a, n, ctx);
+
+        for (k = 0; k < n; k++)
+        {
+            result = (qadic_equal(b + k, c + k));
+            if (!result)
+            {
+                flint_printf("FAIL:\n\n");
+                flint_printf("a = "), qadic_print_pretty(a + k, ctx), flint_printf("\n");
+                flint_printf("b = "), qadic_print_pretty(b + k, ctx), flint_printf("\n");
+                flint_printf("c = "), qadic_print_pretty(c + k, ctx), flint_printf("\n");
+                flint_printf("k = %wd\n", k);
+                abort();
+            }
+        }
+
+        for (k = 0; k < n; k++)
+        {
+            qadic_clear(a + k);
+            qadic_clear(b + k);
+            qadic_clear(c + k);
+        }
+        flint_free(a);
+        flint_free(b);
+        flint_free(c);
+
+        fmpz_clear(p);
+        qadic_ctx_clear(ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
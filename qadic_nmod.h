@@ -0,0 +1,322 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#ifndef QADIC_NMOD_H
+#define QADIC_NMOD_H
+
+#ifdef QADIC_NMOD_INLINES_C
+#define QADIC_NMOD_INLINE FLINT_DLL
+#else
+#define QADIC_NMOD_INLINE static __inline__
+#endif
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdlib.h>
+#include <stdio.h>
+#undef ulong
+
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "padic_nmod.h"
+#include "qadic.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*
+    Elements of Z_q / p^N Z_q, where Z_q is the ring of integers of the 
+    unramified extension of Q_p of degree d, stored as polynomials of 
+    length at most d with coefficients in [0, p^N).
+ */
+
+typedef nmod_poly_t qadic_nmod_t;
+typedef nmod_poly_struct qadic_nmod_struct;
+
+/* Context *******************************************************************/
+
+typedef struct
+{
+    padic_nmod_ctx_struct pctx;
+
+    int sparse_modulus;
+
+    mp_limb_t *a;
+    slong *j;
+    slong len;
+
+    nmod_poly_t modulus;
+    nmod_poly_t inv;
+
+    char *var;
+}
+qadic_nmod_ctx_struct;
+
+typedef qadic_nmod_ctx_struct qadic_nmod_ctx_t[1];
+
+FLINT_DLL void qadic_nmod_ctx_init(qadic_nmod_ctx_t ctx, mp_limb_t p, slong d, 
+                                   slong N, const char *var);
+
+FLINT_DLL void qadic_nmod_ctx_init_qadic(qadic_nmod_ctx_t ctx, 
+                                         const qadic_ctx_t qctx, slong N);
+
+FLINT_DLL void qadic_nmod_ctx_clear(qadic_nmod_ctx_t ctx);
+
+QADIC_NMOD_INLINE slong qadic_nmod_ctx_degree(const qadic_nmod_ctx_t ctx)
+{
+    return ctx->j[ctx->len - 1];
+}
+
+QADIC_NMOD_INLINE slong qadic_nmod_ctx_prec(const qadic_nmod_ctx_t ctx)
+{
+    return ctx->pctx.N;
+}
+
+/* Memory management *********************************************************/
+
+QADIC_NMOD_INLINE void qadic_nmod_init(qadic_nmod_t rop, 
+                                       const qadic_nmod_ctx_t ctx)
+{
+    nmod_poly_init2_preinv(rop, ctx->pctx.mod.n, ctx->pctx.mod.ninv, 
+                           qadic_nmod_ctx_degree(ctx));
+}
+
+QADIC_NMOD_INLINE void qadic_nmod_clear(qadic_nmod_t rop, 
+                                        const qadic_nmod_ctx_t ctx)
+{
+    nmod_poly_clear(rop);
+}
+
+/* Reduction *****************************************************************/
+
+QADIC_NMOD_INLINE 
+void _qadic_nmod_sparse_reduce(mp_limb_t *R, slong lenR, 
+                               const qadic_nmod_ctx_t ctx)
+{
+    const slong d = ctx->j[ctx->len - 1];
+    const nmod_t mod = ctx->pctx.mod;
+
+    NMOD_VEC_NORM(R, lenR);
+
+    if (lenR > d)
+    {
+        slong i, k;
+
+        for (i = lenR - 1; i >= d; i--)
+        {
+            for (k = ctx->len - 2; k >= 0; k--)
+            {
+                R[ctx->j[k] + i - d] = n_submod(R[ctx->j[k] + i - d],
+                    n_mulmod2_preinv(R[i], ctx->a[k], mod.n, mod.ninv), mod.n);
+            }
+            R[i] = UWORD(0);
+        }
+    }
+}
+
+QADIC_NMOD_INLINE 
+void _qadic_nmod_dense_reduce(mp_limb_t *R, slong lenR, 
+                              const qadic_nmod_ctx_t ctx)
+{
+    mp_limb_t *q, *r;
+
+    if (lenR < ctx->modulus->length)
+        return;
+
+    q = _nmod_vec_init(lenR - ctx->modulus->length + 1);
+    r = _nmod_vec_init(ctx->modulus->length - 1);
+
+    _nmod_poly_divrem_newton_n_preinv(q, r, R, lenR, 
+                                      ctx->modulus->coeffs, ctx->modulus->length,
+                                      ctx->inv->coeffs, ctx->inv->length,
+                                      ctx->pctx.mod);
+
+    _nmod_vec_set(R, r, ctx->modulus->length - 1);
+    _nmod_vec_clear(q);
+    _nmod_vec_clear(r);
+}
+
+QADIC_NMOD_INLINE 
+void _qadic_nmod_reduce(mp_limb_t *R, slong lenR, const qadic_nmod_ctx_t ctx)
+{
+    if (ctx->sparse_modulus)
+        _qadic_nmod_sparse_reduce(R, lenR, ctx);
+    else
+        _qadic_nmod_dense_reduce(R, lenR, ctx);
+}
+
+QADIC_NMOD_INLINE void qadic_nmod_reduce(qadic_nmod_t rop, 
+                                         const qadic_nmod_ctx_t ctx)
+{
+    _qadic_nmod_reduce(rop->coeffs, rop->length, ctx);
+    rop->length = FLINT_MIN(rop->length, qadic_nmod_ctx_degree(ctx));
+    _nmod_poly_normalise(rop);
+}
+
+/* Basic assignments *********************************************************/
+
+QADIC_NMOD_INLINE void qadic_nmod_zero(qadic_nmod_t rop, 
+                                       const qadic_nmod_ctx_t ctx)
+{
+    nmod_poly_zero(rop);
+}
+
+QADIC_NMOD_INLINE void qadic_nmod_one(qadic_nmod_t rop, 
+                                      const qadic_nmod_ctx_t ctx)
+{
+    nmod_poly_one(rop);
+}
+
+QADIC_NMOD_INLINE void qadic_nmod_gen(qadic_nmod_t rop, 
+                                      const qadic_nmod_ctx_t ctx)
+{
+    nmod_poly_zero(rop);
+
+    if (qadic_nmod_ctx_degree(ctx) > 1)
+        nmod_poly_set_coeff_ui(rop, 1, 1);
+    else if (ctx->j[0] == 0)
+        nmod_poly_set_coeff_ui(rop, 0, nmod_neg(ctx->a[0], ctx->pctx.mod));
+}
+
+QADIC_NMOD_INLINE void qadic_nmod_set(qadic_nmod_t rop, const qadic_nmod_t op, 
+                                      const qadic_nmod_ctx_t ctx)
+{
+    nmod_poly_set(rop, op);
+}
+
+QADIC_NMOD_INLINE void qadic_nmod_swap(qadic_nmod_t x, qadic_nmod_t y, 
+                                       const qadic_nmod_ctx_t ctx)
+{
+    nmod_poly_swap(x, y);
+}
+
+/* Comparison ****************************************************************/
+
+QADIC_NMOD_INLINE int qadic_nmod_is_zero(const qadic_nmod_t op, 
+                                         const qadic_nmod_ctx_t ctx)
+{
+    return nmod_poly_is_zero(op);
+}
+
+QADIC_NMOD_INLINE int qadic_nmod_is_one(const qadic_nmod_t op, 
+                                        const qadic_nmod_ctx_t ctx)
+{
+    return nmod_poly_is_one(op);
+}
+
+QADIC_NMOD_INLINE int qadic_nmod_equal(const qadic_nmod_t op1, 
+                            const qadic_nmod_t op2, const qadic_nmod_ctx_t ctx)
+{
+    return nmod_poly_equal(op1, op2);
+}
+
+FLINT_DLL slong qadic_nmod_val(const qadic_nmod_t op, 
+                               const qadic_nmod_ctx_t ctx);
+
+/* Basic arithmetic **********************************************************/
+
+QADIC_NMOD_INLINE void qadic_nmod_add(qadic_nmod_t rop, const qadic_nmod_t op1, 
+                         const qadic_nmod_t op2, const qadic_nmod_ctx_t ctx)
+{
+    nmod_poly_add(rop, op1, op2);
+}
+
+QADIC_NMOD_INLINE void qadic_nmod_sub(qadic_nmod_t rop, const qadic_nmod_t op1, 
+                         const qadic_nmod_t op2, const qadic_nmod_ctx_t ctx)
+{
+    nmod_poly_sub(rop, op1, op2);
+}
+
+QADIC_NMOD_INLINE void qadic_nmod_neg(qadic_nmod_t rop, const qadic_nmod_t op, 
+                                      const qadic_nmod_ctx_t ctx)
+{
+    nmod_poly_neg(rop, op);
+}
+
+QADIC_NMOD_INLINE void qadic_nmod_scalar_mul_ui(qadic_nmod_t rop, 
+        const qadic_nmod_t op, mp_limb_t c, const qadic_nmod_ctx_t ctx)
+{
+    nmod_poly_scalar_mul_nmod(rop, op, 
+        n_mod2_preinv(c, ctx->pctx.mod.n, ctx->pctx.mod.ninv));
+}
+
+#define QADIC_NMOD_MUL_CUTOFF 32
+
+FLINT_DLL void _qadic_nmod_mul(mp_ptr rop, mp_srcptr op1, slong len1, 
+                     mp_srcptr op2, slong len2, const qadic_nmod_ctx_t ctx);
+
+FLINT_DLL void qadic_nmod_mul(qadic_nmod_t rop, const qadic_nmod_t op1, 
+                         const qadic_nmod_t op2, const qadic_nmod_ctx_t ctx);
+
+FLINT_DLL void qadic_nmod_sqr(qadic_nmod_t rop, const qadic_nmod_t op, 
+                              const qadic_nmod_ctx_t ctx);
+
+FLINT_DLL int qadic_nmod_is_unit(const qadic_nmod_t op, 
+                                 const qadic_nmod_ctx_t ctx);
+
+FLINT_DLL void qadic_nmod_inv(qadic_nmod_t rop, const qadic_nmod_t op, 
+                              const qadic_nmod_ctx_t ctx);
+
+FLINT_DLL void qadic_nmod_pow(qadic_nmod_t rop, const qadic_nmod_t op, 
+                              const fmpz_t e, const qadic_nmod_ctx_t ctx);
+
+/* Conversions ***************************************************************/
+
+FLINT_DLL void qadic_nmod_set_qadic(qadic_nmod_t rop, const qadic_t op, 
+                                    const qadic_nmod_ctx_t ctx);
+
+FLINT_DLL void qadic_nmod_get_qadic(qadic_t rop, const qadic_nmod_t op, 
+                         const qadic_ctx_t qctx, const qadic_nmod_ctx_t ctx);
+
+/* Randomisation *************************************************************/
+
+FLINT_DLL void qadic_nmod_randtest(qadic_nmod_t rop, flint_rand_t state, 
+                                   const qadic_nmod_ctx_t ctx);
+
+/* Output ********************************************************************/
+
+QADIC_NMOD_INLINE int qadic_nmod_fprint(FILE * file, const qadic_nmod_t op, 
+                                        const qadic_nmod_ctx_t ctx)
+{
+    return nmod_poly_fprint(file, op);
+}
+
+QADIC_NMOD_INLINE int qadic_nmod_print(const qadic_nmod_t op, 
+                                       const qadic_nmod_ctx_t ctx)
+{
+    return qadic_nmod_fprint(stdout, op, ctx);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,36 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include "qadic_nmod.h"
+
+void qadic_nmod_ctx_clear(qadic_nmod_ctx_t ctx)
+{
+    padic_nmod_ctx_clear(&ctx->pctx);
+    nmod_poly_clear(ctx->modulus);
+    nmod_poly_clear(ctx->inv);
+    _nmod_vec_clear(ctx->a);
+    flint_free(ctx->j);
+    flint_free(ctx->var);
+}
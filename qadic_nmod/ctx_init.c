@@ -0,0 +1,41 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include "qadic_nmod.h"
+
+void qadic_nmod_ctx_init(qadic_nmod_ctx_t ctx, mp_limb_t p, slong d, 
+                         slong N, const char *var)
+{
+    qadic_ctx_t qctx;
+    fmpz_t P;
+
+    fmpz_init_set_ui(P, p);
+    qadic_ctx_init(qctx, P, d, 0, 0, var, PADIC_SERIES);
+
+    qadic_nmod_ctx_init_qadic(ctx, qctx, N);
+
+    qadic_ctx_clear(qctx);
+    fmpz_clear(P);
+}
@@ -0,0 +1,69 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <string.h>
+
+#include "qadic_nmod.h"
+
+void qadic_nmod_ctx_init_qadic(qadic_nmod_ctx_t ctx, 
+                               const qadic_ctx_t qctx, slong N)
+{
+    const fmpz * p = (&qctx->pctx)->p;
+    const slong d = qadic_ctx_degree(qctx);
+    slong k;
+
+    if (!fmpz_abs_fits_ui(p))
+    {
+        flint_printf("Exception (qadic_nmod_ctx_init_qadic).  "
+                     "p does not fit in a word.\n");
+        abort();
+    }
+
+    padic_nmod_ctx_init(&ctx->pctx, fmpz_get_ui(p), N);
+
+    ctx->len = qctx->len;
+    ctx->a = _nmod_vec_init(ctx->len);
+    ctx->j = flint_malloc(ctx->len * sizeof(slong));
+
+    nmod_poly_init2_preinv(ctx->modulus, ctx->pctx.mod.n, ctx->pctx.mod.ninv, 
+                           d + 1);
+
+    for (k = 0; k < ctx->len; k++)
+    {
+        ctx->a[k] = fmpz_fdiv_ui(qctx->a + k, ctx->pctx.mod.n);
+        ctx->j[k] = qctx->j[k];
+        nmod_poly_set_coeff_ui(ctx->modulus, ctx->j[k], ctx->a[k]);
+    }
+
+    ctx->sparse_modulus = (ctx->len < 6);
+
+    nmod_poly_init2_preinv(ctx->inv, ctx->pctx.mod.n, ctx->pctx.mod.ninv, 
+                           d + 1);
+    nmod_poly_reverse(ctx->inv, ctx->modulus, ctx->modulus->length);
+    nmod_poly_inv_series_newton(ctx->inv, ctx->inv, ctx->modulus->length);
+
+    ctx->var = flint_malloc(strlen(qctx->var) + 1);
+    strcpy(ctx->var, qctx->var);
+}
@@ -0,0 +1,97 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include "qadic_nmod.h"
+
+/*
+    Inverts op modulo p in F_q = F_p[X]/(f), then lifts the inverse by 
+    the Newton iteration b := b (2 - a b), which doubles the number of 
+    correct p-adic digits with each step.
+ */
+
+int qadic_nmod_is_unit(const qadic_nmod_t op, const qadic_nmod_ctx_t ctx)
+{
+    slong i;
+
+    for (i = 0; i < op->length; i++)
+        if (op->coeffs[i] % ctx->pctx.p != 0)
+            return 1;
+
+    return 0;
+}
+
+void qadic_nmod_inv(qadic_nmod_t rop, const qadic_nmod_t op, 
+                    const qadic_nmod_ctx_t ctx)
+{
+    const slong N = ctx->pctx.N;
+    nmod_poly_t a, f, b;
+    qadic_nmod_t s, t;
+    slong i, prec;
+
+    nmod_poly_init_preinv(a, ctx->pctx.pmod.n, ctx->pctx.pmod.ninv);
+    nmod_poly_init_preinv(f, ctx->pctx.pmod.n, ctx->pctx.pmod.ninv);
+    nmod_poly_init_preinv(b, ctx->pctx.pmod.n, ctx->pctx.pmod.ninv);
+
+    nmod_poly_fit_length(a, op->length);
+    for (i = 0; i < op->length; i++)
+        a->coeffs[i] = n_mod2_preinv(op->coeffs[i], 
+                                     ctx->pctx.pmod.n, ctx->pctx.pmod.ninv);
+    _nmod_poly_set_length(a, op->length);
+    _nmod_poly_normalise(a);
+
+    for (i = 0; i < ctx->len; i++)
+        nmod_poly_set_coeff_ui(f, ctx->j[i], ctx->a[i] % ctx->pctx.p);
+
+    if (a->length == 0 || !nmod_poly_invmod(b, a, f))
+    {
+        flint_printf("Exception (qadic_nmod_inv).  Operand is not a unit.\n");
+        abort();
+    }
+
+    qadic_nmod_init(s, ctx);
+    qadic_nmod_init(t, ctx);
+
+    nmod_poly_fit_length(s, b->length);
+    _nmod_vec_set(s->coeffs, b->coeffs, b->length);
+    _nmod_poly_set_length(s, b->length);
+
+    for (prec = 1; prec < N; prec = 2 * prec)
+    {
+        qadic_nmod_mul(t, op, s, ctx);
+        nmod_poly_neg(t, t);
+        nmod_poly_set_coeff_ui(t, 0, 
+            n_addmod(nmod_poly_get_coeff_ui(t, 0), 2, ctx->pctx.mod.n));
+        qadic_nmod_mul(s, s, t, ctx);
+    }
+
+    qadic_nmod_swap(rop, s, ctx);
+
+    qadic_nmod_clear(s, ctx);
+    qadic_nmod_clear(t, ctx);
+
+    nmod_poly_clear(a);
+    nmod_poly_clear(f);
+    nmod_poly_clear(b);
+}
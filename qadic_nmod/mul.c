@@ -0,0 +1,130 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include "qadic_nmod.h"
+
+/*
+    For small degree the product and its reduction modulo f are fused: 
+    the coefficients of op1 op2 are accumulated in three limbs without 
+    reduction, each of the top coefficients is reduced once and folded 
+    into the lower ones as unreduced products with the coefficients 
+    of f, and only the final d coefficients are reduced modulo p^N.
+ */
+
+void _qadic_nmod_mul(mp_ptr rop, mp_srcptr op1, slong len1, 
+                     mp_srcptr op2, slong len2, const qadic_nmod_ctx_t ctx)
+{
+    const slong d = qadic_nmod_ctx_degree(ctx);
+    const slong lenR = len1 + len2 - 1;
+    const nmod_t mod = ctx->pctx.mod;
+    mp_limb_t *t, hi, lo, r;
+    slong i, k, l;
+    TMP_INIT;
+
+    TMP_START;
+    t = TMP_ALLOC(3 * lenR * sizeof(mp_limb_t));
+    flint_mpn_zero(t, 3 * lenR);
+
+    for (i = 0; i < len1; i++)
+    {
+        for (k = 0; k < len2; k++)
+        {
+            mp_limb_t *s = t + 3 * (i + k);
+
+            umul_ppmm(hi, lo, op1[i], op2[k]);
+            add_sssaaaaaa(s[2], s[1], s[0], s[2], s[1], s[0], 0, hi, lo);
+        }
+    }
+
+    for (i = lenR - 1; i >= d; i--)
+    {
+        NMOD_RED3(r, t[3 * i + 2], t[3 * i + 1], t[3 * i], mod);
+
+        if (r != 0)
+        {
+            r = mod.n - r;
+
+            for (k = 0; k < ctx->len - 1; k++)
+            {
+                mp_limb_t *s = t + 3 * (ctx->j[k] + i - d);
+
+                umul_ppmm(hi, lo, r, ctx->a[k]);
+                add_sssaaaaaa(s[2], s[1], s[0], s[2], s[1], s[0], 0, hi, lo);
+            }
+        }
+    }
+
+    l = FLINT_MIN(d, lenR);
+    for (i = 0; i < l; i++)
+        NMOD_RED3(rop[i], t[3 * i + 2], t[3 * i + 1], t[3 * i], mod);
+    for ( ; i < d; i++)
+        rop[i] = 0;
+
+    TMP_END;
+}
+
+void qadic_nmod_mul(qadic_nmod_t rop, const qadic_nmod_t op1, 
+                    const qadic_nmod_t op2, const qadic_nmod_ctx_t ctx)
+{
+    const slong d = qadic_nmod_ctx_degree(ctx);
+
+    if (op1->length == 0 || op2->length == 0)
+    {
+        qadic_nmod_zero(rop, ctx);
+    }
+    else if (d < QADIC_NMOD_MUL_CUTOFF)
+    {
+        if (rop == op1 || rop == op2)
+        {
+            mp_ptr t = _nmod_vec_init(d);
+
+            _qadic_nmod_mul(t, op1->coeffs, op1->length, 
+                               op2->coeffs, op2->length, ctx);
+            _nmod_vec_clear(rop->coeffs);
+            rop->coeffs = t;
+            rop->alloc  = d;
+        }
+        else
+        {
+            nmod_poly_fit_length(rop, d);
+            _qadic_nmod_mul(rop->coeffs, op1->coeffs, op1->length, 
+                                         op2->coeffs, op2->length, ctx);
+        }
+
+        _nmod_poly_set_length(rop, d);
+        _nmod_poly_normalise(rop);
+    }
+    else
+    {
+        nmod_poly_mul(rop, op1, op2);
+        qadic_nmod_reduce(rop, ctx);
+    }
+}
+
+void qadic_nmod_sqr(qadic_nmod_t rop, const qadic_nmod_t op, 
+                    const qadic_nmod_ctx_t ctx)
+{
+    qadic_nmod_mul(rop, op, op, ctx);
+}
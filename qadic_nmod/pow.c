@@ -0,0 +1,64 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include "qadic_nmod.h"
+
+void qadic_nmod_pow(qadic_nmod_t rop, const qadic_nmod_t op, const fmpz_t e, 
+                    const qadic_nmod_ctx_t ctx)
+{
+    qadic_nmod_t x, t;
+    slong i;
+
+    if (fmpz_sgn(e) < 0)
+    {
+        flint_printf("Exception (qadic_nmod_pow).  e < 0.\n");
+        abort();
+    }
+
+    if (fmpz_is_zero(e))
+    {
+        qadic_nmod_one(rop, ctx);
+        return;
+    }
+
+    qadic_nmod_init(x, ctx);
+    qadic_nmod_init(t, ctx);
+
+    qadic_nmod_set(x, op, ctx);
+
+    for (i = fmpz_bits(e) - 2; i >= 0; i--)
+    {
+        qadic_nmod_sqr(t, x, ctx);
+        if (fmpz_tstbit(e, i))
+            qadic_nmod_mul(x, t, op, ctx);
+        else
+            qadic_nmod_swap(x, t, ctx);
+    }
+
+    qadic_nmod_swap(rop, x, ctx);
+
+    qadic_nmod_clear(x, ctx);
+    qadic_nmod_clear(t, ctx);
+}
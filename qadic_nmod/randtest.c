@@ -0,0 +1,56 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include "qadic_nmod.h"
+
+void qadic_nmod_randtest(qadic_nmod_t rop, flint_rand_t state, 
+                         const qadic_nmod_ctx_t ctx)
+{
+    const slong d = qadic_nmod_ctx_degree(ctx);
+    const slong N = ctx->pctx.N;
+    slong i, v;
+
+    v = n_randint(state, N + 1);
+
+    if (v == N)
+    {
+        qadic_nmod_zero(rop, ctx);
+        return;
+    }
+
+    nmod_poly_fit_length(rop, d);
+
+    for (i = 0; i < d; i++)
+    {
+        if (n_randint(state, 4) == 0)
+            rop->coeffs[i] = 0;
+        else
+            rop->coeffs[i] = n_randint(state, ctx->pctx.pow[N - v]) 
+                             * ctx->pctx.pow[v];
+    }
+
+    _nmod_poly_set_length(rop, d);
+    _nmod_poly_normalise(rop);
+}
@@ -0,0 +1,93 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "qadic_nmod.h"
+#include "ulong_extras.h"
+#include "long_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("get_set_qadic... ");
+    fflush(stdout);
+
+    /* Check that conversion to qadic and back is the identity */
+    for (i = 0; i < 2000 * flint_test_multiplier(); i++)
+    {
+        fmpz_t P;
+        mp_limb_t p;
+        slong d, N;
+        qadic_ctx_t qctx;
+        qadic_nmod_ctx_t ctx;
+        qadic_t x;
+        qadic_nmod_t a, b;
+
+        p = n_randprime(state, 2 + n_randint(state, 8), 1);
+        d = n_randint(state, 10) + 1;
+        N = n_randint(state, padic_nmod_max_prec(p)) + 1;
+
+        fmpz_init_set_ui(P, p);
+        qadic_ctx_init(qctx, P, d, 0, N, "a", PADIC_SERIES);
+        qadic_nmod_ctx_init_qadic(ctx, qctx, N);
+
+        qadic_init2(x, N + n_randint(state, 5));
+        qadic_nmod_init(a, ctx);
+        qadic_nmod_init(b, ctx);
+
+        qadic_nmod_randtest(a, state, ctx);
+        qadic_nmod_get_qadic(x, a, qctx, ctx);
+        qadic_nmod_set_qadic(b, x, ctx);
+
+        result = (qadic_nmod_equal(a, b, ctx) && 
+            (qadic_nmod_is_zero(a, ctx) || qadic_val(x) == qadic_nmod_val(a, ctx)));
+        if (!result)
+        {
+            flint_printf("FAIL:\n\n");
+            flint_printf("p = %wu, d = %wd, N = %wd\n", p, d, N);
+            flint_printf("a = "), qadic_nmod_print(a, ctx), flint_printf("\n");
+            flint_printf("b = "), qadic_nmod_print(b, ctx), flint_printf("\n");
+            abort();
+        }
+
+        qadic_clear(x);
+        qadic_nmod_clear(a, ctx);
+        qadic_nmod_clear(b, ctx);
+
+        qadic_nmod_ctx_clear(ctx);
+        qadic_ctx_clear(qctx);
+        fmpz_clear(P);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return EXIT_SUCCESS;
+}
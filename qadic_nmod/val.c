@@ -0,0 +1,39 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2016 The FLINT team
+
+******************************************************************************/
+
+#include "qadic_nmod.h"
+
+slong qadic_nmod_val(const qadic_nmod_t op, const qadic_nmod_ctx_t ctx)
+{
+    slong i, v = ctx->pctx.N;
+
+    for (i = 0; i < op->length && v > 0; i++)
+    {
+        if (op->coeffs[i] != 0)
+            v = FLINT_MIN(v, padic_nmod_val(op->coeffs[i], &ctx->pctx));
+    }
+
+    return v;
+}